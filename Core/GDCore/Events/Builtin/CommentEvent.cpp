@@ -47,6 +47,7 @@ void CommentEvent::UnserializeFrom(gd::Project &project,
 
   com1 = element.GetChild("comment", 0, "Com1").GetValue().GetString();
   com2 = element.GetChild("comment2", 0, "Com2").GetValue().GetString();
+  MarkAsModified();
 }
 
 }  // namespace gd
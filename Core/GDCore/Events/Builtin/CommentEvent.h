@@ -44,7 +44,10 @@ class GD_CORE_API CommentEvent : public gd::BaseEvent {
   }
 
   const gd::String& GetComment() const { return com1; }
-  void SetComment(const gd::String& comment) { com1 = comment; }
+  void SetComment(const gd::String& comment) {
+    com1 = comment;
+    MarkAsModified();
+  }
 
   virtual std::vector<gd::String> GetAllSearchableStrings() const;
 
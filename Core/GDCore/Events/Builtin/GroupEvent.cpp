@@ -47,6 +47,7 @@ void GroupEvent::UnserializeFrom(gd::Project& project,
                                  const SerializerElement& element) {
   name = element.GetStringAttribute("name");
   source = element.GetStringAttribute("source");
+  MarkAsModified();
   creationTime = element.GetIntAttribute("creationTime");
   colorR = element.GetIntAttribute("colorR");
   colorG = element.GetIntAttribute("colorG");
@@ -55,7 +56,7 @@ void GroupEvent::UnserializeFrom(gd::Project& project,
       project, events, element.GetChild("events"));
 
   parameters.clear();
-  gd::SerializerElement& parametersElement = element.GetChild("parameters");
+  const gd::SerializerElement& parametersElement = element.GetChild("parameters");
   parametersElement.ConsiderAsArrayOf("parameters");
   for (std::size_t i = 0; i < parametersElement.GetChildrenCount(); ++i)
     parameters.push_back(parametersElement.GetChild(i).GetValue().GetString());
@@ -130,7 +130,7 @@ void LinkEvent::SerializeTo(SerializerElement& element) const {
 
 void LinkEvent::UnserializeFrom(gd::Project& project,
                                 const SerializerElement& element) {
-  SerializerElement& includeElement = element.GetChild("include", 0, "Limites");
+  const SerializerElement& includeElement = element.GetChild("include", 0, "Limites");
 
   SetTarget(element.GetChild("target", 0, "Scene").GetValue().GetString());
 
@@ -797,8 +797,9 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    output += "\n" + GenerateProfilerEventBegin(events[eId]) + scopeBegin +
+              "\n" + declarationsCode + "\n" + eventCoreCode + "\n" +
+              scopeEnd + GenerateProfilerEventEnd(events[eId]) + "\n";
   }
 
   return output;
@@ -13,6 +13,7 @@
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InsertionOrderedSet.h"
 namespace gd {
 class EventsList;
 class Expression;
@@ -210,7 +211,7 @@ class GD_CORE_API EventsCodeGenerator {
    *  - On GD JS Platform, the includes files are added in the list of JS files
    * in the index file.
    */
-  void AddIncludeFile(gd::String file) {
+  void AddIncludeFile(const gd::String& file) {
     if (!file.empty()) includeFiles.insert(file);
   };
 
@@ -218,7 +219,7 @@ class GD_CORE_API EventsCodeGenerator {
    * \brief Declare a list of include files to be added
    * \see gd::EventsCodeGenerator::AddIncludeFile
    */
-  void AddIncludeFiles(std::vector<gd::String> files) {
+  void AddIncludeFiles(const std::vector<gd::String>& files) {
     for (std::size_t i = 0; i < files.size(); ++i) AddIncludeFile(files[i]);
   };
 
@@ -236,9 +237,12 @@ class GD_CORE_API EventsCodeGenerator {
     customCodeOutsideMain += code;
   };
 
-  /** \brief Get the set containing the include files.
+  /** \brief Get the set containing the include files, in the order they were
+   * added.
    */
-  const std::set<gd::String>& GetIncludeFiles() const { return includeFiles; }
+  const gd::InsertionOrderedSet<gd::String>& GetIncludeFiles() const {
+    return includeFiles;
+  }
 
   /** \brief Get the custom code to be inserted outside main.
    */
@@ -393,6 +397,22 @@ class GD_CORE_API EventsCodeGenerator {
     return "";
   };
 
+  /**
+   * \brief Generate the code to notify the profiler of the beginning of an
+   * event. Called by GenerateEventsListCode before the code of each event.
+   */
+  virtual gd::String GenerateProfilerEventBegin(const gd::BaseEvent& event) {
+    return "";
+  };
+
+  /**
+   * \brief Generate the code to notify the profiler of the end of an event.
+   * Called by GenerateEventsListCode after the code of each event.
+   */
+  virtual gd::String GenerateProfilerEventEnd(const gd::BaseEvent& event) {
+    return "";
+  };
+
   /**
    * \brief Get the namespace to be used to store code generated
    * objects/values/functions, with the extra "dot" at the end to be used to
@@ -742,7 +762,7 @@ class GD_CORE_API EventsCodeGenerator {
   bool compilationForRuntime;  ///< Is set to true if the code generation is
                                ///< made for runtime only.
 
-  std::set<gd::String>
+  gd::InsertionOrderedSet<gd::String>
       includeFiles;  ///< List of headers files used by instructions. A (shared)
                      ///< pointer is used so as context created from another one
                      ///< can share the same list.
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include "GDCore/Events/EventsRevision.h"
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
@@ -241,12 +242,18 @@ class GD_CORE_API BaseEvent {
   /**
    * \brief Change the event type
    */
-  void SetType(gd::String type_) { type = type_; };
+  void SetType(gd::String type_) {
+    type = type_;
+    MarkAsModified();
+  };
 
   /**
    * \brief Set if the event if disabled or not
    */
-  void SetDisabled(bool disable = true) { disabled = disable; }
+  void SetDisabled(bool disable = true) {
+    disabled = disable;
+    MarkAsModified();
+  }
 
   /**
    * \brief True if event is disabled
@@ -264,6 +271,20 @@ class GD_CORE_API BaseEvent {
    */
   bool IsFolded() const { return folded; }
 
+  /**
+   * \brief Return the revision of the event, changed when its properties are
+   * modified (but not when its instructions or sub events are).
+   *
+   * \see gd::EventsRevision
+   */
+  std::size_t GetRevision() const { return revision.Get(); }
+
+  /**
+   * \brief Change the revision of the event. To be called by derived classes
+   * when a property is modified.
+   */
+  void MarkAsModified() { revision.Increment(); }
+
   ///@}
 
   std::weak_ptr<gd::BaseEvent>
@@ -282,6 +303,7 @@ class GD_CORE_API BaseEvent {
   bool disabled;    ///< True if the event is disabled and must not be executed
   gd::String type;  ///< Type of the event. Must be assigned at the creation.
                     ///< Used for saving the event for instance.
+  gd::EventsRevision revision;
 
   static gd::EventsList badSubEvents;
   static std::vector<gd::String> emptyDependencies;
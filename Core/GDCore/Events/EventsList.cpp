@@ -31,6 +31,7 @@ void EventsList::InsertEvents(const EventsList& otherEvents,
       events.push_back(
           CloneRememberingOriginalEvent(otherEvents.events[begin + insertPos]));
   }
+  revision.Increment();
 }
 
 gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
@@ -41,6 +42,7 @@ gd::BaseEvent& EventsList::InsertEvent(const gd::BaseEvent& evt,
   else
     events.push_back(event);
 
+  revision.Increment();
   return *event;
 }
 
@@ -50,6 +52,8 @@ void EventsList::InsertEvent(std::shared_ptr<gd::BaseEvent> event,
     events.insert(events.begin() + position, event);
   else
     events.push_back(event);
+
+  revision.Increment();
 }
 
 gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
@@ -67,12 +71,14 @@ gd::BaseEvent& EventsList::InsertNewEvent(gd::Project& project,
 
 void EventsList::RemoveEvent(size_t index) {
   events.erase(events.begin() + index);
+  revision.Increment();
 }
 
 void EventsList::RemoveEvent(const gd::BaseEvent& event) {
   for (size_t i = 0; i < events.size(); ++i) {
     if (events[i].get() == &event) {
       events.erase(events.begin() + i);
+      revision.Increment();
       return;
     }
   }
@@ -107,6 +113,7 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
     if (events[i].get() == &eventToMove) {
       std::shared_ptr<BaseEvent> event = events[i];
       events.erase(events.begin() + i);
+      revision.Increment();
 
       newEventsList.InsertEvent(event, newPosition);
       return true;
@@ -128,6 +135,7 @@ void EventsList::Init(const gd::EventsList& other) {
   events.clear();
   for (size_t i = 0; i < other.events.size(); ++i)
     events.push_back(CloneRememberingOriginalEvent(other.events[i]));
+  revision.Increment();
 }
 
 }  // namespace gd
@@ -8,6 +8,7 @@
 #define GDCORE_EVENTSLIST_H
 #include <memory>
 #include <vector>
+#include "GDCore/Events/EventsRevision.h"
 #include "GDCore/String.h"
 namespace gd {
 class Project;
@@ -130,7 +131,10 @@ class GD_CORE_API EventsList {
   /**
    * \brief Clear the list of events.
    */
-  void Clear() { return events.clear(); };
+  void Clear() {
+    events.clear();
+    revision.Increment();
+  };
 
   /** \name Utilities
    * Utility methods
@@ -162,6 +166,14 @@ class GD_CORE_API EventsList {
   bool MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
                                     gd::EventsList& newEventsList,
                                     std::size_t newPosition);
+
+  /**
+   * \brief Return the revision of the list, changed when events are inserted,
+   * removed or moved (but not when they are modified).
+   *
+   * \see gd::EventsRevision
+   */
+  std::size_t GetRevision() const { return revision.Get(); }
   ///@}
 
   /** \name std::vector API compatibility
@@ -209,6 +221,7 @@ class GD_CORE_API EventsList {
 
  private:
   std::vector<std::shared_ptr<BaseEvent> > events;
+  gd::EventsRevision revision;
 
   /**
    * Initialize from another list of events, copying events. Used by copy-ctor
@@ -0,0 +1,21 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/EventsRevision.h"
+
+#include <atomic>
+
+namespace gd {
+
+namespace {
+// Events can be copied in parallel (see gd::ParallelFor).
+std::atomic<std::size_t> lastRevision(0);
+}  // namespace
+
+std::size_t EventsRevision::GetLast() { return lastRevision; }
+
+std::size_t EventsRevision::Next() { return ++lastRevision; }
+
+}  // namespace gd
@@ -0,0 +1,59 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_EVENTSREVISION_H
+#define GDCORE_EVENTSREVISION_H
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief The revision of an event, an instruction or a list of events: a
+ * number changed at each of their modifications, so that tools can know if
+ * they were modified since they last went through them.
+ *
+ * Revisions are taken from a single counter, so that a revision is greater
+ * than the revisions of all the modifications done before. Creating, copying
+ * or destroying a revision counts as a modification.
+ *
+ * \see gd::EventsSearchIndex
+ * \ingroup Events
+ */
+class GD_CORE_API EventsRevision {
+ public:
+  EventsRevision() : revision(Next()) {}
+  EventsRevision(const EventsRevision&) : revision(Next()) {}
+  EventsRevision& operator=(const EventsRevision&) {
+    revision = Next();
+    return *this;
+  }
+  ~EventsRevision() { Next(); }
+
+  /**
+   * \brief Change the revision, after a modification.
+   */
+  void Increment() { revision = Next(); }
+
+  /**
+   * \brief Return the revision.
+   */
+  std::size_t Get() const { return revision; }
+
+  /**
+   * \brief Return the revision of the last modification of any event,
+   * instruction or list of events.
+   */
+  static std::size_t GetLast();
+
+ private:
+  static std::size_t Next();
+
+  std::size_t revision;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSREVISION_H
@@ -41,6 +41,17 @@ class GD_CORE_API Expression {
    */
   inline const gd::String& GetPlainString() const { return plainString; };
 
+  /**
+   * \brief Return true if the plain string of the expression contains \a text.
+   *
+   * An expression can only refer to an object, a behavior or a function if
+   * its name appears in it. Refactoring tools use this to avoid parsing
+   * expressions that can't be concerned by a change.
+   */
+  bool Contains(const gd::String& text) const {
+    return plainString.Raw().find(text.Raw()) != std::string::npos;
+  };
+
   /**
    * \brief Mimics std::string::c_str
    */
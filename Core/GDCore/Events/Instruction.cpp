@@ -38,6 +38,8 @@ const gd::Expression& Instruction::GetParameter(std::size_t index) const {
 gd::Expression& Instruction::GetParameter(std::size_t index) {
   if (index >= parameters.size()) return badExpression;
 
+  // The parameter can be modified using the returned reference.
+  revision.Increment();
   return parameters[index];
 }
 
@@ -45,6 +47,7 @@ void Instruction::SetParametersCount(std::size_t size) {
   while (size < parameters.size())
     parameters.erase(parameters.begin() + parameters.size() - 1);
   while (size > parameters.size()) parameters.push_back(gd::Expression(""));
+  revision.Increment();
 }
 
 void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
@@ -53,6 +56,7 @@ void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
     return;
   }
   parameters[nb] = val;
+  revision.Increment();
 }
 
 std::shared_ptr<Instruction> GD_CORE_API
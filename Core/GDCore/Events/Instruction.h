@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 
+#include "GDCore/Events/EventsRevision.h"
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
@@ -58,7 +59,10 @@ class GD_CORE_API Instruction {
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType) {
+    type = newType;
+    revision.Increment();
+  }
 
   /**
    * \brief Return true if the condition is inverted
@@ -70,7 +74,10 @@ class GD_CORE_API Instruction {
    * \brief Set if the instruction is inverted or not.
    * \param inverted true if the condition must be set as inverted
    */
-  void SetInverted(bool inverted_) { inverted = inverted_; }
+  void SetInverted(bool inverted_) {
+    inverted = inverted_;
+    revision.Increment();
+  }
 
   /**
    * \brief Return the number of parameters of the instruction.
@@ -119,6 +126,7 @@ class GD_CORE_API Instruction {
    */
   inline void SetParameters(const std::vector<gd::Expression>& val) {
     parameters = val;
+    revision.Increment();
   }
 
   /**
@@ -141,6 +149,14 @@ class GD_CORE_API Instruction {
    */
   std::weak_ptr<Instruction> GetOriginalInstruction() { return originalInstruction; };
 
+  /**
+   * \brief Return the revision of the instruction, changed when its type or
+   * parameters are modified (but not when its sub instructions are).
+   *
+   * \see gd::EventsRevision
+   */
+  std::size_t GetRevision() const { return revision.Get(); }
+
   friend std::shared_ptr<Instruction> CloneRememberingOriginalElement(
       std::shared_ptr<Instruction> instruction);
 
@@ -151,6 +167,7 @@ class GD_CORE_API Instruction {
   mutable std::vector<gd::Expression>
       parameters;                        ///< Vector containing the parameters
   gd::InstructionsList subInstructions;  ///< Sub instructions, if applicable.
+  gd::EventsRevision revision;
 
   std::weak_ptr<Instruction>
       originalInstruction;  ///< Pointer used to remember which gd::Instruction
@@ -207,7 +207,7 @@ void EventsListSerialization::UnserializeEventsFrom(
   list.Clear();
   events.ConsiderAsArrayOf("event", "Event");
   for (std::size_t i = 0; i < events.GetChildrenCount(); ++i) {
-    SerializerElement& eventElem = events.GetChild(i);
+    const SerializerElement& eventElem = events.GetChild(i);
     gd::String type =
         eventElem.GetChild("type", 0, "Type").GetValue().GetString();
     gd::BaseEventSPtr event = project.CreateEvent(type);
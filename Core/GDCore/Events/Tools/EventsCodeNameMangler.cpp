@@ -8,10 +8,12 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/String.h"
 
-EventsCodeNameMangler *EventsCodeNameMangler::_singleton = nullptr;
 
 const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
     const gd::String &originalObjectName) {
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(mangledNamesMutex);
+#endif
   auto it = mangledObjectNames.find(originalObjectName);
   if (it != mangledObjectNames.end()) {
     return it->second;
@@ -38,6 +40,9 @@ const gd::String& EventsCodeNameMangler::GetMangledObjectsListName(
 
 const gd::String& EventsCodeNameMangler::GetExternalEventsFunctionMangledName(
     const gd::String &externalEventsName) {
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(mangledNamesMutex);
+#endif
   auto it = mangledExternalEventsNames.find(externalEventsName);
   if (it != mangledExternalEventsNames.end()) {
     return it->second;
@@ -67,16 +72,18 @@ const gd::String& ManObjListName(const gd::String &objectName) {
 }
 
 EventsCodeNameMangler *EventsCodeNameMangler::Get() {
-  if (nullptr == _singleton) _singleton = new EventsCodeNameMangler;
-
-  return (static_cast<EventsCodeNameMangler *>(_singleton));
+  // The initialization of a static local variable is thread-safe.
+  static EventsCodeNameMangler singleton;
+  return &singleton;
 }
 
 void EventsCodeNameMangler::DestroySingleton() {
-  if (nullptr != _singleton) {
-    delete _singleton;
-    _singleton = nullptr;
-  }
+  EventsCodeNameMangler *singleton = Get();
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(singleton->mangledNamesMutex);
+#endif
+  singleton->mangledObjectNames.clear();
+  singleton->mangledExternalEventsNames.clear();
 }
 
 #endif
@@ -7,11 +7,16 @@
 #ifndef EVENTSCODENAMEMANGLER_H
 #define EVENTSCODENAMEMANGLER_H
 #include <unordered_map>
+#if !defined(EMSCRIPTEN)
+#include <mutex>
+#endif
 #include "GDCore/String.h"
 
 /**
  * \brief Mangle object names, so as to ensure all names used in code are valid.
  *
+ * Mangled names are memoized, and can be requested from several threads.
+ *
  * \see ManObjListName
  */
 class GD_CORE_API EventsCodeNameMangler {
@@ -37,18 +42,24 @@ class GD_CORE_API EventsCodeNameMangler {
       const gd::String &externalEventsName);
 
   static EventsCodeNameMangler *Get();
+
+  /**
+   * \brief Clear the memoized names (the instance returned by Get is kept).
+   */
   static void DestroySingleton();
 
  private:
   EventsCodeNameMangler(){};
   virtual ~EventsCodeNameMangler(){};
-  static EventsCodeNameMangler *_singleton;
 
   std::unordered_map<gd::String, gd::String>
       mangledObjectNames;  ///< Memoized results of mangling for objects
   std::unordered_map<gd::String, gd::String>
       mangledExternalEventsNames;  ///< Memoized results of mangling for
                                    /// external events
+#if !defined(EMSCRIPTEN)
+  std::mutex mangledNamesMutex;
+#endif
 };
 
 /**
@@ -38,7 +38,7 @@ gd::ExpressionMetadata& ExpressionMetadata::AddParameter(
     bool parameterIsOptional) {
   gd::ParameterMetadata info;
   info.type = type;
-  info.description = description;
+  info.SetDescription(description);
   info.codeOnly = false;
   info.optional = parameterIsOptional;
   info.supplementaryInformation =
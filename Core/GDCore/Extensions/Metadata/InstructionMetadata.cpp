@@ -13,11 +13,21 @@
 #include "ParameterMetadata.h"
 
 namespace gd {
+const std::shared_ptr<InstructionMetadata::EditorInformation>&
+InstructionMetadata::GetUnknownInstructionEditorInformation() {
+  static std::shared_ptr<EditorInformation> editorInformation = []() {
+    auto editorInformation = std::make_shared<EditorInformation>();
+    // Avoid translating this string, so that it's safe and *fast* to use
+    // a InstructionMetadata.
+    editorInformation->sentence = "Unknown or unsupported instruction";
+    return editorInformation;
+  }();
+
+  return editorInformation;
+}
+
 InstructionMetadata::InstructionMetadata()
-    : sentence("Unknown or unsupported instruction"),  // Avoid translating this
-                                                       // string, so that it's
-                                                       // safe and *fast* to use
-                                                       // a InstructionMetadata.
+    : editorInformation(GetUnknownInstructionEditorInformation()),
       canHaveSubInstructions(false),
       hidden(true),
       usageComplexity(5),
@@ -33,20 +43,29 @@ InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
                                          const gd::String& group_,
                                          const gd::String& icon_,
                                          const gd::String& smallIcon_)
-    : fullname(fullname_),
-      description(description_),
-      helpPath(""),
-      sentence(sentence_),
-      group(group_),
-      iconFilename(icon_),
-      smallIconFilename(smallIcon_),
+    : editorInformation(std::make_shared<EditorInformation>()),
       canHaveSubInstructions(false),
       extensionNamespace(extensionNamespace_),
       hidden(false),
       usageComplexity(5),
       isPrivate(false),
       isObjectInstruction(false),
-      isBehaviorInstruction(false) {}
+      isBehaviorInstruction(false) {
+  editorInformation->fullname = fullname_;
+  editorInformation->description = description_;
+  editorInformation->sentence = sentence_;
+  editorInformation->group = group_;
+  editorInformation->iconFilename = icon_;
+  editorInformation->smallIconFilename = smallIcon_;
+}
+
+InstructionMetadata::EditorInformation&
+InstructionMetadata::GetEditorInformation() {
+  if (editorInformation.use_count() > 1)
+    editorInformation = std::make_shared<EditorInformation>(*editorInformation);
+
+  return *editorInformation;
+}
 
 InstructionMetadata& InstructionMetadata::AddParameter(
     const gd::String& type,
@@ -55,7 +74,7 @@ InstructionMetadata& InstructionMetadata::AddParameter(
     bool parameterIsOptional) {
   ParameterMetadata info;
   info.type = type;
-  info.description = description;
+  info.SetDescription(description);
   info.codeOnly = false;
   info.optional = parameterIsOptional;
   info.supplementaryInformation =
@@ -98,6 +117,7 @@ InstructionMetadata& InstructionMetadata::UseStandardOperatorParameters(
   size_t operatorParamIndex = parameters.size() - 2;
   size_t valueParamIndex = parameters.size() - 1;
 
+  gd::String& sentence = GetEditorInformation().sentence;
   if (isObjectInstruction || isBehaviorInstruction) {
     gd::String templateSentence =
         _("Change <subject> of _PARAM0_: <operator> <value>");
@@ -134,6 +154,7 @@ InstructionMetadata::UseStandardRelationalOperatorParameters(
   size_t operatorParamIndex = parameters.size() - 2;
   size_t valueParamIndex = parameters.size() - 1;
 
+  gd::String& sentence = GetEditorInformation().sentence;
   if (isObjectInstruction || isBehaviorInstruction) {
     gd::String templateSentence = _("<subject> of _PARAM0_ <operator> <value>");
 
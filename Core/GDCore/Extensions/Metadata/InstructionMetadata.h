@@ -52,10 +52,16 @@ class GD_CORE_API InstructionMetadata {
 
   virtual ~InstructionMetadata(){};
 
-  const gd::String &GetFullName() const { return fullname; }
-  const gd::String &GetDescription() const { return description; }
-  const gd::String &GetSentence() const { return sentence; }
-  const gd::String &GetGroup() const { return group; }
+  const gd::String &GetFullName() const {
+    return editorInformation->fullname;
+  }
+  const gd::String &GetDescription() const {
+    return editorInformation->description;
+  }
+  const gd::String &GetSentence() const {
+    return editorInformation->sentence;
+  }
+  const gd::String &GetGroup() const { return editorInformation->group; }
   ParameterMetadata &GetParameter(size_t i) { return parameters[i]; }
   const ParameterMetadata &GetParameter(size_t i) const {
     return parameters[i];
@@ -64,22 +70,28 @@ class GD_CORE_API InstructionMetadata {
   const std::vector<ParameterMetadata> &GetParameters() const {
     return parameters;
   }
-  const gd::String &GetIconFilename() const { return iconFilename; }
-  const gd::String &GetSmallIconFilename() const { return smallIconFilename; }
+  const gd::String &GetIconFilename() const {
+    return editorInformation->iconFilename;
+  }
+  const gd::String &GetSmallIconFilename() const {
+    return editorInformation->smallIconFilename;
+  }
   bool CanHaveSubInstructions() const { return canHaveSubInstructions; }
 
   /**
    * Get the help path of the instruction, relative to the GDevelop
    * documentation root.
    */
-  const gd::String &GetHelpPath() const { return helpPath; }
+  const gd::String &GetHelpPath() const {
+    return editorInformation->helpPath;
+  }
 
   /**
    * Set the help path of the instruction, relative to the GDevelop
    * documentation root.
    */
   InstructionMetadata &SetHelpPath(const gd::String &path) {
-    helpPath = path;
+    GetEditorInformation().helpPath = path;
     return *this;
   }
 
@@ -120,7 +132,7 @@ class GD_CORE_API InstructionMetadata {
    * \brief Set the group of the instruction in the IDE.
    */
   InstructionMetadata &SetGroup(const gd::String &str) {
-    group = str;
+    GetEditorInformation().group = str;
     return *this;
   }
 
@@ -435,13 +447,36 @@ class GD_CORE_API InstructionMetadata {
   std::vector<ParameterMetadata> parameters;
 
  private:
-  gd::String fullname;
-  gd::String description;
-  gd::String helpPath;
-  gd::String sentence;
-  gd::String group;
-  gd::String iconFilename;
-  gd::String smallIconFilename;
+  /**
+   * \brief The information about the instruction only used by the editor.
+   *
+   * Stored apart from the information used by code generation, and shared
+   * between copies of the metadata until one of them is modified.
+   */
+  struct EditorInformation {
+    gd::String fullname;
+    gd::String description;
+    gd::String helpPath;
+    gd::String sentence;
+    gd::String group;
+    gd::String iconFilename;
+    gd::String smallIconFilename;
+  };
+
+  /**
+   * \brief Return the editor information of the instruction, so that it can
+   * be modified (copying it if it's shared).
+   */
+  EditorInformation &GetEditorInformation();
+
+  /**
+   * \brief Return the editor information shared by the metadata of unknown
+   * instructions.
+   */
+  static const std::shared_ptr<EditorInformation>
+      &GetUnknownInstructionEditorInformation();
+
+  std::shared_ptr<EditorInformation> editorInformation;  ///< Never null.
   bool canHaveSubInstructions;
   gd::String extensionNamespace;
   bool hidden;
@@ -26,92 +26,86 @@ gd::InstructionMetadata MetadataProvider::badInstructionMetadata;
 gd::ExpressionMetadata MetadataProvider::badExpressionMetadata;
 gd::PlatformExtension MetadataProvider::badExtension;
 
+namespace {
+/**
+ * \brief Return a pointer to the metadata of the given type in the map, or
+ * nullptr if not found.
+ */
+template <class T>
+const T* FindMetadata(const std::map<gd::String, T>& allMetadata,
+                      const gd::String& type) {
+  auto it = allMetadata.find(type);
+  return it != allMetadata.end() ? &it->second : nullptr;
+}
+}  // namespace
+
 ExtensionAndMetadata<BehaviorMetadata>
-MetadataProvider::GetExtensionAndBehaviorMetadata(const gd::Platform& platform,
-                                                  gd::String behaviorType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto behaviorTypes = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < behaviorTypes.size(); ++j) {
-      if (behaviorTypes[j] == behaviorType)
-        return ExtensionAndMetadata<BehaviorMetadata>(
-            *extension, extension->GetBehaviorMetadata(behaviorType));
-    }
+MetadataProvider::GetExtensionAndBehaviorMetadata(
+    const gd::Platform& platform, const gd::String& behaviorType) {
+  for (auto& extension :
+       platform.GetPlatformExtensionsForType(behaviorType)) {
+    if (auto metadata =
+            FindMetadata(extension->GetAllBehaviors(), behaviorType))
+      return ExtensionAndMetadata<BehaviorMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<BehaviorMetadata>(badExtension, badBehaviorMetadata);
 }
 
 const BehaviorMetadata& MetadataProvider::GetBehaviorMetadata(
-    const gd::Platform& platform, gd::String behaviorType) {
+    const gd::Platform& platform, const gd::String& behaviorType) {
   return GetExtensionAndBehaviorMetadata(platform, behaviorType).GetMetadata();
 }
 
 ExtensionAndMetadata<ObjectMetadata>
 MetadataProvider::GetExtensionAndObjectMetadata(const gd::Platform& platform,
-                                                gd::String objectType) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionObjectsTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == objectType)
-        return ExtensionAndMetadata<ObjectMetadata>(
-            *extension, extension->GetObjectMetadata(objectType));
-    }
+                                                const gd::String& objectType) {
+  for (auto& extension :
+       platform.GetPlatformExtensionsForType(objectType)) {
+    if (auto metadata = FindMetadata(extension->GetAllObjects(), objectType))
+      return ExtensionAndMetadata<ObjectMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ObjectMetadata>(badExtension, badObjectInfo);
 }
 
 const ObjectMetadata& MetadataProvider::GetObjectMetadata(
-    const gd::Platform& platform, gd::String objectType) {
+    const gd::Platform& platform, const gd::String& objectType) {
   return GetExtensionAndObjectMetadata(platform, objectType).GetMetadata();
 }
 
 ExtensionAndMetadata<EffectMetadata>
 MetadataProvider::GetExtensionAndEffectMetadata(const gd::Platform& platform,
-                                                gd::String type) {
-  for (auto& extension : platform.GetAllPlatformExtensions()) {
-    auto objectsTypes = extension->GetExtensionEffectTypes();
-    for (std::size_t j = 0; j < objectsTypes.size(); ++j) {
-      if (objectsTypes[j] == type)
-        return ExtensionAndMetadata<EffectMetadata>(
-            *extension, extension->GetEffectMetadata(type));
-    }
+                                                const gd::String& type) {
+  for (auto& extension : platform.GetPlatformExtensionsForType(type)) {
+    if (auto metadata = FindMetadata(extension->GetAllEffects(), type))
+      return ExtensionAndMetadata<EffectMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<EffectMetadata>(badExtension, badEffectMetadata);
 }
 
 const EffectMetadata& MetadataProvider::GetEffectMetadata(
-    const gd::Platform& platform, gd::String objectType) {
+    const gd::Platform& platform, const gd::String& objectType) {
   return GetExtensionAndEffectMetadata(platform, objectType).GetMetadata();
 }
 
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
-                                                gd::String actionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+                                                const gd::String& actionType) {
+  auto& extensions = platform.GetPlatformExtensionsForType(actionType);
   for (auto& extension : extensions) {
-    const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
+    if (auto metadata = FindMetadata(extension->GetAllActions(), actionType))
+      return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
+
+    for (const auto& it : extension->GetAllObjects()) {
+      if (auto metadata = FindMetadata(it.second.actionsInfos, actionType))
+        return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
     }
 
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
+    for (const auto& it : extension->GetAllBehaviors()) {
+      if (auto metadata = FindMetadata(it.second.actionsInfos, actionType))
+        return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
     }
   }
 
@@ -120,36 +114,29 @@ MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
-    const gd::Platform& platform, gd::String actionType) {
+    const gd::Platform& platform, const gd::String& actionType) {
   return GetExtensionAndActionMetadata(platform, actionType).GetMetadata();
 }
 
 ExtensionAndMetadata<InstructionMetadata>
-MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
-                                                   gd::String conditionType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+MetadataProvider::GetExtensionAndConditionMetadata(
+    const gd::Platform& platform, const gd::String& conditionType) {
+  auto& extensions = platform.GetPlatformExtensionsForType(conditionType);
   for (auto& extension : extensions) {
-    const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjetsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjetsConditions.find(conditionType) != allObjetsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjetsConditions.find(conditionType)->second);
+    if (auto metadata =
+            FindMetadata(extension->GetAllConditions(), conditionType))
+      return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
+
+    for (const auto& it : extension->GetAllObjects()) {
+      if (auto metadata =
+              FindMetadata(it.second.conditionsInfos, conditionType))
+        return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
     }
 
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
+    for (const auto& it : extension->GetAllBehaviors()) {
+      if (auto metadata =
+              FindMetadata(it.second.conditionsInfos, conditionType))
+        return ExtensionAndMetadata<InstructionMetadata>(*extension, *metadata);
     }
   }
 
@@ -158,33 +145,33 @@ MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
 }
 
 const gd::InstructionMetadata& MetadataProvider::GetConditionMetadata(
-    const gd::Platform& platform, gd::String conditionType) {
+    const gd::Platform& platform, const gd::String& conditionType) {
   return GetExtensionAndConditionMetadata(platform, conditionType)
       .GetMetadata();
 }
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectExpressionMetadata(
-    const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectExpressions =
-          extension->GetAllExpressionsForObject(objectType);
-      if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectExpressions.find(exprType)->second);
-    }
+    const gd::Platform& platform,
+    const gd::String& objectType,
+    const gd::String& exprType) {
+  for (auto& extension : platform.GetPlatformExtensionsForType(objectType)) {
+    auto objectMetadata = FindMetadata(extension->GetAllObjects(), objectType);
+    if (!objectMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(objectMetadata->expressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   // Then check base
-  for (auto& extension : extensions) {
-    const auto& allObjectExpressions =
-        extension->GetAllExpressionsForObject("");
-    if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectExpressions.find(exprType)->second);
+  for (auto& extension : platform.GetPlatformExtensionsForType("")) {
+    auto objectMetadata = FindMetadata(extension->GetAllObjects(), "");
+    if (!objectMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(objectMetadata->expressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -192,33 +179,36 @@ MetadataProvider::GetExtensionAndObjectExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectExpressionMetadata(
-    const gd::Platform& platform, gd::String objectType, gd::String exprType) {
+    const gd::Platform& platform,
+    const gd::String& objectType,
+    const gd::String& exprType) {
   return GetExtensionAndObjectExpressionMetadata(platform, objectType, exprType)
       .GetMetadata();
 }
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
-    const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allAutoExpressions =
-          extension->GetAllExpressionsForBehavior(autoType);
-      if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allAutoExpressions.find(exprType)->second);
-    }
+    const gd::Platform& platform,
+    const gd::String& autoType,
+    const gd::String& exprType) {
+  for (auto& extension : platform.GetPlatformExtensionsForType(autoType)) {
+    auto behaviorMetadata =
+        FindMetadata(extension->GetAllBehaviors(), autoType);
+    if (!behaviorMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(behaviorMetadata->expressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   // Then check base
-  for (auto& extension : extensions) {
-    const auto& allAutoExpressions =
-        extension->GetAllExpressionsForBehavior("");
-    if (allAutoExpressions.find(exprType) != allAutoExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allAutoExpressions.find(exprType)->second);
+  for (auto& extension : platform.GetPlatformExtensionsForType("")) {
+    auto behaviorMetadata = FindMetadata(extension->GetAllBehaviors(), "");
+    if (!behaviorMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(behaviorMetadata->expressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -226,20 +216,20 @@ MetadataProvider::GetExtensionAndBehaviorExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetBehaviorExpressionMetadata(
-    const gd::Platform& platform, gd::String autoType, gd::String exprType) {
+    const gd::Platform& platform,
+    const gd::String& autoType,
+    const gd::String& exprType) {
   return GetExtensionAndBehaviorExpressionMetadata(platform, autoType, exprType)
       .GetMetadata();
 }
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndExpressionMetadata(
-    const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+    const gd::Platform& platform, const gd::String& exprType) {
+  auto& extensions = platform.GetPlatformExtensionsForType(exprType);
   for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
+    if (auto metadata = FindMetadata(extension->GetAllExpressions(), exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -247,33 +237,32 @@ MetadataProvider::GetExtensionAndExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetExpressionMetadata(
-    const gd::Platform& platform, gd::String exprType) {
+    const gd::Platform& platform, const gd::String& exprType) {
   return GetExtensionAndExpressionMetadata(platform, exprType).GetMetadata();
 }
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
-    const gd::Platform& platform, gd::String objectType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
-      const auto& allObjectStrExpressions =
-          extension->GetAllStrExpressionsForObject(objectType);
-      if (allObjectStrExpressions.find(exprType) !=
-          allObjectStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allObjectStrExpressions.find(exprType)->second);
-    }
+    const gd::Platform& platform,
+    const gd::String& objectType,
+    const gd::String& exprType) {
+  for (auto& extension : platform.GetPlatformExtensionsForType(objectType)) {
+    auto objectMetadata = FindMetadata(extension->GetAllObjects(), objectType);
+    if (!objectMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(objectMetadata->strExpressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allObjectStrExpressions =
-        extension->GetAllStrExpressionsForObject("");
-    if (allObjectStrExpressions.find(exprType) != allObjectStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allObjectStrExpressions.find(exprType)->second);
+  for (auto& extension : platform.GetPlatformExtensionsForType("")) {
+    auto objectMetadata = FindMetadata(extension->GetAllObjects(), "");
+    if (!objectMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(objectMetadata->strExpressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -281,7 +270,9 @@ MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
-    const gd::Platform& platform, gd::String objectType, gd::String exprType) {
+    const gd::Platform& platform,
+    const gd::String& objectType,
+    const gd::String& exprType) {
   return GetExtensionAndObjectStrExpressionMetadata(
              platform, objectType, exprType)
       .GetMetadata();
@@ -289,28 +280,27 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectStrExpressionMetadata(
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
-    const gd::Platform& platform, gd::String autoType, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
-  for (auto& extension : extensions) {
-    const auto& autos = extension->GetBehaviorsTypes();
-    if (find(autos.begin(), autos.end(), autoType) != autos.end()) {
-      const auto& allBehaviorStrExpressions =
-          extension->GetAllStrExpressionsForBehavior(autoType);
-      if (allBehaviorStrExpressions.find(exprType) !=
-          allBehaviorStrExpressions.end())
-        return ExtensionAndMetadata<ExpressionMetadata>(
-            *extension, allBehaviorStrExpressions.find(exprType)->second);
-    }
+    const gd::Platform& platform,
+    const gd::String& autoType,
+    const gd::String& exprType) {
+  for (auto& extension : platform.GetPlatformExtensionsForType(autoType)) {
+    auto behaviorMetadata =
+        FindMetadata(extension->GetAllBehaviors(), autoType);
+    if (!behaviorMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(behaviorMetadata->strExpressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   // Then check in functions of "Base object".
-  for (auto& extension : extensions) {
-    const auto& allBehaviorStrExpressions =
-        extension->GetAllStrExpressionsForBehavior("");
-    if (allBehaviorStrExpressions.find(exprType) !=
-        allBehaviorStrExpressions.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allBehaviorStrExpressions.find(exprType)->second);
+  for (auto& extension : platform.GetPlatformExtensionsForType("")) {
+    auto behaviorMetadata = FindMetadata(extension->GetAllBehaviors(), "");
+    if (!behaviorMetadata) continue;
+
+    if (auto metadata =
+            FindMetadata(behaviorMetadata->strExpressionsInfos, exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -319,8 +309,8 @@ MetadataProvider::GetExtensionAndBehaviorStrExpressionMetadata(
 
 const gd::ExpressionMetadata&
 MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
-                                                   gd::String autoType,
-                                                   gd::String exprType) {
+                                                   const gd::String& autoType,
+                                                   const gd::String& exprType) {
   return GetExtensionAndBehaviorStrExpressionMetadata(
              platform, autoType, exprType)
       .GetMetadata();
@@ -328,13 +318,12 @@ MetadataProvider::GetBehaviorStrExpressionMetadata(const gd::Platform& platform,
 
 ExtensionAndMetadata<ExpressionMetadata>
 MetadataProvider::GetExtensionAndStrExpressionMetadata(
-    const gd::Platform& platform, gd::String exprType) {
-  auto& extensions = platform.GetAllPlatformExtensions();
+    const gd::Platform& platform, const gd::String& exprType) {
+  auto& extensions = platform.GetPlatformExtensionsForType(exprType);
   for (auto& extension : extensions) {
-    const auto& allExpr = extension->GetAllStrExpressions();
-    if (allExpr.find(exprType) != allExpr.end())
-      return ExtensionAndMetadata<ExpressionMetadata>(
-          *extension, allExpr.find(exprType)->second);
+    if (auto metadata =
+            FindMetadata(extension->GetAllStrExpressions(), exprType))
+      return ExtensionAndMetadata<ExpressionMetadata>(*extension, *metadata);
   }
 
   return ExtensionAndMetadata<ExpressionMetadata>(badExtension,
@@ -342,12 +331,12 @@ MetadataProvider::GetExtensionAndStrExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetStrExpressionMetadata(
-    const gd::Platform& platform, gd::String exprType) {
+    const gd::Platform& platform, const gd::String& exprType) {
   return GetExtensionAndStrExpressionMetadata(platform, exprType).GetMetadata();
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetAnyExpressionMetadata(
-    const gd::Platform& platform, gd::String exprType) {
+    const gd::Platform& platform, const gd::String& exprType) {
   const auto& numberExpressionMetadata =
       GetExpressionMetadata(platform, exprType);
   const auto& stringExpressionMetadata =
@@ -361,7 +350,9 @@ const gd::ExpressionMetadata& MetadataProvider::GetAnyExpressionMetadata(
 }
 
 const gd::ExpressionMetadata& MetadataProvider::GetObjectAnyExpressionMetadata(
-    const gd::Platform& platform, gd::String objectType, gd::String exprType) {
+    const gd::Platform& platform,
+    const gd::String& objectType,
+    const gd::String& exprType) {
   const auto& numberExpressionMetadata =
       GetObjectExpressionMetadata(platform, objectType, exprType);
   const auto& stringExpressionMetadata =
@@ -376,8 +367,8 @@ const gd::ExpressionMetadata& MetadataProvider::GetObjectAnyExpressionMetadata(
 
 const gd::ExpressionMetadata&
 MetadataProvider::GetBehaviorAnyExpressionMetadata(const gd::Platform& platform,
-                                                   gd::String autoType,
-                                                   gd::String exprType) {
+                                                   const gd::String& autoType,
+                                                   const gd::String& exprType) {
   const auto& numberExpressionMetadata =
       GetBehaviorExpressionMetadata(platform, autoType, exprType);
   const auto& stringExpressionMetadata =
@@ -64,19 +64,19 @@ class GD_CORE_API MetadataProvider {
    * Get the metadata about a behavior, and its associated extension.
    */
   static ExtensionAndMetadata<BehaviorMetadata> GetExtensionAndBehaviorMetadata(
-      const gd::Platform& platform, gd::String behaviorType);
+      const gd::Platform& platform, const gd::String& behaviorType);
 
   /**
    * Get the metadata about an object, and its associated extension.
    */
   static ExtensionAndMetadata<ObjectMetadata> GetExtensionAndObjectMetadata(
-      const gd::Platform& platform, gd::String type);
+      const gd::Platform& platform, const gd::String& type);
 
   /**
    * Get the metadata about an effect, and its associated extension.
    */
   static ExtensionAndMetadata<EffectMetadata> GetExtensionAndEffectMetadata(
-      const gd::Platform& platform, gd::String type);
+      const gd::Platform& platform, const gd::String& type);
 
   /**
    * Get the metadata of an action, and its associated extension.
@@ -84,7 +84,7 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<InstructionMetadata>
   GetExtensionAndActionMetadata(const gd::Platform& platform,
-                                gd::String actionType);
+                                const gd::String& actionType);
 
   /**
    * Get the metadata of a condition, and its associated extension.
@@ -92,7 +92,7 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<InstructionMetadata>
   GetExtensionAndConditionMetadata(const gd::Platform& platform,
-                                   gd::String conditionType);
+                                   const gd::String& conditionType);
 
   /**
    * Get information about an expression, and its associated extension.
@@ -100,7 +100,7 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndExpressionMetadata(const gd::Platform& platform,
-                                    gd::String exprType);
+                                    const gd::String& exprType);
 
   /**
    * Get information about an expression, and its associated extension.
@@ -108,8 +108,8 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndObjectExpressionMetadata(const gd::Platform& platform,
-                                          gd::String objectType,
-                                          gd::String exprType);
+                                          const gd::String& objectType,
+                                          const gd::String& exprType);
 
   /**
    * Get information about an expression, and its associated extension.
@@ -117,8 +117,8 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndBehaviorExpressionMetadata(const gd::Platform& platform,
-                                            gd::String autoType,
-                                            gd::String exprType);
+                                            const gd::String& autoType,
+                                            const gd::String& exprType);
 
   /**
    * Get information about a string expression, and its associated extension.
@@ -126,7 +126,7 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndStrExpressionMetadata(const gd::Platform& platform,
-                                       gd::String exprType);
+                                       const gd::String& exprType);
 
   /**
    * Get information about a string expression, and its associated extension.
@@ -134,8 +134,8 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndObjectStrExpressionMetadata(const gd::Platform& platform,
-                                             gd::String objectType,
-                                             gd::String exprType);
+                                             const gd::String& objectType,
+                                             const gd::String& exprType);
 
   /**
    * Get information about a string expression, and its associated extension.
@@ -143,103 +143,115 @@ class GD_CORE_API MetadataProvider {
    */
   static ExtensionAndMetadata<ExpressionMetadata>
   GetExtensionAndBehaviorStrExpressionMetadata(const gd::Platform& platform,
-                                               gd::String autoType,
-                                               gd::String exprType);
+                                               const gd::String& autoType,
+                                               const gd::String& exprType);
 
   /**
    * Get the metadata about a behavior.
    */
   static const BehaviorMetadata& GetBehaviorMetadata(
-      const gd::Platform& platform, gd::String behaviorType);
+      const gd::Platform& platform, const gd::String& behaviorType);
 
   /**
    * Get the metadata about an object.
    */
   static const ObjectMetadata& GetObjectMetadata(const gd::Platform& platform,
-                                                 gd::String type);
+                                                 const gd::String& type);
 
   /**
    * Get the metadata about an effect.
    */
   static const EffectMetadata& GetEffectMetadata(const gd::Platform& platform,
-                                                 gd::String type);
+                                                 const gd::String& type);
 
   /**
    * Get the metadata of an action.
    * Works for object, behaviors and static actions.
    */
   static const gd::InstructionMetadata& GetActionMetadata(
-      const gd::Platform& platform, gd::String actionType);
+      const gd::Platform& platform, const gd::String& actionType);
 
   /**
    * Get the metadata of a condition.
    * Works for object, behaviors and static conditions.
    */
   static const gd::InstructionMetadata& GetConditionMetadata(
-      const gd::Platform& platform, gd::String conditionType);
+      const gd::Platform& platform, const gd::String& conditionType);
 
   /**
    * Get information about an expression from its type
    * Works for free expressions.
    */
   static const gd::ExpressionMetadata& GetExpressionMetadata(
-      const gd::Platform& platform, gd::String exprType);
+      const gd::Platform& platform, const gd::String& exprType);
 
   /**
    * Get information about an expression from its type
    * Works for object expressions.
    */
   static const gd::ExpressionMetadata& GetObjectExpressionMetadata(
-      const gd::Platform& platform, gd::String objectType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& objectType,
+      const gd::String& exprType);
 
   /**
    * Get information about an expression from its type
    * Works for behavior expressions.
    */
   static const gd::ExpressionMetadata& GetBehaviorExpressionMetadata(
-      const gd::Platform& platform, gd::String autoType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& autoType,
+      const gd::String& exprType);
 
   /**
    * Get information about a string expression from its type
    * Works for free expressions.
    */
   static const gd::ExpressionMetadata& GetStrExpressionMetadata(
-      const gd::Platform& platform, gd::String exprType);
+      const gd::Platform& platform, const gd::String& exprType);
 
   /**
    * Get information about a string expression from its type
    * Works for object expressions.
    */
   static const gd::ExpressionMetadata& GetObjectStrExpressionMetadata(
-      const gd::Platform& platform, gd::String objectType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& objectType,
+      const gd::String& exprType);
 
   /**
    * Get information about a string expression from its type
    * Works for behavior expressions.
    */
   static const gd::ExpressionMetadata& GetBehaviorStrExpressionMetadata(
-      const gd::Platform& platform, gd::String autoType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& autoType,
+      const gd::String& exprType);
 
   /**
    * Get information about an expression from its type.
    * Works for free expressions.
    */
   static const gd::ExpressionMetadata& GetAnyExpressionMetadata(
-      const gd::Platform& platform, gd::String exprType);
+      const gd::Platform& platform, const gd::String& exprType);
 
   /**
    * Get information about an expression from its type.
    * Works for object expressions.
    */
   static const gd::ExpressionMetadata& GetObjectAnyExpressionMetadata(
-      const gd::Platform& platform, gd::String objectType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& objectType,
+      const gd::String& exprType);
 
   /**
    * Get information about an expression from its type.
    * Works for behavior expressions.
    */
   static const gd::ExpressionMetadata& GetBehaviorAnyExpressionMetadata(
-      const gd::Platform& platform, gd::String autoType, gd::String exprType);
+      const gd::Platform& platform,
+      const gd::String& autoType,
+      const gd::String& exprType);
 
   static bool IsBadExpressionMetadata(const gd::ExpressionMetadata& metadata) {
     return &metadata == &badExpressionMetadata;
@@ -10,14 +10,26 @@
 
 namespace gd {
 
+const gd::String ParameterMetadata::noString;
+
 ParameterMetadata::ParameterMetadata() : optional(false), codeOnly(false) {}
 
+ParameterMetadata::EditorInformation &
+ParameterMetadata::GetEditorInformation() {
+  if (!editorInformation)
+    editorInformation = std::make_shared<EditorInformation>();
+  else if (editorInformation.use_count() > 1)
+    editorInformation = std::make_shared<EditorInformation>(*editorInformation);
+
+  return *editorInformation;
+}
+
 void ParameterMetadata::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("type", type);
   element.SetAttribute("supplementaryInformation", supplementaryInformation);
   element.SetAttribute("optional", optional);
-  element.SetAttribute("description", description);
-  element.SetAttribute("longDescription", longDescription);
+  element.SetAttribute("description", GetDescription());
+  element.SetAttribute("longDescription", GetLongDescription());
   element.SetAttribute("codeOnly", codeOnly);
   element.SetAttribute("defaultValue", defaultValue);
   element.SetAttribute("name", name);
@@ -28,8 +40,9 @@ void ParameterMetadata::UnserializeFrom(const SerializerElement& element) {
   supplementaryInformation =
       element.GetStringAttribute("supplementaryInformation");
   optional = element.GetBoolAttribute("optional");
-  description = element.GetStringAttribute("description");
-  longDescription = element.GetStringAttribute("longDescription");
+  editorInformation.reset();
+  SetDescription(element.GetStringAttribute("description"));
+  SetLongDescription(element.GetStringAttribute("longDescription"));
   codeOnly = element.GetBoolAttribute("codeOnly");
   defaultValue = element.GetStringAttribute("defaultValue");
   name = element.GetStringAttribute("name");
@@ -99,13 +99,16 @@ class GD_CORE_API ParameterMetadata {
   /**
    * \brief Return the description of the parameter
    */
-  const gd::String &GetDescription() const { return description; }
+  const gd::String &GetDescription() const {
+    return editorInformation ? editorInformation->description : noString;
+  }
 
   /**
    * \brief Set the description of the parameter.
    */
   ParameterMetadata &SetDescription(const gd::String &description_) {
-    description = description_;
+    if (editorInformation || !description_.empty())
+      GetEditorInformation().description = description_;
     return *this;
   }
 
@@ -140,13 +143,16 @@ class GD_CORE_API ParameterMetadata {
   /**
    * \brief Get the user friendly, long description for the parameter.
    */
-  const gd::String &GetLongDescription() const { return longDescription; }
+  const gd::String &GetLongDescription() const {
+    return editorInformation ? editorInformation->longDescription : noString;
+  }
 
   /**
    * \brief Set the user friendly, long description for the parameter.
    */
   ParameterMetadata &SetLongDescription(const gd::String &longDescription_) {
-    longDescription = longDescription_;
+    if (editorInformation || !longDescription_.empty())
+      GetEditorInformation().longDescription = longDescription_;
     return *this;
   }
 
@@ -222,15 +228,34 @@ class GD_CORE_API ParameterMetadata {
   gd::String supplementaryInformation;  ///< Used if needed
   bool optional;                        ///< True if the parameter is optional
 
-  gd::String description;  ///< Description shown in editor
   bool codeOnly;  ///< True if parameter is relative to code generation only,
                   ///< i.e. must not be shown in editor
  private:
-  gd::String longDescription;  ///< Long description shown in the editor.
+  /**
+   * \brief The information about the parameter only used by the editor.
+   *
+   * Stored apart from the information used by code generation, and shared
+   * between copies of the metadata until one of them is modified.
+   */
+  struct EditorInformation {
+    gd::String description;      ///< Description shown in editor
+    gd::String longDescription;  ///< Long description shown in the editor.
+  };
+
+  /**
+   * \brief Return the editor information of the parameter, so that it can be
+   * modified (creating it or copying it if it's shared).
+   */
+  EditorInformation &GetEditorInformation();
+
   gd::String defaultValue;     ///< Used as a default value in editor or if an
                                ///< optional parameter is empty.
   gd::String name;             ///< The name of the parameter to be used in code
                                ///< generation. Optional.
+  std::shared_ptr<EditorInformation>
+      editorInformation;  ///< Null if there is no description.
+
+  static const gd::String noString;
 };
 
 }  // namespace gd
@@ -4,6 +4,12 @@
  * reserved. This project is released under the MIT License.
  */
 #include "Platform.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/String.h"
@@ -14,7 +20,16 @@ using namespace std;
 
 namespace gd {
 
-Platform::Platform(): enableExtensionLoadingLogs(false) {}
+namespace {
+template <class T>
+void InsertKeys(const std::map<gd::String, T>& map,
+                std::unordered_set<gd::String>& keys) {
+  for (const auto& it : map) keys.insert(it.first);
+}
+}  // namespace
+
+Platform::Platform()
+    : hasLazyExtensions(false), enableExtensionLoadingLogs(false) {}
 
 Platform::~Platform() {}
 
@@ -28,28 +43,131 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   }
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
+  lazyExtensions.erase(
+      remove_if(lazyExtensions.begin(),
+                lazyExtensions.end(),
+                [&extension](const LazyExtension& lazyExtension) {
+                  return lazyExtension.name == extension->GetName();
+                }),
+      lazyExtensions.end());
   extensionsLoaded.push_back(extension);
+  AddUnprefixedTypes(*extension);
 
   // Load all creation/destruction functions for objects provided by the
   // extension
-  vector<gd::String> objectsTypes = extension->GetExtensionObjectsTypes();
-  for (std::size_t i = 0; i < objectsTypes.size(); ++i) {
-    creationFunctionTable[objectsTypes[i]] =
-        extension->GetObjectCreationFunctionPtr(objectsTypes[i]);
+  for (const auto& it : extension->GetAllObjects()) {
+    creationFunctionTable[it.first] = it.second.createFunPtr;
   }
 
   return true;
 }
 
+void Platform::AddUnprefixedTypes(gd::PlatformExtension& extension) {
+  if (!extension.GetNameSpace().empty()) return;
+
+  InsertKeys(extension.GetAllActions(), unprefixedTypes);
+  InsertKeys(extension.GetAllConditions(), unprefixedTypes);
+  InsertKeys(extension.GetAllExpressions(), unprefixedTypes);
+  InsertKeys(extension.GetAllStrExpressions(), unprefixedTypes);
+  InsertKeys(extension.GetAllObjects(), unprefixedTypes);
+  InsertKeys(extension.GetAllBehaviors(), unprefixedTypes);
+  InsertKeys(extension.GetAllEffects(), unprefixedTypes);
+  InsertKeys(extension.GetAllEvents(), unprefixedTypes);
+}
+
+void Platform::AddLazyExtension(
+    const gd::String& name,
+    const gd::String& typesPrefix,
+    std::function<std::shared_ptr<gd::PlatformExtension>()> declareExtension) {
+  if (IsExtensionLoaded(name)) RemoveExtension(name);
+
+  LazyExtension lazyExtension;
+  lazyExtension.name = name;
+  lazyExtension.typesPrefix = typesPrefix;
+  lazyExtension.declareExtension = std::move(declareExtension);
+  lazyExtensions.push_back(std::move(lazyExtension));
+  hasLazyExtensions = true;
+}
+
+void Platform::DeclareLazyExtension(std::size_t index) const {
+  LazyExtension lazyExtension = std::move(lazyExtensions[index]);
+  lazyExtensions.erase(lazyExtensions.begin() + index);
+
+  std::shared_ptr<gd::PlatformExtension> extension =
+      lazyExtension.declareExtension();
+  if (extension) {
+    if (extension->GetName() != lazyExtension.name ||
+        extension->GetNameSpace() != lazyExtension.typesPrefix) {
+      std::cout << "WARNING: Extension " << extension->GetName() << " ("
+                << extension->GetNameSpace() << ") was registered as "
+                << lazyExtension.name << " (" << lazyExtension.typesPrefix
+                << ")." << std::endl;
+    }
+
+    // Declaring an extension is not changing the extensions of the platform,
+    // it only makes them available.
+    const_cast<Platform*>(this)->AddExtension(extension);
+  }
+
+  // Only cleared once the extension is added, so that other threads don't
+  // read the extensions while they are changed.
+  hasLazyExtensions = !lazyExtensions.empty();
+}
+
+void Platform::DeclareLazyExtensions() const {
+  if (!hasLazyExtensions) return;
+
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::recursive_mutex> lock(lazyExtensionsMutex);
+#endif
+  while (!lazyExtensions.empty()) DeclareLazyExtension(0);
+}
+
+void Platform::DeclareLazyExtensionsForType(const gd::String& type) const {
+  if (!hasLazyExtensions) return;
+
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::recursive_mutex> lock(lazyExtensionsMutex);
+#endif
+
+  size_t separatorPosition =
+      type.find(PlatformExtension::GetNamespaceSeparator());
+  gd::String typesPrefix =
+      separatorPosition == gd::String::npos
+          ? ""
+          : type.substr(0,
+                        separatorPosition +
+                            PlatformExtension::GetNamespaceSeparator().size());
+
+  // Extensions without namespace can't be known to provide a type before
+  // being declared: they are declared until one provides it.
+  bool untilTypeIsProvided = typesPrefix.empty();
+  for (std::size_t i = 0; i < lazyExtensions.size();) {
+    if (untilTypeIsProvided && unprefixedTypes.count(type)) return;
+
+    if (lazyExtensions[i].typesPrefix == typesPrefix)
+      DeclareLazyExtension(i);
+    else
+      ++i;
+  }
+}
+
 void Platform::RemoveExtension(const gd::String& name) {
+  lazyExtensions.erase(
+      remove_if(lazyExtensions.begin(),
+                lazyExtensions.end(),
+                [&name](const LazyExtension& lazyExtension) {
+                  return lazyExtension.name == name;
+                }),
+      lazyExtensions.end());
+
   // Unload all creation/destruction functions for objects provided by the
   // extension
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     auto& extension = extensionsLoaded[i];
     if (extension->GetName() == name) {
-      vector<gd::String> objectsTypes = extension->GetExtensionObjectsTypes();
-      for (std::size_t i = 0; i < objectsTypes.size(); ++i) {
-        creationFunctionTable.erase(objectsTypes[i]);
+      for (const auto& it : extension->GetAllObjects()) {
+        creationFunctionTable.erase(it.first);
       }
     }
   }
@@ -61,18 +179,38 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+
+  // Types can be provided by several extensions: they are indexed again.
+  unprefixedTypes.clear();
+  for (auto& extension : extensionsLoaded) AddUnprefixedTypes(*extension);
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return true;
   }
+  for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+    if (lazyExtensions[i].name == name) return true;
+  }
 
   return false;
 }
 
 std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
     const gd::String& name) const {
+#if !defined(EMSCRIPTEN)
+  // Extensions can only be changed while some are not declared yet.
+  std::unique_lock<std::recursive_mutex> lock(lazyExtensionsMutex,
+                                              std::defer_lock);
+  if (hasLazyExtensions) lock.lock();
+#endif
+  for (std::size_t i = 0; i < lazyExtensions.size(); ++i) {
+    if (lazyExtensions[i].name == name) {
+      DeclareLazyExtension(i);
+      break;
+    }
+  }
+
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
@@ -82,19 +220,22 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
 
 std::unique_ptr<gd::Object> Platform::CreateObject(
     gd::String type, const gd::String& name) const {
-  if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
+  DeclareLazyExtensionsForType(type);
+  auto it = creationFunctionTable.find(type);
+  if (it == creationFunctionTable.end()) {
     std::cout << "Tried to create an object with an unknown type: " << type
               << " for platform " << GetName() << "!" << std::endl;
     type = "";
-    if (creationFunctionTable.find("") == creationFunctionTable.end()) {
+    DeclareLazyExtensionsForType(type);
+    it = creationFunctionTable.find(type);
+    if (it == creationFunctionTable.end()) {
       std::cout << "Unable to create a Base object!" << std::endl;
       return nullptr;
     }
   }
 
   // Create a new object with the type we want.
-  std::unique_ptr<gd::Object> object =
-      (creationFunctionTable.find(type)->second)(name);
+  std::unique_ptr<gd::Object> object = (it->second)(name);
   object->SetType(type);
 
   return std::unique_ptr<gd::Object>(std::move(object));
@@ -103,6 +244,7 @@ std::unique_ptr<gd::Object> Platform::CreateObject(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
+  DeclareLazyExtensionsForType(eventType);
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     std::shared_ptr<gd::BaseEvent> event =
         extensionsLoaded[i]->CreateEvent(eventType);
@@ -6,8 +6,15 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
+#if !defined(EMSCRIPTEN)
+#include <mutex>
+#endif
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -96,8 +103,44 @@ class GD_CORE_API Platform {
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension to the platform without declaring it: only its
+   * name and the prefix of its types are registered.
+   *
+   * \a declareExtension is called to create the extension the first time
+   * something is asked to it (by the platform or by gd::MetadataProvider).
+   *
+   * \param name The name of the extension.
+   * \param typesPrefix The namespace of the extension ("MyExtension::"), or
+   * an empty string for the builtin extensions not having a namespace. These
+   * ones are declared one by one, in the order they were added, until one
+   * provides the type asked for.
+   * \param declareExtension The function creating the extension.
+   *
+   * \note Extensions are declared under a lock, but extensions declared by a
+   * thread can change the vectors returned to other threads: call
+   * DeclareLazyExtensions before using the platform from several threads.
+   */
+  void AddLazyExtension(
+      const gd::String& name,
+      const gd::String& typesPrefix,
+      std::function<std::shared_ptr<PlatformExtension>()> declareExtension);
+
+  /**
+   * \brief Declare all the extensions added with AddLazyExtension and not
+   * declared yet.
+   */
+  void DeclareLazyExtensions() const;
+
+  /**
+   * \brief Return the number of extensions added with AddLazyExtension and
+   * not declared yet.
+   */
+  std::size_t GetLazyExtensionsCount() const { return lazyExtensions.size(); }
+
   /**
    * \brief Return true if an extension with the specified name is loaded
+   * (declared or not).
    */
   bool IsExtensionLoaded(const gd::String& name) const;
 
@@ -109,10 +152,28 @@ class GD_CORE_API Platform {
 
   /**
    * \brief Get all extensions loaded for the platform.
+   * \note Extensions not declared yet are declared.
    * @return Vector of Shared pointer containing all extensions
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    DeclareLazyExtensions();
+    return extensionsLoaded;
+  };
+
+  /**
+   * \brief Get the extensions loaded for the platform that can provide
+   * something (object, behavior, instruction, expression, event...) of the
+   * given type.
+   *
+   * Only the extensions not declared yet having the prefix of the type are
+   * declared. For a type without namespace, the extensions without namespace
+   * are declared until one provides the type (all of them if the type is
+   * unknown). The returned vector can contain other extensions.
+   */
+  const std::vector<std::shared_ptr<gd::PlatformExtension>>&
+  GetPlatformExtensionsForType(const gd::String& type) const {
+    DeclareLazyExtensionsForType(type);
     return extensionsLoaded;
   };
 
@@ -167,9 +228,45 @@ class GD_CORE_API Platform {
 #endif
 
  private:
+  struct LazyExtension {
+    gd::String name;
+    gd::String typesPrefix;
+    std::function<std::shared_ptr<PlatformExtension>()> declareExtension;
+  };
+
+  /**
+   * \brief Declare the lazy extension at the given position, and add it to
+   * the loaded extensions.
+   */
+  void DeclareLazyExtension(std::size_t index) const;
+
+  /**
+   * \brief Declare the lazy extensions that can provide the given type.
+   */
+  void DeclareLazyExtensionsForType(const gd::String& type) const;
+
+  /**
+   * \brief Add the types provided by the extension to unprefixedTypes, if
+   * the extension has no namespace.
+   */
+  void AddUnprefixedTypes(gd::PlatformExtension& extension);
+
   std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
-  std::map<gd::String, CreateFunPtr>
+  mutable std::vector<LazyExtension>
+      lazyExtensions;  ///< Extensions of the platform not declared yet
+  std::unordered_set<gd::String>
+      unprefixedTypes;  ///< Types (instructions, expressions, objects...)
+                        ///< provided by the declared extensions without
+                        ///< namespace.
+  mutable std::atomic<bool>
+      hasLazyExtensions;  ///< False once all the extensions are declared.
+#if !defined(EMSCRIPTEN)
+  mutable std::recursive_mutex
+      lazyExtensionsMutex;  ///< Recursive as declaring an extension can ask
+                            ///< for other extensions.
+#endif
+  std::unordered_map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   bool enableExtensionLoadingLogs;
 };
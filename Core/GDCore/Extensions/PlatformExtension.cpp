@@ -296,6 +296,21 @@ PlatformExtension& PlatformExtension::SetExtensionInformation(
   return *this;
 }
 
+const std::map<gd::String, gd::ObjectMetadata>&
+PlatformExtension::GetAllObjects() const {
+  return objectsInfos;
+}
+
+const std::map<gd::String, gd::BehaviorMetadata>&
+PlatformExtension::GetAllBehaviors() const {
+  return behaviorsInfo;
+}
+
+const std::map<gd::String, gd::EffectMetadata>&
+PlatformExtension::GetAllEffects() const {
+  return effectsMetadata;
+}
+
 std::vector<gd::String> PlatformExtension::GetExtensionObjectsTypes() const {
   std::vector<gd::String> objects;
 
@@ -449,65 +464,65 @@ std::map<gd::String, gd::EventMetadata>& PlatformExtension::GetAllEvents() {
   return eventsInfos;
 }
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllActionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.actionsInfos;
+PlatformExtension::GetAllActionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.actionsInfos;
 
   return badActionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllConditionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.conditionsInfos;
+PlatformExtension::GetAllConditionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.conditionsInfos;
 
   return badConditionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllExpressionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.expressionsInfos;
+PlatformExtension::GetAllExpressionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.expressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllStrExpressionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.strExpressionsInfos;
+PlatformExtension::GetAllStrExpressionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.strExpressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllActionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.actionsInfos;
+PlatformExtension::GetAllActionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.actionsInfos;
 
   return badActionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllConditionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.conditionsInfos;
+PlatformExtension::GetAllConditionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.conditionsInfos;
 
   return badConditionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllExpressionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.expressionsInfos;
+PlatformExtension::GetAllExpressionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.expressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllStrExpressionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.strExpressionsInfos;
+PlatformExtension::GetAllStrExpressionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.strExpressionsInfos;
 
   return badExpressionsMetadata;
 }
@@ -601,6 +616,14 @@ std::vector<gd::String> PlatformExtension::GetBuiltinExtensionsNames() {
   return builtinExtensions;
 }
 
+gd::String PlatformExtension::GetNameWithoutNamespace(const gd::String& name) {
+  const gd::String separator = GetNamespaceSeparator();
+  std::size_t separatorPosition = name.rfind(separator);
+  if (separatorPosition == gd::String::npos) return name;
+
+  return name.substr(separatorPosition + separator.size());
+}
+
 bool PlatformExtension::IsBuiltin() const {
   std::vector<gd::String> builtinExtensions = GetBuiltinExtensionsNames();
   return std::find(builtinExtensions.begin(), builtinExtensions.end(), name) !=
@@ -387,6 +387,8 @@ class GD_CORE_API PlatformExtension {
   /**
    * \brief Return a vector containing all the object types provided by the
    * extension
+   * \see gd::PlatformExtension::GetAllObjects to iterate on the objects
+   * without copying their types.
    */
   std::vector<gd::String> GetExtensionObjectsTypes() const;
 
@@ -396,6 +398,18 @@ class GD_CORE_API PlatformExtension {
    */
   std::vector<gd::String> GetBehaviorsTypes() const;
 
+  /**
+   * \brief Return a reference to a map containing the types of the objects
+   * provided by the extension (as keys) and their metadata (as values).
+   */
+  const std::map<gd::String, gd::ObjectMetadata>& GetAllObjects() const;
+
+  /**
+   * \brief Return a reference to a map containing the types of the behaviors
+   * provided by the extension (as keys) and their metadata (as values).
+   */
+  const std::map<gd::String, gd::BehaviorMetadata>& GetAllBehaviors() const;
+
   /**
    * \brief Return a function to create the object if the type is handled by the
    * extension
@@ -408,6 +422,12 @@ class GD_CORE_API PlatformExtension {
    */
   std::vector<gd::String> GetExtensionEffectTypes() const;
 
+  /**
+   * \brief Return a reference to a map containing the types of the effects
+   * provided by the extension (as keys) and their metadata (as values).
+   */
+  const std::map<gd::String, gd::EffectMetadata>& GetAllEffects() const;
+
   /**
    * \brief Create a custom event.
    *
@@ -485,49 +505,49 @@ class GD_CORE_API PlatformExtension {
    * related to the object type, and the metadata associated with.
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllActionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllConditionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllExpressionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllStrExpressionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllActionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllConditionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllExpressionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllStrExpressionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \brief Get all the properties of the extension. Properties
@@ -552,6 +572,12 @@ class GD_CORE_API PlatformExtension {
    */
   static gd::String GetNamespaceSeparator() { return "::"; }
 
+  /**
+   * \brief Return the given name without the namespace (the extension name
+   * and the namespace separator), if any.
+   */
+  static gd::String GetNameWithoutNamespace(const gd::String& name);
+
  private:
   /**
    * Set the namespace (the string all actions/conditions/expressions start
@@ -7,11 +7,29 @@
 #include "AbstractFileSystem.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MappedFile.h"
 
 namespace gd {
 
 AbstractFileSystem::~AbstractFileSystem() {}
 
+bool AbstractFileSystem::IsFileCopyUpToDate(const gd::String& file,
+                                            const gd::String& destination) {
+  return false;
+}
+
+bool AbstractFileSystem::LinkFile(const gd::String& file,
+                                  const gd::String& destination) {
+  return false;
+}
+
+bool AbstractFileSystem::SupportsConcurrentCopies() { return false; }
+
+std::shared_ptr<gd::MappedFile> AbstractFileSystem::MapFile(
+    const gd::String& file, bool writable) {
+  return nullptr;
+}
+
 // TODO: Use const ref to filename to avoid copy
 gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   // Convert all backslash to slashs.
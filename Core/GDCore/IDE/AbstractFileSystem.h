@@ -6,11 +6,16 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <memory>
 #include <vector>
 #include "GDCore/String.h"
 
 #undef CopyFile  // Remove a Windows macro
 
+namespace gd {
+class MappedFile;
+}
+
 namespace gd {
 
 /**
@@ -100,6 +105,32 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool CopyFile(const gd::String& file,
                         const gd::String& destination) = 0;
 
+  /**
+   * \brief Check if a file was already copied to the destination and has not
+   * changed since (for example, same size and exactly the same modification
+   * time, preserved by CopyFile, or same content hash), so that copying it
+   * again can be skipped. A newer destination must not be considered up to
+   * date, as it can be a different file.
+   *
+   * The default implementation returns false: files are always copied.
+   */
+  virtual bool IsFileCopyUpToDate(const gd::String& file,
+                                  const gd::String& destination);
+
+  /**
+   * \brief Create the destination as a link (hard link or reflink) to the
+   * file, instead of copying it.
+   * \return false if the file could not be linked (for example, if links are
+   * not supported by the file system): it must then be copied.
+   */
+  virtual bool LinkFile(const gd::String& file, const gd::String& destination);
+
+  /**
+   * \brief Return true if CopyFile, LinkFile and IsFileCopyUpToDate can be
+   * called concurrently from different threads. Default is false.
+   */
+  virtual bool SupportsConcurrentCopies();
+
   /**
    * \brief Write the content of a string to a file.
    * \return true if the operation succeeded.
@@ -113,6 +144,19 @@ class GD_CORE_API AbstractFileSystem {
    */
   virtual gd::String ReadFile(const gd::String& file) = 0;
 
+  /**
+   * \brief Map the content of a file in memory, to read it without copies.
+   *
+   * By default, files are not mapped and ReadFile must be used instead.
+   *
+   * \param file The file to map.
+   * \param writable If true, the mapping must be private (see
+   * gd::MappedFile::Open).
+   * \return The mapped file, or nullptr if the file can't be mapped.
+   */
+  virtual std::shared_ptr<gd::MappedFile> MapFile(const gd::String& file,
+                                                  bool writable);
+
   /**
    * \brief Return a vector containing the files in the specified path
    *
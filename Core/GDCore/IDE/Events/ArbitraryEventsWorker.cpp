@@ -73,4 +73,7 @@ bool ArbitraryEventsWorker::VisitInstruction(gd::Instruction& instruction,
 
 ArbitraryEventsWorkerWithContext::~ArbitraryEventsWorkerWithContext() {}
 
+ClonableArbitraryEventsWorkerWithContext::
+    ~ClonableArbitraryEventsWorkerWithContext() {}
+
 }  // namespace gd
@@ -121,6 +121,40 @@ class GD_CORE_API ArbitraryEventsWorkerWithContext
   const gd::ObjectsContainer* currentObjectsContainer;
 };
 
+/**
+ * \brief An events worker with context that can be cloned, so that
+ * independent events lists can be browsed concurrently.
+ *
+ * A clone is launched on each events list (possibly from different threads)
+ * and the results of the clones are then merged back, in the order of the
+ * events lists, into the original worker.
+ *
+ * \warning Only use this for workers that don't modify the events, nor
+ * anything that is shared between the events lists.
+ *
+ * \see gd::WholeProjectRefactorer::ExposeProjectEventsInParallel
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ClonableArbitraryEventsWorkerWithContext
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  ClonableArbitraryEventsWorkerWithContext(){};
+  virtual ~ClonableArbitraryEventsWorkerWithContext();
+
+  /**
+   * \brief Create a new worker, with the same parameters as this one but
+   * without any result.
+   */
+  virtual std::unique_ptr<ClonableArbitraryEventsWorkerWithContext> Clone()
+      const = 0;
+
+  /**
+   * \brief Merge the results of a worker created with Clone into this one.
+   */
+  virtual void Reduce(ClonableArbitraryEventsWorkerWithContext& clone) = 0;
+};
+
 }  // namespace gd
 
 #endif  // GDCORE_ARBITRARYEVENTSWORKER_H
@@ -130,7 +130,10 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                        gd::Expression(newBehaviorName));
             }
           }
-        } else {
+        } else if (instruction.GetParameter(parameterIndex)
+                       .Contains(oldBehaviorName)) {
+          // The behavior can only be used by expressions containing its name:
+          // others are not parsed.
           gd::ExpressionParser2 parser(
               platform, GetGlobalObjectsContainer(), GetObjectsContainer());
           auto node =
@@ -20,6 +20,7 @@
 #include "GDCore/IDE/Events/ExpressionValidator.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
+#include "GDCore/Tools/ParallelFor.h"
 
 using namespace std;
 
@@ -198,6 +199,10 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
     const gd::InstructionMetadata& instrInfos =
         MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+      // The object can only be used by parameters containing its name:
+      // avoid parsing the others.
+      if (!actions[aId].GetParameter(pNb).Contains(oldName)) continue;
+
       // Replace object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].type) &&
           actions[aId].GetParameter(pNb).GetPlainString() == oldName)
@@ -256,6 +261,10 @@ bool EventsRefactorer::RenameObjectInConditions(
         MetadataProvider::GetConditionMetadata(platform,
                                                conditions[cId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+      // The object can only be used by parameters containing its name:
+      // avoid parsing the others.
+      if (!conditions[cId].GetParameter(pNb).Contains(oldName)) continue;
+
       // Replace object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].type) &&
           conditions[cId].GetParameter(pNb).GetPlainString() == oldName)
@@ -309,6 +318,7 @@ bool EventsRefactorer::RenameObjectInEventParameters(
     gd::String oldName,
     gd::String newName) {
   bool somethingModified = false;
+  if (!expression.Contains(oldName)) return somethingModified;
 
   if (gd::ParameterMetadata::IsObject(parameterMetadata.GetType()) &&
       expression.GetPlainString() == oldName)
@@ -396,6 +406,10 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
     const gd::InstructionMetadata& instrInfos =
         MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+      // The object can only be used by parameters containing its name:
+      // avoid parsing the others.
+      if (!actions[aId].GetParameter(pNb).Contains(name)) continue;
+
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].type) &&
           actions[aId].GetParameter(pNb).GetPlainString() == name) {
@@ -460,6 +474,10 @@ bool EventsRefactorer::RemoveObjectInConditions(
         MetadataProvider::GetConditionMetadata(platform,
                                                conditions[cId].GetType());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
+      // The object can only be used by parameters containing its name:
+      // avoid parsing the others.
+      if (!conditions[cId].GetParameter(pNb).Contains(name)) continue;
+
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].type) &&
           conditions[cId].GetParameter(pNb).GetPlainString() == name) {
@@ -688,76 +706,106 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     bool inEventSentences) {
   vector<EventsSearchResult> results;
 
-  const gd::String& ignored_characters = EventsRefactorer::searchIgnoredCharacters;
-
-  search.replace_if(search.begin(),
-                    search.end(),
-                    [ignored_characters](const char &c) {
-                      return ignored_characters.find(c) != gd::String::npos;
-                    },
-                    "");
+  NormalizeSearchedText(search);
   search = search.LeftTrim().RightTrim();
-  search.RemoveConsecutiveOccurrences(search.begin(), search.end(), ' ');
 
-  for (std::size_t i = 0; i < events.size(); ++i) {
-    bool eventAddedInResults = false;
+  // Ensure the sentence formatter is created and the extensions are declared
+  // before starting threads.
+  if (inEventSentences) gd::InstructionSentenceFormatter::Get();
+  platform.DeclareLazyExtensions();
+
+  // Results of each top-level event are computed separately (possibly
+  // concurrently), then gathered in the order of the events.
+  vector<vector<EventsSearchResult>> resultsPerEvent(events.size());
+  gd::ParallelFor::Run(events.size(), [&](std::size_t i) {
+    SearchInEvent(platform,
+                  events,
+                  i,
+                  search,
+                  matchCase,
+                  inConditions,
+                  inActions,
+                  inEventStrings,
+                  inEventSentences,
+                  resultsPerEvent[i]);
+  });
+
+  for (auto& eventResults : resultsPerEvent) {
+    std::copy(eventResults.begin(),
+              eventResults.end(),
+              std::back_inserter(results));
+  }
 
-    if (inConditions) {
-      vector<gd::InstructionsList*> conditionsVectors =
-          events[i].GetAllConditionsVectors();
-      for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
-        if (!eventAddedInResults &&
-            SearchStringInConditions(
-                platform, *conditionsVectors[j], search, matchCase, inEventSentences)) {
-          results.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-        }
-      }
-    }
+  return results;
+}
 
-    if (inActions) {
-      vector<gd::InstructionsList*> actionsVectors =
-          events[i].GetAllActionsVectors();
-      for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
-        if (!eventAddedInResults &&
-            SearchStringInActions(
-                platform, *actionsVectors[j], search, matchCase, inEventSentences)) {
-          results.push_back(EventsSearchResult(
-              std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
-              &events,
-              i));
-        }
+void EventsRefactorer::SearchInEvent(const gd::Platform& platform,
+                                     gd::EventsList& events,
+                                     std::size_t positionInList,
+                                     const gd::String& search,
+                                     bool matchCase,
+                                     bool inConditions,
+                                     bool inActions,
+                                     bool inEventStrings,
+                                     bool inEventSentences,
+                                     vector<EventsSearchResult>& results) {
+  bool eventAddedInResults = false;
+
+  if (inConditions) {
+    vector<gd::InstructionsList*> conditionsVectors =
+        events[positionInList].GetAllConditionsVectors();
+    for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
+      if (!eventAddedInResults &&
+          SearchStringInConditions(
+              platform, *conditionsVectors[j], search, matchCase, inEventSentences)) {
+        results.push_back(EventsSearchResult(
+            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(positionInList)),
+            &events,
+            positionInList));
       }
     }
+  }
 
-    if (inEventStrings) {
+  if (inActions) {
+    vector<gd::InstructionsList*> actionsVectors =
+        events[positionInList].GetAllActionsVectors();
+    for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
       if (!eventAddedInResults &&
-          SearchStringInEvent(events[i], search, matchCase)) {
+          SearchStringInActions(
+              platform, *actionsVectors[j], search, matchCase, inEventSentences)) {
         results.push_back(EventsSearchResult(
-            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
+            std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(positionInList)),
             &events,
-            i));
+            positionInList));
       }
     }
+  }
 
-    if (events[i].CanHaveSubEvents()) {
-      vector<EventsSearchResult> subResults =
-          SearchInEvents(platform,
-                         events[i].GetSubEvents(),
-                         search,
-                         matchCase,
-                         inConditions,
-                         inActions,
-                         inEventStrings,
-                         inEventSentences);
-      std::copy(
-          subResults.begin(), subResults.end(), std::back_inserter(results));
+  if (inEventStrings) {
+    if (!eventAddedInResults &&
+        SearchStringInEvent(events[positionInList], search, matchCase)) {
+      results.push_back(EventsSearchResult(
+          std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(positionInList)),
+          &events,
+          positionInList));
     }
   }
 
-  return results;
+  if (events[positionInList].CanHaveSubEvents()) {
+    gd::EventsList& subEvents = events[positionInList].GetSubEvents();
+    for (std::size_t i = 0; i < subEvents.size(); ++i) {
+      SearchInEvent(platform,
+                    subEvents,
+                    i,
+                    search,
+                    matchCase,
+                    inConditions,
+                    inActions,
+                    inEventStrings,
+                    inEventSentences,
+                    results);
+    }
+  }
 }
 
 bool EventsRefactorer::SearchStringInActions(
@@ -796,6 +844,18 @@ bool EventsRefactorer::SearchStringInActions(
   return false;
 }
 
+void EventsRefactorer::NormalizeSearchedText(gd::String& text) {
+  const gd::String& ignored_characters = EventsRefactorer::searchIgnoredCharacters;
+
+  text.replace_if(text.begin(),
+                  text.end(),
+                  [ignored_characters](const char &c) {
+                    return ignored_characters.find(c) != gd::String::npos;
+                  },
+                  "");
+  text.RemoveConsecutiveOccurrences(text.begin(), text.end(), ' ');
+}
+
 bool EventsRefactorer::SearchStringInFormattedText(
     const gd::Platform& platform,
     gd::Instruction& instruction,
@@ -808,18 +868,7 @@ bool EventsRefactorer::SearchStringInFormattedText(
                             : gd::MetadataProvider::GetActionMetadata(
                                   platform, instruction.GetType());
   gd::String completeSentence = gd::InstructionSentenceFormatter::Get()->GetFullText(instruction, metadata);
-
-  const gd::String& ignored_characters = EventsRefactorer::searchIgnoredCharacters;
-
-  completeSentence.replace_if(completeSentence.begin(),
-                              completeSentence.end(),
-                              [ignored_characters](const char &c) {
-                                return ignored_characters.find(c) != gd::String::npos;
-                              },
-                              "");
-
-  completeSentence.RemoveConsecutiveOccurrences(
-      completeSentence.begin(), completeSentence.end(), ' ');
+  NormalizeSearchedText(completeSentence);
 
   size_t foundPosition = matchCase
                              ? completeSentence.find(search)
@@ -95,6 +95,9 @@ class GD_CORE_API EventsRefactorer {
   /**
    * Search for a gd::String in events
    *
+   * Top-level events (with their sub-events) are searched concurrently when
+   * possible.
+   *
    * \return A vector containing EventsSearchResult objects filled with events
    * containing the string
    */
@@ -107,6 +110,12 @@ class GD_CORE_API EventsRefactorer {
                                                         bool inEventStrings,
                                                         bool inEventSentences);
 
+  /**
+   * Remove from a text the characters ignored by searches and the consecutive
+   * spaces, as done for the searched texts and the sentences of instructions.
+   */
+  static void NormalizeSearchedText(gd::String& text);
+
   /**
    * Replace all occurrences of a gd::String in events
    */
@@ -122,6 +131,21 @@ class GD_CORE_API EventsRefactorer {
   virtual ~EventsRefactorer(){};
 
  private:
+  /**
+   * Search for an already normalized gd::String in an event and its
+   * sub-events, adding them to \a results.
+   */
+  static void SearchInEvent(const gd::Platform& platform,
+                            gd::EventsList& events,
+                            std::size_t positionInList,
+                            const gd::String& search,
+                            bool matchCase,
+                            bool inConditions,
+                            bool inActions,
+                            bool inEventStrings,
+                            bool inEventSentences,
+                            std::vector<EventsSearchResult>& results);
+
   /**
    * Replace all occurrences of an object name by another name in an action
    * ( include : objects in parameters and in math/text expressions ).
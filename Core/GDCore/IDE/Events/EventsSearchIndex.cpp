@@ -0,0 +1,373 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/EventsRevision.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
+#include "GDCore/Tools/ParallelFor.h"
+
+namespace gd {
+
+namespace {
+/**
+ * \brief Append a text, followed by a null character, to \a texts and its case
+ * folded version to \a caseFoldedTexts.
+ */
+void AddText(const gd::String& text,
+             gd::String& texts,
+             gd::String& caseFoldedTexts) {
+  texts.Raw().append(text.Raw());
+  texts.Raw().push_back('\0');
+  caseFoldedTexts.Raw().append(text.CaseFold().Raw());
+  caseFoldedTexts.Raw().push_back('\0');
+}
+
+/**
+ * \brief Add the trigrams (of bytes) of the text to \a trigrams, skipping
+ * the ones overlapping two null-separated texts.
+ */
+void AddTrigrams(const gd::String& text, std::vector<std::uint32_t>& trigrams) {
+  const std::string& raw = text.Raw();
+  for (std::size_t i = 0; i + 2 < raw.size(); ++i) {
+    unsigned char a = raw[i], b = raw[i + 1], c = raw[i + 2];
+    if (a == 0 || b == 0 || c == 0) continue;
+
+    trigrams.push_back((std::uint32_t)a << 16 | (std::uint32_t)b << 8 | c);
+  }
+}
+
+bool ContainsText(const gd::String& texts, const gd::String& search) {
+  return !texts.empty() && texts.Raw().find(search.Raw()) != std::string::npos;
+}
+}  // namespace
+
+EventsSearchIndex::EventsSearchIndex(const gd::Platform& platform_)
+    : platform(platform_),
+      searchesCount(0),
+      lastSearchedEvents(NULL),
+      lastSearchRevision(0) {}
+
+std::vector<EventsSearchResult> EventsSearchIndex::Search(
+    gd::EventsList& events,
+    gd::String search,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences) {
+  EventsRefactorer::NormalizeSearchedText(search);
+  search = search.LeftTrim().RightTrim();
+  gd::String caseFoldedSearch = search.CaseFold();
+
+  // If no events were modified since the last search of these events, the
+  // events found by it are still valid: only the postings are queried.
+  if (&events != lastSearchedEvents ||
+      gd::EventsRevision::GetLast() != lastSearchRevision) {
+    // Compact before finding the events, as it changes the slots.
+    std::size_t emptySlotsCount = slots.size() - indexedEvents.size();
+    if (emptySlotsCount > 1000 && emptySlotsCount > indexedEvents.size())
+      Compact();
+
+    searchesCount++;
+    lastFoundEvents.clear();
+    std::vector<std::size_t> slotsToIndex;
+    FindEvents(events, lastFoundEvents, slotsToIndex);
+
+    if (!slotsToIndex.empty()) {
+      // Ensure the extensions are declared and the sentence formatter is
+      // created before starting threads.
+      platform.GetAllPlatformExtensions();
+      gd::InstructionSentenceFormatter::Get();
+
+      gd::ParallelFor::Run(slotsToIndex.size(), [&](std::size_t i) {
+        IndexEvent(slots[slotsToIndex[i]]);
+      });
+
+      // Slots to index are new slots, in increasing order: postings stay
+      // sorted.
+      for (std::size_t slot : slotsToIndex) {
+        for (std::uint32_t trigram : slots[slot].trigrams)
+          postings[trigram].push_back(slot);
+
+        std::vector<std::uint32_t>().swap(slots[slot].trigrams);
+      }
+    }
+
+    lastSearchedEvents = &events;
+    lastSearchRevision = gd::EventsRevision::GetLast();
+  }
+
+  // Trigrams are case folded, so that they can be used when matching the case
+  // too: the original texts are checked afterwards.
+  std::vector<std::size_t> candidates;
+  bool useCandidates = GetCandidateSlots(caseFoldedSearch, candidates);
+
+  std::vector<EventsSearchResult> results;
+  const gd::String& searchedText = matchCase ? search : caseFoldedSearch;
+  for (const FoundEvent& foundEvent : lastFoundEvents) {
+    if (useCandidates && !std::binary_search(candidates.begin(),
+                                             candidates.end(),
+                                             foundEvent.slot))
+      continue;
+
+    const IndexedEvent& indexedEvent = slots[foundEvent.slot];
+    for (const TextsGroup& group : indexedEvent.groups) {
+      if ((group.kind == TextsGroup::Conditions && !inConditions) ||
+          (group.kind == TextsGroup::Actions && !inActions) ||
+          (group.kind == TextsGroup::Strings && !inEventStrings))
+        continue;
+
+      // Like EventsRefactorer::SearchInEvents, an event is added once for
+      // each of its lists of instructions containing the text.
+      if (ContainsText(matchCase ? group.texts : group.caseFoldedTexts,
+                       searchedText) ||
+          (inEventSentences &&
+           ContainsText(matchCase ? group.sentences : group.caseFoldedSentences,
+                        searchedText))) {
+        results.push_back(EventsSearchResult(indexedEvent.event,
+                                             foundEvent.eventsList,
+                                             foundEvent.positionInList));
+      }
+    }
+  }
+
+  return results;
+}
+
+void EventsSearchIndex::FindEvents(gd::EventsList& events,
+                                   std::vector<FoundEvent>& foundEvents,
+                                   std::vector<std::size_t>& slotsToIndex) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    std::shared_ptr<gd::BaseEvent> event = events.GetEventSmartPtr(i);
+
+    auto it = indexedEvents.find(event.get());
+    std::size_t slot;
+    if (it != indexedEvents.end() && slots[it->second].event.lock() == event &&
+        IsUpToDate(slots[it->second], *event)) {
+      slot = it->second;
+    } else {
+      // The event is not indexed, was modified since it was indexed, or
+      // another (destroyed) event was indexed at the same address.
+      if (it != indexedEvents.end()) slots[it->second] = IndexedEvent();
+
+      slot = slots.size();
+      slots.emplace_back();
+      slots.back().event = event;
+      indexedEvents[event.get()] = slot;
+      slotsToIndex.push_back(slot);
+    }
+
+    slots[slot].lastSearch = searchesCount;
+    foundEvents.push_back(FoundEvent{slot, &events, i});
+
+    if (event->CanHaveSubEvents())
+      FindEvents(event->GetSubEvents(), foundEvents, slotsToIndex);
+  }
+}
+
+void EventsSearchIndex::IndexEvent(IndexedEvent& indexedEvent) const {
+  std::shared_ptr<gd::BaseEvent> event = indexedEvent.event.lock();
+  if (!event) return;
+
+  std::function<void(const gd::InstructionsList&, bool, TextsGroup&)>
+      addInstructionsTexts = [&](const gd::InstructionsList& instructions,
+                                 bool isCondition,
+                                 TextsGroup& group) {
+        for (std::size_t i = 0; i < instructions.size(); ++i) {
+          const gd::Instruction& instruction = instructions[i];
+          indexedEvent.instructionsRevisions.push_back(
+              InstructionRevision{&instruction, instruction.GetRevision()});
+
+          for (const gd::Expression& parameter : instruction.GetParameters())
+            AddText(parameter.GetPlainString(),
+                    group.texts,
+                    group.caseFoldedTexts);
+
+          const auto& metadata = isCondition
+                                     ? gd::MetadataProvider::GetConditionMetadata(
+                                           platform, instruction.GetType())
+                                     : gd::MetadataProvider::GetActionMetadata(
+                                           platform, instruction.GetType());
+          gd::String sentence =
+              gd::InstructionSentenceFormatter::Get()->GetFullText(instruction,
+                                                                   metadata);
+          EventsRefactorer::NormalizeSearchedText(sentence);
+          AddText(sentence, group.sentences, group.caseFoldedSentences);
+
+          if (!instruction.GetSubInstructions().empty())
+            addInstructionsTexts(
+                instruction.GetSubInstructions(), isCondition, group);
+        }
+      };
+
+  indexedEvent.revision = event->GetRevision();
+  indexedEvent.instructionsRevisions.clear();
+  indexedEvent.groups.clear();
+  for (const gd::InstructionsList* conditions :
+       event->GetAllConditionsVectors()) {
+    indexedEvent.groups.emplace_back();
+    indexedEvent.groups.back().kind = TextsGroup::Conditions;
+    addInstructionsTexts(*conditions, true, indexedEvent.groups.back());
+  }
+  for (const gd::InstructionsList* actions : event->GetAllActionsVectors()) {
+    indexedEvent.groups.emplace_back();
+    indexedEvent.groups.back().kind = TextsGroup::Actions;
+    addInstructionsTexts(*actions, false, indexedEvent.groups.back());
+  }
+  indexedEvent.groups.emplace_back();
+  TextsGroup& strings = indexedEvent.groups.back();
+  strings.kind = TextsGroup::Strings;
+  for (const gd::String& str : event->GetAllSearchableStrings())
+    AddText(str, strings.texts, strings.caseFoldedTexts);
+
+  indexedEvent.trigrams = GetTrigrams(indexedEvent.groups);
+}
+
+bool EventsSearchIndex::IsUpToDate(const IndexedEvent& indexedEvent,
+                                   const gd::BaseEvent& event) {
+  if (event.GetRevision() != indexedEvent.revision) return false;
+
+  // Instructions are checked in the same order as they were indexed.
+  std::size_t position = 0;
+  for (const gd::InstructionsList* conditions :
+       event.GetAllConditionsVectors()) {
+    if (!AreInstructionsUpToDate(
+            *conditions, indexedEvent.instructionsRevisions, position))
+      return false;
+  }
+  for (const gd::InstructionsList* actions : event.GetAllActionsVectors()) {
+    if (!AreInstructionsUpToDate(
+            *actions, indexedEvent.instructionsRevisions, position))
+      return false;
+  }
+
+  return position == indexedEvent.instructionsRevisions.size();
+}
+
+bool EventsSearchIndex::AreInstructionsUpToDate(
+    const gd::InstructionsList& instructions,
+    const std::vector<InstructionRevision>& instructionsRevisions,
+    std::size_t& position) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction& instruction = instructions[i];
+    if (position >= instructionsRevisions.size() ||
+        instructionsRevisions[position].instruction != &instruction ||
+        instructionsRevisions[position].revision != instruction.GetRevision())
+      return false;
+
+    position++;
+    if (!AreInstructionsUpToDate(
+            instruction.GetSubInstructions(), instructionsRevisions, position))
+      return false;
+  }
+
+  return true;
+}
+
+std::vector<std::uint32_t> EventsSearchIndex::GetTrigrams(
+    const std::vector<TextsGroup>& groups) {
+  std::vector<std::uint32_t> trigrams;
+  for (const TextsGroup& group : groups) {
+    AddTrigrams(group.caseFoldedTexts, trigrams);
+    AddTrigrams(group.caseFoldedSentences, trigrams);
+  }
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()),
+                 trigrams.end());
+  return trigrams;
+}
+
+bool EventsSearchIndex::GetCandidateSlots(
+    const gd::String& text, std::vector<std::size_t>& candidates) const {
+  std::vector<std::uint32_t> trigrams;
+  AddTrigrams(text, trigrams);
+  if (trigrams.empty()) return false;
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+  std::vector<const std::vector<std::size_t>*> trigramsPostings;
+  for (std::uint32_t trigram : trigrams) {
+    auto it = postings.find(trigram);
+    if (it == postings.end()) {
+      candidates.clear();
+      return true;
+    }
+
+    trigramsPostings.push_back(&it->second);
+  }
+
+  // Intersect the smallest postings first.
+  std::sort(trigramsPostings.begin(),
+            trigramsPostings.end(),
+            [](const std::vector<std::size_t>* a,
+               const std::vector<std::size_t>* b) {
+              return a->size() < b->size();
+            });
+  candidates = *trigramsPostings[0];
+  std::vector<std::size_t> intersection;
+  for (std::size_t i = 1; i < trigramsPostings.size() && !candidates.empty();
+       ++i) {
+    intersection.clear();
+    std::set_intersection(candidates.begin(),
+                          candidates.end(),
+                          trigramsPostings[i]->begin(),
+                          trigramsPostings[i]->end(),
+                          std::back_inserter(intersection));
+    candidates.swap(intersection);
+  }
+
+  return true;
+}
+
+void EventsSearchIndex::UpdateEvent(const gd::BaseEvent& event) {
+  auto it = indexedEvents.find(&event);
+  if (it == indexedEvents.end()) return;
+
+  slots[it->second] = IndexedEvent();
+  indexedEvents.erase(it);
+  lastSearchedEvents = NULL;
+}
+
+void EventsSearchIndex::Clear() {
+  slots.clear();
+  indexedEvents.clear();
+  postings.clear();
+  lastSearchedEvents = NULL;
+  lastFoundEvents.clear();
+}
+
+void EventsSearchIndex::Compact() {
+  std::vector<IndexedEvent> compactedSlots;
+  indexedEvents.clear();
+  postings.clear();
+
+  for (IndexedEvent& indexedEvent : slots) {
+    std::shared_ptr<gd::BaseEvent> event = indexedEvent.event.lock();
+    if (!event || indexedEvent.lastSearch != searchesCount) continue;
+
+    std::size_t slot = compactedSlots.size();
+    indexedEvents[event.get()] = slot;
+
+    for (std::uint32_t trigram : GetTrigrams(indexedEvent.groups))
+      postings[trigram].push_back(slot);
+
+    compactedSlots.push_back(std::move(indexedEvent));
+  }
+
+  slots = std::move(compactedSlots);
+}
+
+}  // namespace gd
@@ -0,0 +1,198 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSSEARCHINDEX_H
+#define GDCORE_EVENTSSEARCHINDEX_H
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+class Instruction;
+class InstructionsList;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the texts of events, to search in them without going
+ * through all the instructions again at each search.
+ *
+ * The index stores, for each event, the case folded parameters of its
+ * conditions and actions, the sentences of its instructions and its searchable
+ * strings. Trigrams of these texts point to the events containing them, so
+ * that a search only checks the events containing all the trigrams of the
+ * searched text.
+ *
+ * Events are indexed the first time they are searched. The revisions of the
+ * events and instructions (see gd::EventsRevision) are used to index again the
+ * events modified since the last search. When no events were modified, the
+ * events are not even gone through: the events found by the last search are
+ * used. An index is meant to be used for a single events list (for example,
+ * the events of a layout): events not found by the searches are eventually
+ * removed from it.
+ *
+ * \see EventsRefactorer::SearchInEvents
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsSearchIndex {
+ public:
+  EventsSearchIndex(const gd::Platform& platform_);
+  virtual ~EventsSearchIndex(){};
+
+  /**
+   * \brief Search for a gd::String in events, like
+   * EventsRefactorer::SearchInEvents.
+   *
+   * Events not yet in the index are indexed first.
+   */
+  std::vector<EventsSearchResult> Search(gd::EventsList& events,
+                                         gd::String search,
+                                         bool matchCase,
+                                         bool inConditions,
+                                         bool inActions,
+                                         bool inEventStrings,
+                                         bool inEventSentences);
+
+  /**
+   * \brief Mark an event as modified: it will be indexed again at the next
+   * search. Its sub-events are not affected.
+   *
+   * \note Modifications of events are detected using their revisions, so this
+   * is only needed if the event was modified without changing its revision.
+   */
+  void UpdateEvent(const gd::BaseEvent& event);
+
+  /**
+   * \brief Remove all the events from the index.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of events in the index.
+   */
+  std::size_t GetIndexedEventsCount() const { return indexedEvents.size(); }
+
+ private:
+  /**
+   * \brief The texts of a list of instructions, or of the searchable strings
+   * of an event, each text being followed by a null character.
+   */
+  struct TextsGroup {
+    enum Kind { Conditions, Actions, Strings };
+
+    Kind kind;
+    gd::String texts;
+    gd::String caseFoldedTexts;
+    gd::String sentences;  ///< Normalized sentences of the instructions.
+    gd::String caseFoldedSentences;
+  };
+
+  /**
+   * \brief The revision of an instruction of an event, when it was indexed.
+   */
+  struct InstructionRevision {
+    const gd::Instruction* instruction;
+    std::size_t revision;
+  };
+
+  struct IndexedEvent {
+    std::weak_ptr<gd::BaseEvent> event;
+    std::size_t revision = 0;  ///< The revision of the event when indexed.
+    std::vector<InstructionRevision>
+        instructionsRevisions;  ///< The instructions of the event and their
+                                ///< revisions, in the order they are indexed.
+    std::vector<TextsGroup> groups;
+    std::vector<std::uint32_t> trigrams;  ///< Only used while indexing.
+    std::size_t lastSearch = 0;  ///< The last search where the event was
+                                 ///< found.
+  };
+
+  /**
+   * \brief An event found in the events list being searched.
+   */
+  struct FoundEvent {
+    std::size_t slot;
+    gd::EventsList* eventsList;
+    std::size_t positionInList;
+  };
+
+  /**
+   * \brief Add the events and their sub-events to \a foundEvents, in the order
+   * of a search, assigning a slot to the events not in the index or modified
+   * since they were indexed.
+   */
+  void FindEvents(gd::EventsList& events,
+                  std::vector<FoundEvent>& foundEvents,
+                  std::vector<std::size_t>& slotsToIndex);
+
+  /**
+   * \brief Compute the texts and trigrams of the event in the slot.
+   */
+  void IndexEvent(IndexedEvent& indexedEvent) const;
+
+  /**
+   * \brief Return true if the event and its instructions have the same
+   * revisions as when it was indexed.
+   */
+  static bool IsUpToDate(const IndexedEvent& indexedEvent,
+                         const gd::BaseEvent& event);
+
+  /**
+   * \brief Check the revisions of the instructions (and sub-instructions),
+   * starting at \a position in the recorded revisions.
+   */
+  static bool AreInstructionsUpToDate(
+      const gd::InstructionsList& instructions,
+      const std::vector<InstructionRevision>& instructionsRevisions,
+      std::size_t& position);
+
+  /**
+   * \brief Return the sorted, unique trigrams of the case folded texts.
+   */
+  static std::vector<std::uint32_t> GetTrigrams(
+      const std::vector<TextsGroup>& groups);
+
+  /**
+   * \brief Fill \a candidates with the sorted slots of the events containing
+   * all the trigrams of the (case folded) text.
+   *
+   * \return false if the text is too short to have trigrams, in which case
+   * all events are candidates.
+   */
+  bool GetCandidateSlots(const gd::String& text,
+                         std::vector<std::size_t>& candidates) const;
+
+  /**
+   * \brief Remove the events not found by the last search and the empty slots,
+   * and rebuild the postings.
+   */
+  void Compact();
+
+  const gd::Platform& platform;
+  std::vector<IndexedEvent> slots;  ///< Indexed events. Slots of events
+                                    ///< removed from the index are empty.
+  std::unordered_map<const gd::BaseEvent*, std::size_t>
+      indexedEvents;  ///< The slot of each indexed event.
+  std::unordered_map<std::uint32_t, std::vector<std::size_t>>
+      postings;  ///< The (sorted) slots of the events containing each trigram.
+  std::size_t searchesCount;
+
+  const gd::EventsList* lastSearchedEvents;  ///< Can be NULL.
+  std::size_t lastSearchRevision;  ///< The last revision of events (see
+                                   ///< gd::EventsRevision::GetLast) when the
+                                   ///< events were last gone through.
+  std::vector<FoundEvent> lastFoundEvents;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSSEARCHINDEX_H
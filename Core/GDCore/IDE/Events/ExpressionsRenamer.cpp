@@ -15,6 +15,7 @@
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
@@ -153,9 +154,18 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
                              : gd::MetadataProvider::GetActionMetadata(
                                    platform, instruction.GetType());
 
+  // Whitespaces are allowed around the namespace separator, so search for the
+  // function name only.
+  const gd::String searchedName =
+      gd::PlatformExtension::GetNameWithoutNamespace(oldFunctionName);
+
   for (std::size_t pNb = 0; pNb < metadata.parameters.size() &&
                             pNb < instruction.GetParametersCount();
        ++pNb) {
+    // A function can only be called by expressions containing its name:
+    // avoid parsing the others.
+    if (!instruction.GetParameter(pNb).Contains(searchedName)) continue;
+
     const gd::String& type = metadata.parameters[pNb].type;
     const gd::String& expression =
         instruction.GetParameter(pNb).GetPlainString();
@@ -26,7 +26,91 @@ InstructionSentenceFormatter *InstructionSentenceFormatter::_singleton = NULL;
 std::vector<std::pair<gd::String, gd::TextFormatting> >
 InstructionSentenceFormatter::GetAsFormattedText(
     const Instruction &instr, const gd::InstructionMetadata &metadata) {
+  std::shared_ptr<const CompiledSentence> compiledSentence =
+      GetCompiledSentence(metadata);
+
   std::vector<std::pair<gd::String, gd::TextFormatting> > formattedStr;
+  formattedStr.reserve(compiledSentence->parts.size());
+  for (const SentencePart &part : compiledSentence->parts) {
+    TextFormatting format;
+    if (part.parameterIndex == gd::String::npos) {
+      formattedStr.push_back(std::make_pair(part.text, format));
+      continue;
+    }
+
+    // Add the parameter
+    format.userData = part.parameterIndex;
+
+    gd::String text = instr.GetParameter(part.parameterIndex).GetPlainString();
+    std::replace(text.Raw().begin(),
+                 text.Raw().end(),
+                 '\n',
+                 ' ');  // Using the raw std::string inside gd::String (no
+                        // problems because it's only ANSI characters)
+
+    formattedStr.push_back(std::make_pair(text, format));
+  }
+
+  return formattedStr;
+}
+
+gd::String InstructionSentenceFormatter::GetFullText(
+    const gd::Instruction &instr, const gd::InstructionMetadata &metadata)
+{
+  std::shared_ptr<const CompiledSentence> compiledSentence =
+      GetCompiledSentence(metadata);
+
+  gd::String completeSentence = "";
+  for (const SentencePart &part : compiledSentence->parts) {
+    if (part.parameterIndex == gd::String::npos) {
+      completeSentence.Raw().append(part.text.Raw());
+      continue;
+    }
+
+    std::size_t textStart = completeSentence.Raw().size();
+    completeSentence.Raw().append(
+        instr.GetParameter(part.parameterIndex).GetPlainString().Raw());
+    std::replace(completeSentence.Raw().begin() + textStart,
+                 completeSentence.Raw().end(),
+                 '\n',
+                 ' ');
+  }
+
+  return completeSentence;
+}
+
+std::shared_ptr<const InstructionSentenceFormatter::CompiledSentence>
+InstructionSentenceFormatter::GetCompiledSentence(
+    const gd::InstructionMetadata &metadata) {
+  {
+#if !defined(EMSCRIPTEN)
+    std::lock_guard<std::mutex> lock(compiledSentencesMutex);
+#endif
+    auto it = compiledSentences.find(&metadata);
+    // The metadata can have changed, or be another one allocated at the same
+    // address.
+    if (it != compiledSentences.end() &&
+        it->second->parametersCount == metadata.parameters.size() &&
+        it->second->sentence == metadata.GetSentence())
+      return it->second;
+  }
+
+  std::shared_ptr<const CompiledSentence> compiledSentence =
+      CompileSentence(metadata);
+
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(compiledSentencesMutex);
+#endif
+  compiledSentences[&metadata] = compiledSentence;
+  return compiledSentence;
+}
+
+std::shared_ptr<const InstructionSentenceFormatter::CompiledSentence>
+InstructionSentenceFormatter::CompileSentence(
+    const gd::InstructionMetadata &metadata) {
+  auto compiledSentence = std::make_shared<CompiledSentence>();
+  compiledSentence->sentence = metadata.GetSentence();
+  compiledSentence->parametersCount = metadata.parameters.size();
 
   gd::String sentence = metadata.GetSentence();
   std::replace(sentence.Raw().begin(), sentence.Raw().end(), '\n', ' ');
@@ -53,55 +137,29 @@ InstructionSentenceFormatter::GetAsFormattedText(
       }
     }
 
-    // When a parameter is found, complete formatted gd::String.
+    // When a parameter is found, add it to the parts.
     if (parse) {
       if (firstParamPosition !=
           0)  // Add constant text before the parameter if any
       {
-        TextFormatting format;
-        formattedStr.push_back(
-            std::make_pair(sentence.substr(0, firstParamPosition), format));
+        compiledSentence->parts.push_back(SentencePart{
+            sentence.substr(0, firstParamPosition), gd::String::npos});
       }
 
       // Add the parameter
-      TextFormatting format;
-      format.userData = firstParamIndex;
-
-      gd::String text = instr.GetParameter(firstParamIndex).GetPlainString();
-      std::replace(text.Raw().begin(),
-                   text.Raw().end(),
-                   '\n',
-                   ' ');  // Using the raw std::string inside gd::String (no
-                          // problems because it's only ANSI characters)
-
-      formattedStr.push_back(std::make_pair(text, format));
+      compiledSentence->parts.push_back(SentencePart{"", firstParamIndex});
       gd::String placeholder =
           "_PARAM" + gd::String::From(firstParamIndex) + "_";
       sentence = sentence.substr(firstParamPosition + placeholder.length());
     } else if (!sentence.empty())  // No more parameter found: Add the end of
                                    // the sentence
     {
-      TextFormatting format;
-      formattedStr.push_back(std::make_pair(sentence, format));
+      compiledSentence->parts.push_back(
+          SentencePart{sentence, gd::String::npos});
     }
   }
 
-  return formattedStr;
-}
-
-gd::String InstructionSentenceFormatter::GetFullText(
-    const gd::Instruction &instr, const gd::InstructionMetadata &metadata)
-{
-  const std::vector<std::pair<gd::String, gd::TextFormatting> > formattedText =
-      GetAsFormattedText(instr, metadata);
-
-  gd::String completeSentence = "";
-
-  for (std::size_t id = 0; id < formattedText.size(); ++id) {
-    completeSentence += formattedText.at(id).first;
-  }
-
-  return completeSentence;
+  return compiledSentence;
 }
 
 }  // namespace gd
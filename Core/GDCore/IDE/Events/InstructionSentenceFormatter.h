@@ -7,8 +7,13 @@
 #ifndef TRANSLATEACTION_H
 #define TRANSLATEACTION_H
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
+#if !defined(EMSCRIPTEN)
+#include <mutex>
+#endif
 #include "GDCore/String.h"
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/IDE/Events/TextFormatting.h"
@@ -21,6 +26,12 @@ namespace gd {
 /**
  * \brief Generate user friendly sentences and information from an action or
  * condition metadata.
+ *
+ * The sentence of each metadata is split into texts and parameters once, and
+ * kept until the sentence or the parameters of the metadata change. Formatting
+ * an instruction then only concatenates these texts and the parameters.
+ * Formatting can be done from several threads, as long as the formatter was
+ * created before.
  */
 class GD_CORE_API InstructionSentenceFormatter {
  public:
@@ -51,8 +62,42 @@ class GD_CORE_API InstructionSentenceFormatter {
   virtual ~InstructionSentenceFormatter(){};
 
  private:
+  /**
+   * \brief A part of a sentence: a text, or a parameter (with an empty text).
+   */
+  struct SentencePart {
+    gd::String text;
+    std::size_t parameterIndex;  ///< gd::String::npos for a text.
+  };
+
+  /**
+   * \brief The sentence of a metadata, split into texts and parameters.
+   */
+  struct CompiledSentence {
+    gd::String sentence;  ///< The compiled sentence, to detect changes.
+    std::size_t parametersCount;
+    std::vector<SentencePart> parts;
+  };
+
+  /**
+   * \brief Return the compiled sentence of the metadata, compiling it if it's
+   * not done yet or if the metadata changed.
+   */
+  std::shared_ptr<const CompiledSentence> GetCompiledSentence(
+      const gd::InstructionMetadata &metadata);
+
+  static std::shared_ptr<const CompiledSentence> CompileSentence(
+      const gd::InstructionMetadata &metadata);
+
   InstructionSentenceFormatter(){};
   static InstructionSentenceFormatter *_singleton;
+
+  std::unordered_map<const gd::InstructionMetadata *,
+                     std::shared_ptr<const CompiledSentence>>
+      compiledSentences;
+#if !defined(EMSCRIPTEN)
+  std::mutex compiledSentencesMutex;
+#endif
 };
 
 }  // namespace gd
@@ -14,10 +14,24 @@ namespace gd {
 std::set<gd::String> UsedExtensionsFinder::ScanProject(gd::Project& project) {
   UsedExtensionsFinder worker(project);
   gd::WholeProjectRefactorer::ExposeProjectObjects(project, worker);
-  gd::WholeProjectRefactorer::ExposeProjectEvents(project, worker);
+  gd::WholeProjectRefactorer::ExposeProjectEventsInParallel(project, worker);
   return worker.usedExtensions;
 };
 
+std::unique_ptr<ClonableArbitraryEventsWorkerWithContext>
+UsedExtensionsFinder::Clone() const {
+  return std::unique_ptr<ClonableArbitraryEventsWorkerWithContext>(
+      new UsedExtensionsFinder(project));
+};
+
+void UsedExtensionsFinder::Reduce(
+    ClonableArbitraryEventsWorkerWithContext& clone) {
+  const auto& cloneUsedExtensions =
+      static_cast<UsedExtensionsFinder&>(clone).usedExtensions;
+  usedExtensions.insert(cloneUsedExtensions.begin(),
+                        cloneUsedExtensions.end());
+};
+
 // Objects scanner
 
 void UsedExtensionsFinder::DoVisitObject(gd::Object& object) {
@@ -50,6 +64,9 @@ bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
 
   size_t i = 0;
   for (auto expression : instruction.GetParameters()) {
+    // Instructions of unknown extensions have no parameters metadata.
+    if (i >= metadata.GetMetadata().GetParametersCount()) break;
+
     const gd::String& parameterType =
         metadata.GetMetadata().GetParameter(i).GetType();
     i++;
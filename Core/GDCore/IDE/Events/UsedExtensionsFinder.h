@@ -23,7 +23,7 @@ namespace gd {
 
 class GD_CORE_API UsedExtensionsFinder
     : public ArbitraryObjectsWorker,
-      public ArbitraryEventsWorkerWithContext,
+      public ClonableArbitraryEventsWorkerWithContext,
       public ExpressionParser2NodeWorker {
  public:
   static std::set<gd::String> ScanProject(gd::Project& project);
@@ -33,6 +33,11 @@ class GD_CORE_API UsedExtensionsFinder
   gd::Project& project;
   std::set<gd::String> usedExtensions;
 
+  // Events are browsed concurrently by clones of the worker
+  std::unique_ptr<ClonableArbitraryEventsWorkerWithContext> Clone()
+      const override;
+  void Reduce(ClonableArbitraryEventsWorkerWithContext& clone) override;
+
   // Object Visitor
   void DoVisitObject(gd::Object& object) override;
 
@@ -0,0 +1,387 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/NativeFileSystem.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "GDCore/Tools/MappedFile.h"
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+#include <dirent.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#undef CopyFile  // Remove a Windows macro
+
+namespace gd {
+
+namespace {
+std::vector<gd::String> SplitPath(const gd::String& path) {
+  std::vector<gd::String> components;
+  for (const gd::String& component : path.Split(U'/'))
+    if (!component.empty()) components.push_back(component);
+
+  return components;
+}
+
+gd::String GetCurrentDirectory() {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  std::vector<char> buffer(4096);
+  if (getcwd(buffer.data(), buffer.size()))
+    return gd::String::FromUTF8(buffer.data());
+#endif
+  return "/";
+}
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+bool RemoveRecursively(const gd::String& path) {
+  struct stat pathStat;
+  if (lstat(path.c_str(), &pathStat) != 0) return errno == ENOENT;
+  if (!S_ISDIR(pathStat.st_mode)) return unlink(path.c_str()) == 0;
+
+  bool removed = true;
+  if (DIR* dir = opendir(path.c_str())) {
+    while (struct dirent* entry = readdir(dir)) {
+      gd::String name = gd::String::FromUTF8(entry->d_name);
+      if (name == "." || name == "..") continue;
+
+      removed = RemoveRecursively(path + "/" + name) && removed;
+    }
+    closedir(dir);
+  }
+
+  return rmdir(path.c_str()) == 0 && removed;
+}
+#endif
+}  // namespace
+
+bool NativeFileSystem::IsExternalUrl(const gd::String& filename) {
+  return filename.find("http://") == 0 || filename.find("https://") == 0 ||
+         filename.find("ftp://") == 0 || filename.find("blob:") == 0 ||
+         filename.find("data:") == 0;
+}
+
+gd::String NativeFileSystem::NormalizePath(const gd::String& path) {
+  gd::String normalizedPath = NormalizeSeparator(path);
+
+  // Keep the root of absolute paths ("/" or a Windows drive like "C:/").
+  gd::String root;
+  std::size_t rootLength = 0;
+  if (!normalizedPath.empty() && normalizedPath[0] == U'/') {
+    root = "/";
+    rootLength = 1;
+  } else if (normalizedPath.size() > 1 && normalizedPath[1] == U':') {
+    root = normalizedPath.substr(0, 2) + "/";
+    rootLength = 2;
+  }
+
+  std::vector<gd::String> components;
+  for (const gd::String& component :
+       SplitPath(normalizedPath.substr(rootLength))) {
+    if (component == ".") continue;
+
+    if (component == "..") {
+      if (!components.empty() && components.back() != "..")
+        components.pop_back();
+      else if (root.empty())
+        components.push_back(component);  // Can't go above a relative path.
+    } else {
+      components.push_back(component);
+    }
+  }
+
+  gd::String result = root;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (i != 0) result += "/";
+    result += components[i];
+  }
+
+  return result.empty() ? "." : result;
+}
+
+void NativeFileSystem::MkDir(const gd::String& path) {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  gd::String normalizedPath = NormalizePath(path);
+  gd::String currentPath = normalizedPath[0] == U'/' ? "/" : "";
+  for (const gd::String& component : SplitPath(normalizedPath)) {
+    currentPath += component + "/";
+    mkdir(currentPath.c_str(), 0777);  // Existing directories are ignored.
+  }
+#endif
+}
+
+bool NativeFileSystem::DirExists(const gd::String& path) {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+#else
+  return false;
+#endif
+}
+
+bool NativeFileSystem::FileExists(const gd::String& path) {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISREG(pathStat.st_mode);
+#else
+  std::ifstream stream(path.c_str());
+  return stream.good();
+#endif
+}
+
+bool NativeFileSystem::ClearDir(const gd::String& directory) {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  bool cleared = true;
+  if (DIR* dir = opendir(directory.c_str())) {
+    while (struct dirent* entry = readdir(dir)) {
+      gd::String name = gd::String::FromUTF8(entry->d_name);
+      if (name == "." || name == "..") continue;
+
+      cleared = RemoveRecursively(directory + "/" + name) && cleared;
+    }
+    closedir(dir);
+  } else {
+    MkDir(directory);
+  }
+
+  return cleared;
+#else
+  return false;
+#endif
+}
+
+bool NativeFileSystem::RemoveDir(const gd::String& directory) {
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  return RemoveRecursively(directory);
+#else
+  return false;
+#endif
+}
+
+gd::String NativeFileSystem::GetTempDir() {
+  const char* tmpDir = std::getenv("TMPDIR");
+  if (tmpDir && tmpDir[0] != '\0')
+    return NormalizePath(gd::String::FromUTF8(tmpDir));
+
+  return "/tmp";
+}
+
+gd::String NativeFileSystem::FileNameFrom(const gd::String& file) {
+  if (IsExternalUrl(file)) return file;
+
+  gd::String normalizedFile = NormalizeSeparator(file);
+  std::size_t lastSeparator = normalizedFile.rfind(U'/');
+  return lastSeparator == gd::String::npos
+             ? normalizedFile
+             : normalizedFile.substr(lastSeparator + 1);
+}
+
+gd::String NativeFileSystem::DirNameFrom(const gd::String& file) {
+  if (IsExternalUrl(file)) return "";
+
+  gd::String normalizedFile = NormalizeSeparator(file);
+  std::size_t lastSeparator = normalizedFile.rfind(U'/');
+  if (lastSeparator == gd::String::npos) return ".";
+  if (lastSeparator == 0) return "/";
+
+  return normalizedFile.substr(0, lastSeparator);
+}
+
+bool NativeFileSystem::MakeAbsolute(gd::String& filename,
+                                    const gd::String& baseDirectory) {
+  if (IsExternalUrl(filename)) return true;
+
+  gd::String absoluteBaseDirectory = baseDirectory;
+  if (baseDirectory.empty() || !IsAbsolute(baseDirectory))
+    absoluteBaseDirectory = GetCurrentDirectory() + "/" + baseDirectory;
+
+  if (filename.empty())
+    filename = NormalizePath(absoluteBaseDirectory);
+  else if (IsAbsolute(filename))
+    filename = NormalizePath(filename);
+  else
+    filename = NormalizePath(absoluteBaseDirectory + "/" + filename);
+
+  return true;
+}
+
+bool NativeFileSystem::IsAbsolute(const gd::String& filename) {
+  if (IsExternalUrl(filename)) return true;
+
+  if (filename.empty()) return true;
+  return filename[0] == U'/' || filename[0] == U'\\' ||
+         (filename.size() > 1 && filename[1] == U':');
+}
+
+bool NativeFileSystem::MakeRelative(gd::String& filename,
+                                    const gd::String& baseDirectory) {
+  if (IsExternalUrl(filename)) return true;
+
+  gd::String absoluteFilename = filename;
+  gd::String absoluteBaseDirectory = baseDirectory;
+  MakeAbsolute(absoluteFilename, GetCurrentDirectory());
+  MakeAbsolute(absoluteBaseDirectory, GetCurrentDirectory());
+
+  std::vector<gd::String> fileComponents = SplitPath(absoluteFilename);
+  std::vector<gd::String> baseComponents = SplitPath(absoluteBaseDirectory);
+  std::size_t commonCount = 0;
+  while (commonCount < fileComponents.size() &&
+         commonCount < baseComponents.size() &&
+         fileComponents[commonCount] == baseComponents[commonCount])
+    commonCount++;
+
+  std::vector<gd::String> relativeComponents(
+      baseComponents.size() - commonCount, "..");
+  relativeComponents.insert(relativeComponents.end(),
+                            fileComponents.begin() + commonCount,
+                            fileComponents.end());
+
+  filename = "";
+  for (std::size_t i = 0; i < relativeComponents.size(); ++i) {
+    if (i != 0) filename += "/";
+    filename += relativeComponents[i];
+  }
+
+  return true;
+}
+
+bool NativeFileSystem::CopyFile(const gd::String& file,
+                                const gd::String& destination) {
+  // URLs are not copied.
+  if (IsExternalUrl(file)) return true;
+  if (file == destination) return true;
+
+  MkDir(DirNameFrom(destination));
+  std::ifstream source(file.c_str(), std::ios::binary);
+  if (!source.is_open()) return false;
+
+  std::ofstream output(destination.c_str(),
+                       std::ios::binary | std::ios::trunc);
+  if (!output.is_open()) return false;
+
+  output << source.rdbuf();
+  output.close();
+  if (!output.good()) return false;
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  // The modification time is preserved, so that IsFileCopyUpToDate can
+  // check that the copy was not changed since.
+  struct stat fileStat;
+  if (stat(file.c_str(), &fileStat) == 0) {
+    struct utimbuf times;
+    times.actime = fileStat.st_atime;
+    times.modtime = fileStat.st_mtime;
+    utime(destination.c_str(), &times);
+  }
+#endif
+  return true;
+}
+
+bool NativeFileSystem::IsFileCopyUpToDate(const gd::String& file,
+                                          const gd::String& destination) {
+  if (IsExternalUrl(file)) return false;
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  struct stat fileStat;
+  struct stat destinationStat;
+  if (stat(file.c_str(), &fileStat) != 0 ||
+      stat(destination.c_str(), &destinationStat) != 0)
+    return false;
+
+  // Copies have the modification time of the file: a different one means
+  // that the file or the copy was changed (even if the copy is newer).
+  return S_ISREG(destinationStat.st_mode) &&
+         fileStat.st_size == destinationStat.st_size &&
+         fileStat.st_mtime == destinationStat.st_mtime;
+#else
+  return false;
+#endif
+}
+
+bool NativeFileSystem::LinkFile(const gd::String& file,
+                                const gd::String& destination) {
+  if (IsExternalUrl(file)) return false;
+  if (file == destination) return true;
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  unlink(destination.c_str());
+  return link(file.c_str(), destination.c_str()) == 0;
+#else
+  return false;
+#endif
+}
+
+bool NativeFileSystem::WriteToFile(const gd::String& file,
+                                   const gd::String& content) {
+  MkDir(DirNameFrom(file));
+  std::ofstream stream(file.c_str(), std::ios::binary | std::ios::trunc);
+  if (!stream.is_open()) return false;
+
+  stream.write(content.Raw().data(), content.Raw().size());
+  return stream.good();
+}
+
+gd::String NativeFileSystem::ReadFile(const gd::String& file) {
+  std::ifstream stream(file.c_str(), std::ios::binary);
+  if (!stream.is_open()) return "";
+
+  std::stringstream content;
+  content << stream.rdbuf();
+  gd::String str;
+  str.Raw() = content.str();
+  return str;
+}
+
+std::shared_ptr<gd::MappedFile> NativeFileSystem::MapFile(
+    const gd::String& file, bool writable) {
+  auto mappedFile = std::make_shared<gd::MappedFile>();
+  if (!mappedFile->Open(file, writable)) return nullptr;
+
+  return mappedFile;
+}
+
+std::vector<gd::String> NativeFileSystem::ReadDir(const gd::String& path,
+                                                  const gd::String& extension) {
+  std::vector<gd::String> files;
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+  std::string upperCaseExtension = extension.Raw();
+  std::transform(upperCaseExtension.begin(),
+                 upperCaseExtension.end(),
+                 upperCaseExtension.begin(),
+                 ::toupper);
+
+  DIR* dir = opendir(path.c_str());
+  if (!dir) return files;
+
+  while (struct dirent* entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    if (name.size() >= upperCaseExtension.size() &&
+        name.compare(name.size() - upperCaseExtension.size(),
+                     upperCaseExtension.size(),
+                     upperCaseExtension) == 0)
+      files.push_back(path + "/" + gd::String::FromUTF8(entry->d_name));
+  }
+  closedir(dir);
+
+  // The order of the entries of a directory is unspecified.
+  std::sort(files.begin(), files.end());
+#endif
+  return files;
+}
+
+}  // namespace gd
@@ -0,0 +1,78 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_NATIVEFILESYSTEM_H
+#define GDCORE_NATIVEFILESYSTEM_H
+#include <memory>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A file system working directly on the disk, for native tools using
+ * GDCore without the IDE (like the command line exporter of GDJS).
+ *
+ * It behaves like the file system used by the IDE when running on Electron
+ * (LocalFileSystem.js): paths are always using "/" as separator, and files are
+ * mapped in memory when possible.
+ *
+ * All the methods can be called concurrently from different threads.
+ *
+ * \note Only supported on POSIX systems (not on Windows or when compiled
+ * with Emscripten): directories can't be created or read otherwise.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API NativeFileSystem : public AbstractFileSystem {
+ public:
+  NativeFileSystem(){};
+  virtual ~NativeFileSystem(){};
+
+  void MkDir(const gd::String& path) override;
+  bool DirExists(const gd::String& path) override;
+  bool FileExists(const gd::String& path) override;
+  bool ClearDir(const gd::String& directory) override;
+  gd::String GetTempDir() override;
+  gd::String FileNameFrom(const gd::String& file) override;
+  gd::String DirNameFrom(const gd::String& file) override;
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool IsAbsolute(const gd::String& filename) override;
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool CopyFile(const gd::String& file, const gd::String& destination) override;
+  bool IsFileCopyUpToDate(const gd::String& file,
+                          const gd::String& destination) override;
+  bool LinkFile(const gd::String& file, const gd::String& destination) override;
+  bool SupportsConcurrentCopies() override { return true; }
+  bool WriteToFile(const gd::String& file, const gd::String& content) override;
+  gd::String ReadFile(const gd::String& file) override;
+  std::shared_ptr<gd::MappedFile> MapFile(const gd::String& file,
+                                          bool writable) override;
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override;
+
+  /**
+   * \brief Remove the directory and all its content.
+   * \return true if the directory does not exist anymore.
+   */
+  bool RemoveDir(const gd::String& directory);
+
+  /**
+   * \brief Return the path without "." and ".." components, and without
+   * duplicated or trailing separators.
+   */
+  static gd::String NormalizePath(const gd::String& path);
+
+ private:
+  static bool IsExternalUrl(const gd::String& filename);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_NATIVEFILESYSTEM_H
@@ -17,7 +17,7 @@
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
-#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/ResourcesManager.h"
 
@@ -106,63 +106,156 @@ ArbitraryResourceWorker::~ArbitraryResourceWorker() {}
  * Launch the specified resource worker on every resource referenced in the
  * events.
  */
-class ResourceWorkerInEventsWorker : public ArbitraryEventsWorker {
- public:
-  ResourceWorkerInEventsWorker(const gd::Project& project_,
-                               gd::ArbitraryResourceWorker& worker_)
-      : project(project_), worker(worker_){};
-  virtual ~ResourceWorkerInEventsWorker() {};
-
- private:
-  bool DoVisitInstruction(gd::Instruction& instruction, bool isCondition) {
-    const auto& platform = project.GetCurrentPlatform();
-    const auto& metadata = isCondition
-                               ? gd::MetadataProvider::GetConditionMetadata(
-                                     platform, instruction.GetType())
-                               : gd::MetadataProvider::GetActionMetadata(
-                                     platform, instruction.GetType());
-
-    gd::ParameterMetadataTools::IterateOverParametersWithIndex(
-        instruction.GetParameters(),
-        metadata.GetParameters(),
-        [this, &instruction](const gd::ParameterMetadata& parameterMetadata,
-                             const gd::String& parameterValue,
-                             size_t parameterIndex,
-                             const gd::String& lastObjectName) {
-          if (parameterMetadata.GetType() ==
-              "police") {  // Should be renamed fontResource
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "soundfile" ||
-                     parameterMetadata.GetType() ==
-                         "musicfile") {  // Should be renamed audioResource
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeAudio(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "bitmapFontResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeBitmapFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          } else if (parameterMetadata.GetType() == "imageResource") {
-            gd::String updatedParameterValue = parameterValue;
-            worker.ExposeImage(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
-          }
-        });
+namespace {
 
-    return false;
-  };
+/**
+ * \brief Expose the resources used by the parameters of an instruction, calling
+ * `onChange(parameterIndex, updatedParameterValue)` for each parameter updated
+ * by the worker.
+ */
+template <class OnChange>
+void ExposeInstructionResources(const gd::Project& project,
+                                const gd::Instruction& instruction,
+                                bool isCondition,
+                                gd::ArbitraryResourceWorker& worker,
+                                OnChange onChange) {
+  const auto& platform = project.GetCurrentPlatform();
+  const auto& metadata =
+      isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetType())
+                  : gd::MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetType());
+
+  gd::ParameterMetadataTools::IterateOverParametersWithIndex(
+      instruction.GetParameters(),
+      metadata.GetParameters(),
+      [&worker, &onChange](const gd::ParameterMetadata& parameterMetadata,
+                           const gd::String& parameterValue,
+                           size_t parameterIndex,
+                           const gd::String& lastObjectName) {
+        gd::String updatedParameterValue = parameterValue;
+        if (parameterMetadata.GetType() ==
+            "police") {  // Should be renamed fontResource
+          worker.ExposeFont(updatedParameterValue);
+        } else if (parameterMetadata.GetType() == "soundfile" ||
+                   parameterMetadata.GetType() ==
+                       "musicfile") {  // Should be renamed audioResource
+          worker.ExposeAudio(updatedParameterValue);
+        } else if (parameterMetadata.GetType() == "bitmapFontResource") {
+          worker.ExposeBitmapFont(updatedParameterValue);
+        } else if (parameterMetadata.GetType() == "imageResource") {
+          worker.ExposeImage(updatedParameterValue);
+        } else {
+          return;
+        }
+
+        if (updatedParameterValue != parameterValue)
+          onChange(parameterIndex, updatedParameterValue);
+      });
+}
+
+/**
+ * \brief Call `function(instruction)` for each instruction (and
+ * sub-instruction) of the list, in the same order as gd::ArbitraryEventsWorker.
+ */
+template <class InstructionsList, class Function>
+void IterateOverInstructions(InstructionsList& instructions,
+                             bool areConditions,
+                             Function& function) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    function(instructions[i], areConditions);
+    IterateOverInstructions(
+        instructions[i].GetSubInstructions(), areConditions, function);
+  }
+}
+
+/**
+ * \brief Call `function(instruction, isCondition)` for each instruction of the
+ * events (and sub-events), in the same order as gd::ArbitraryEventsWorker.
+ *
+ * Works on both const and non const events.
+ */
+template <class EventsList, class Function>
+void IterateOverEventsInstructions(EventsList& events, Function& function) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    auto& event = events[i];
+    for (auto* conditions : event.GetAllConditionsVectors())
+      IterateOverInstructions(*conditions, true, function);
+    for (auto* actions : event.GetAllActionsVectors())
+      IterateOverInstructions(*actions, false, function);
 
-  const gd::Project& project;
-  gd::ArbitraryResourceWorker& worker;
+    if (event.CanHaveSubEvents())
+      IterateOverEventsInstructions(event.GetSubEvents(), function);
+  }
+}
+
+/**
+ * \brief A change to apply to a parameter of an instruction, identified by
+ * its position in the events (see IterateOverEventsInstructions).
+ */
+struct ParameterChange {
+  std::size_t instructionPosition;
+  std::size_t parameterIndex;
+  gd::String updatedParameterValue;
 };
 
+}  // namespace
+
 void LaunchResourceWorkerOnEvents(const gd::Project& project,
                                   gd::EventsList& events,
                                   gd::ArbitraryResourceWorker& worker) {
-  ResourceWorkerInEventsWorker eventsWorker(project, worker);
-  eventsWorker.Launch(events);
+  auto exposeResources = [&project, &worker](gd::Instruction& instruction,
+                                             bool isCondition) {
+    ExposeInstructionResources(
+        project,
+        instruction,
+        isCondition,
+        worker,
+        [&instruction](size_t parameterIndex,
+                       const gd::String& updatedParameterValue) {
+          instruction.SetParameter(parameterIndex, updatedParameterValue);
+        });
+  };
+  IterateOverEventsInstructions(events, exposeResources);
+}
+
+void LaunchResourceWorkerOnLayoutEvents(const gd::Project& project,
+                                        gd::Layout& layout,
+                                        gd::ArbitraryResourceWorker& worker) {
+  // Expose the resources from the const events, so that events shared with
+  // another layout are not copied when no resource is changed by the worker.
+  std::vector<ParameterChange> changes;
+  std::size_t instructionPosition = 0;
+  auto exposeResources = [&](const gd::Instruction& instruction,
+                             bool isCondition) {
+    ExposeInstructionResources(
+        project,
+        instruction,
+        isCondition,
+        worker,
+        [&](size_t parameterIndex, const gd::String& updatedParameterValue) {
+          changes.push_back(
+              {instructionPosition, parameterIndex, updatedParameterValue});
+        });
+    instructionPosition++;
+  };
+  const gd::Layout& constLayout = layout;
+  IterateOverEventsInstructions(constLayout.GetEvents(), exposeResources);
+  if (changes.empty()) return;
+
+  // Apply the changes, to the events of the layout only.
+  std::size_t changeIndex = 0;
+  instructionPosition = 0;
+  auto applyChanges = [&](gd::Instruction& instruction, bool isCondition) {
+    for (; changeIndex < changes.size() &&
+           changes[changeIndex].instructionPosition == instructionPosition;
+         ++changeIndex) {
+      instruction.SetParameter(changes[changeIndex].parameterIndex,
+                               changes[changeIndex].updatedParameterValue);
+    }
+    instructionPosition++;
+  };
+  IterateOverEventsInstructions(layout.GetEvents(), applyChanges);
 }
 
 }  // namespace gd
@@ -21,6 +21,9 @@ namespace gd {
 class EventsList;
 }
 namespace gd {
+class Layout;
+}
+namespace gd {
 class Resource;
 }
 namespace gd {
@@ -124,6 +127,20 @@ LaunchResourceWorkerOnEvents(const gd::Project &project,
                              gd::EventsList &events,
                              gd::ArbitraryResourceWorker &worker);
 
+/**
+ * Same as LaunchResourceWorkerOnEvents, for the events of a layout.
+ *
+ * The events are only modified (and so copied if they are shared with another
+ * layout, see gd::Layout::CopyOnWriteFrom) if the worker changes a resource.
+ *
+ * \see gd::LaunchResourceWorkerOnEvents
+ * \ingroup IDE
+ */
+void GD_CORE_API
+LaunchResourceWorkerOnLayoutEvents(const gd::Project &project,
+                                   gd::Layout &layout,
+                                   gd::ArbitraryResourceWorker &worker);
+
 }  // namespace gd
 
 #endif  // ARBITRARYRESOURCEWORKER_H
@@ -5,6 +5,8 @@
  */
 #include "ProjectResourcesCopier.h"
 #include <map>
+#include <set>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Project/ResourcesAbsolutePathChecker.h"
@@ -12,6 +14,7 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelFor.h"
 
 using namespace std;
 
@@ -23,7 +26,8 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool linkFiles) {
   // Check if there are some resources with absolute filenames
   gd::ResourcesAbsolutePathChecker absolutePathChecker(fs);
   originalProject.ExposeResources(absolutePathChecker);
@@ -32,25 +36,23 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
   std::cout << "Copying all ressources from " << projectDirectory << " to "
             << destinationDirectory << "..." << std::endl;
 
-  // Get the resources to be copied
+  // Get the resources to be copied. If the original project must stay
+  // unchanged, only the new filenames are computed.
   gd::ResourcesMergingHelper resourcesMergingHelper(fs);
   resourcesMergingHelper.SetBaseDirectory(projectDirectory);
   resourcesMergingHelper.PreserveDirectoriesStructure(
       preserveDirectoryStructure);
   resourcesMergingHelper.PreserveAbsoluteFilenames(
       preserveAbsoluteFilenames);
+  resourcesMergingHelper.UpdateFilenames(updateOriginalProject);
+  originalProject.ExposeResources(resourcesMergingHelper);
 
-  if (updateOriginalProject) {
-    originalProject.ExposeResources(resourcesMergingHelper);
-  } else {
-    std::shared_ptr<gd::Project> project(new gd::Project(originalProject));
-    project->ExposeResources(resourcesMergingHelper);
-  }
-
-  // Copy resources
+  // List the files to copy, and create the directories in which they are
+  // copied.
   map<gd::String, gd::String>& resourcesNewFilename =
       resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
-  unsigned int i = 0;
+  std::vector<std::pair<gd::String, gd::String>> filesToCopy;
+  std::set<gd::String> existingDirectories;
   for (map<gd::String, gd::String>::const_iterator it =
            resourcesNewFilename.begin();
        it != resourcesNewFilename.end();
@@ -62,16 +64,34 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
 
       // Be sure the directory exists
       gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
+      if (existingDirectories.insert(dir).second && !fs.DirExists(dir))
+        fs.MkDir(dir);
 
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
-      }
+      filesToCopy.push_back(std::make_pair(it->first, destinationFile));
     }
+  }
+
+  // We can now copy the files, skipping the ones that are already up to date.
+  std::vector<char> copySucceeded(filesToCopy.size(), true);
+  auto copyFile = [&](std::size_t i) {
+    const gd::String& file = filesToCopy[i].first;
+    const gd::String& destinationFile = filesToCopy[i].second;
+    if (fs.IsFileCopyUpToDate(file, destinationFile)) return;
+    if (linkFiles && fs.LinkFile(file, destinationFile)) return;
 
-    ++i;
+    copySucceeded[i] = fs.CopyFile(file, destinationFile);
+  };
+  if (fs.SupportsConcurrentCopies()) {
+    gd::ParallelFor::Run(filesToCopy.size(), copyFile);
+  } else {
+    for (std::size_t i = 0; i < filesToCopy.size(); ++i) copyFile(i);
+  }
+
+  for (std::size_t i = 0; i < filesToCopy.size(); ++i) {
+    if (!copySucceeded[i]) {
+      gd::LogWarning(_("Unable to copy \"") + filesToCopy[i].first +
+                     _("\" to \"") + filesToCopy[i].second + _("\"."));
+    }
   }
 
   return true;
@@ -39,6 +39,14 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param linkFiles If set to true, files are linked (hard link or reflink)
+   * to the destination when the file system allows it, instead of being
+   * copied.
+   *
+   * Files already copied and not changed since (according to
+   * gd::AbstractFileSystem::IsFileCopyUpToDate) are not copied again. Files
+   * are copied concurrently if the file system supports it.
+   *
    * \return true if no error happened
    */
   static bool CopyAllResourcesTo(gd::Project& project,
@@ -46,7 +54,8 @@ class GD_CORE_API ProjectResourcesCopier {
                                  gd::String destinationDirectory,
                                  bool updateOriginalProject,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 bool linkFiles = false);
 };
 
 }  // namespace gd
@@ -16,6 +16,17 @@
 namespace gd {
 
 void ResourcesMergingHelper::ExposeFile(gd::String& resourceFilename) {
+  if (updateFilenames) {
+    MergeFile(resourceFilename);
+    return;
+  }
+
+  // Only compute the new filename, leaving the resource unchanged.
+  gd::String filename = resourceFilename;
+  MergeFile(filename);
+}
+
+void ResourcesMergingHelper::MergeFile(gd::String& resourceFilename) {
   if (resourceFilename.empty()) return;
 
   gd::String resourceFullFilename = resourceFilename;
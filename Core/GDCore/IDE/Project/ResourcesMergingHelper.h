@@ -33,6 +33,7 @@ class GD_CORE_API ResourcesMergingHelper : public ArbitraryResourceWorker {
       : ArbitraryResourceWorker(),
         preserveDirectoriesStructure(false),
         preserveAbsoluteFilenames(false),
+        updateFilenames(true),
         fs(fileSystem){};
   virtual ~ResourcesMergingHelper(){};
 
@@ -58,6 +59,15 @@ class GD_CORE_API ResourcesMergingHelper : public ArbitraryResourceWorker {
     preserveAbsoluteFilenames = preserveAbsoluteFilenames_;
   };
 
+  /**
+   * \brief Set if the filenames of the resources must be updated to the new
+   * filenames (default). If not, only the new filenames are computed, and the
+   * project is left unchanged.
+   */
+  void UpdateFilenames(bool updateFilenames_ = true) {
+    updateFilenames = updateFilenames_;
+  };
+
   /**
    * \brief Return a map containing the resources old absolute filename as key,
    * and the resources new filenames as value. The new filenames are relative to
@@ -74,6 +84,7 @@ class GD_CORE_API ResourcesMergingHelper : public ArbitraryResourceWorker {
   virtual void ExposeFile(gd::String& resource) override;
 
  protected:
+  void MergeFile(gd::String& resourceFilename);
   void SetNewFilename(gd::String oldFilename, gd::String newFilename);
 
   std::map<gd::String, gd::String> oldFilenames;
@@ -87,6 +98,8 @@ class GD_CORE_API ResourcesMergingHelper : public ArbitraryResourceWorker {
                                    ///< absolute (C:\MyFile.png  will not be
                                    ///< transformed into a relative filename
                                    ///< (MyFile.png).
+  bool updateFilenames;  ///< If set to false, the filenames exposed are not
+                         ///< updated to the new filenames.
   gd::AbstractFileSystem&
       fs;  ///< The gd::AbstractFileSystem used to manipulate files.
 };
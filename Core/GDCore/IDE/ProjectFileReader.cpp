@@ -0,0 +1,54 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectFileReader.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/MappedFile.h"
+
+namespace gd {
+
+SerializerElement ProjectFileReader::ReadJSON(gd::AbstractFileSystem& fs,
+                                              const gd::String& file,
+                                              bool inSitu) {
+  std::shared_ptr<gd::MappedFile> mappedFile = fs.MapFile(file, inSitu);
+  if (mappedFile && mappedFile->IsOpen()) {
+    if (inSitu && mappedFile->IsNullTerminated())
+      return gd::Serializer::FromJSONInSitu(mappedFile->GetWritableData());
+
+    return gd::Serializer::FromJSON(mappedFile->GetData(),
+                                    mappedFile->GetSize());
+  }
+
+  // The content is not used after parsing, so it can be parsed in-situ
+  // instead of being copied again.
+  gd::String content = fs.ReadFile(file);
+  return gd::Serializer::FromJSONInSitu(&content.Raw()[0]);
+}
+
+bool ProjectFileReader::ReadBinaryProject(gd::AbstractFileSystem& fs,
+                                          const gd::String& file,
+                                          gd::Project& project,
+                                          bool lazyLayoutsLoading) {
+  std::shared_ptr<gd::MappedFile> mappedFile = fs.MapFile(file, false);
+  if (mappedFile && mappedFile->IsOpen()) {
+    // The data keeps the mapping alive.
+    std::shared_ptr<const char> data(mappedFile, mappedFile->GetData());
+    return project.UnserializeFromBinary(
+        data, mappedFile->GetSize(), lazyLayoutsLoading);
+  }
+
+  auto data = std::make_shared<std::string>(std::move(fs.ReadFile(file).Raw()));
+  return project.UnserializeFromBinary(data, lazyLayoutsLoading);
+}
+
+}  // namespace gd
@@ -0,0 +1,64 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PROJECTFILEREADER_H
+#define GDCORE_PROJECTFILEREADER_H
+#include "GDCore/Serialization/SerializerElement.h"
+namespace gd {
+class AbstractFileSystem;
+class Project;
+class String;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Tool class to read project files with as few copies as possible.
+ *
+ * When the file system can map files in memory (see
+ * gd::AbstractFileSystem::MapFile), the files are parsed directly from the
+ * mapping. This avoids copying large projects, and concurrent processes
+ * reading the same project share the same pages in memory. Otherwise, files
+ * are read with gd::AbstractFileSystem::ReadFile.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ProjectFileReader {
+ public:
+  /**
+   * \brief Read a JSON file.
+   *
+   * \param fs The file system to be used.
+   * \param file The file to read.
+   * \param inSitu If true, the file is mapped in a private, copy-on-write,
+   * mapping where strings are decoded in place. Otherwise, the file is parsed
+   * from a read-only mapping.
+   */
+  static SerializerElement ReadJSON(gd::AbstractFileSystem& fs,
+                                    const gd::String& file,
+                                    bool inSitu = false);
+
+  /**
+   * \brief Read a project saved with gd::Project::SerializeToBinary.
+   *
+   * When layouts are loaded lazily, the file stays mapped until all the
+   * layouts are loaded.
+   *
+   * \return false if the file is not a valid binary project.
+   * \see gd::Project::UnserializeFromBinary
+   */
+  static bool ReadBinaryProject(gd::AbstractFileSystem& fs,
+                                const gd::String& file,
+                                gd::Project& project,
+                                bool lazyLayoutsLoading = false);
+
+ private:
+  ProjectFileReader(){};
+  virtual ~ProjectFileReader(){};
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PROJECTFILEREADER_H
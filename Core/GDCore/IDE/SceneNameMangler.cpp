@@ -10,10 +10,11 @@
 
 namespace gd {
 
-SceneNameMangler *SceneNameMangler::_singleton = nullptr;
-
 const gd::String &SceneNameMangler::GetMangledSceneName(
     const gd::String &sceneName) {
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(mangledSceneNamesMutex);
+#endif
   auto it = mangledSceneNames.find(sceneName);
   if (it != mangledSceneNames.end()) {
     return it->second;
@@ -43,16 +44,17 @@ const gd::String &SceneNameMangler::GetMangledSceneName(
 }
 
 SceneNameMangler *SceneNameMangler::Get() {
-  if (nullptr == _singleton) _singleton = new SceneNameMangler;
-
-  return (static_cast<SceneNameMangler *>(_singleton));
+  // The initialization of a static local variable is thread-safe.
+  static SceneNameMangler singleton;
+  return &singleton;
 }
 
 void SceneNameMangler::DestroySingleton() {
-  if (nullptr != _singleton) {
-    delete _singleton;
-    _singleton = nullptr;
-  }
+  SceneNameMangler *singleton = Get();
+#if !defined(EMSCRIPTEN)
+  std::lock_guard<std::mutex> lock(singleton->mangledSceneNamesMutex);
+#endif
+  singleton->mangledSceneNames.clear();
 }
 
 }  // namespace gd
@@ -7,6 +7,9 @@
 #ifndef SCENENAMEMANGLER_H
 #define SCENENAMEMANGLER_H
 #include <unordered_map>
+#if !defined(EMSCRIPTEN)
+#include <mutex>
+#endif
 #include "GDCore/String.h"
 
 namespace gd {
@@ -25,20 +28,26 @@ class GD_CORE_API SceneNameMangler {
    * must be a letter, otherwise it is also replaced in the same manner.
    *
    * The mangled name is memoized as this is intensively used during project
-   * export and events code generation.
+   * export and events code generation. It can be called from several threads.
    */
   const gd::String& GetMangledSceneName(const gd::String& sceneName);
 
   static SceneNameMangler* Get();
+
+  /**
+   * \brief Clear the memoized names (the instance returned by Get is kept).
+   */
   static void DestroySingleton();
 
  private:
   SceneNameMangler(){};
   virtual ~SceneNameMangler(){};
-  static SceneNameMangler* _singleton;
 
   std::unordered_map<gd::String, gd::String>
       mangledSceneNames;  ///< Memoized results of mangling
+#if !defined(EMSCRIPTEN)
+  std::mutex mangledSceneNamesMutex;
+#endif
 };
 
 }  // namespace gd
@@ -7,6 +7,7 @@
 
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
@@ -22,6 +23,7 @@
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/BehaviorContent.h"
 #include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
@@ -31,6 +33,8 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/ParallelFor.h"
 
 namespace {
 // These functions are doing the reverse of what is done when adding
@@ -142,6 +146,99 @@ void WholeProjectRefactorer::ExposeProjectEvents(
   }
 }
 
+void WholeProjectRefactorer::ExposeProjectEventsInParallel(
+    gd::Project& project,
+    gd::ClonableArbitraryEventsWorkerWithContext& worker) {
+  struct EventsListWithContext {
+    gd::EventsList* events;
+    const gd::ObjectsContainer* globalObjectsContainer;
+    const gd::ObjectsContainer* objectsContainer;
+  };
+
+  // List the events first, in the same order as ExposeProjectEvents. Objects
+  // containers built for events functions are kept alive until the workers
+  // are done.
+  std::vector<EventsListWithContext> eventsLists;
+  std::vector<std::unique_ptr<gd::ObjectsContainer>> functionsContainers;
+  auto addFunctionEvents =
+      [&](gd::EventsFunction& eventsFunction,
+          std::unique_ptr<gd::ObjectsContainer> globalObjectsAndGroups,
+          std::unique_ptr<gd::ObjectsContainer> objectsAndGroups) {
+        eventsLists.push_back({&eventsFunction.GetEvents(),
+                               globalObjectsAndGroups.get(),
+                               objectsAndGroups.get()});
+        functionsContainers.push_back(std::move(globalObjectsAndGroups));
+        functionsContainers.push_back(std::move(objectsAndGroups));
+      };
+
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    auto& layout = project.GetLayout(s);
+    eventsLists.push_back({&layout.GetEvents(), &project, &layout});
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    auto& externalEvents = project.GetExternalEvents(s);
+    const gd::String& associatedLayout = externalEvents.GetAssociatedLayout();
+    if (project.HasLayoutNamed(associatedLayout)) {
+      eventsLists.push_back({&externalEvents.GetEvents(),
+                             &project,
+                             &project.GetLayout(associatedLayout)});
+    }
+  }
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto& eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    for (auto&& eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      auto globalObjectsAndGroups = gd::make_unique<gd::ObjectsContainer>();
+      auto objectsAndGroups = gd::make_unique<gd::ObjectsContainer>();
+      gd::EventsFunctionTools::FreeEventsFunctionToObjectsContainer(
+          project, *eventsFunction, *globalObjectsAndGroups, *objectsAndGroups);
+      addFunctionEvents(*eventsFunction,
+                        std::move(globalObjectsAndGroups),
+                        std::move(objectsAndGroups));
+    }
+
+    for (auto&& eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      for (auto&& eventsFunction :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        auto globalObjectsAndGroups = gd::make_unique<gd::ObjectsContainer>();
+        auto objectsAndGroups = gd::make_unique<gd::ObjectsContainer>();
+        gd::EventsFunctionTools::BehaviorEventsFunctionToObjectsContainer(
+            project,
+            *eventsBasedBehavior,
+            *eventsFunction,
+            *globalObjectsAndGroups,
+            *objectsAndGroups);
+        addFunctionEvents(*eventsFunction,
+                          std::move(globalObjectsAndGroups),
+                          std::move(objectsAndGroups));
+      }
+    }
+  }
+
+  // Extensions are declared from this thread, so that workers don't change
+  // them while they are read.
+  for (auto* platform : project.GetUsedPlatforms())
+    platform->DeclareLazyExtensions();
+
+  // Clones are created from this thread, so that workers don't have to
+  // support being cloned concurrently.
+  std::vector<std::unique_ptr<gd::ClonableArbitraryEventsWorkerWithContext>>
+      clones;
+  clones.reserve(eventsLists.size());
+  for (std::size_t i = 0; i < eventsLists.size(); ++i)
+    clones.push_back(worker.Clone());
+
+  gd::ParallelFor::Run(eventsLists.size(), [&](std::size_t i) {
+    clones[i]->Launch(*eventsLists[i].events,
+                      *eventsLists[i].globalObjectsContainer,
+                      *eventsLists[i].objectsContainer);
+  });
+
+  for (auto& clone : clones) worker.Reduce(*clone);
+}
+
 void WholeProjectRefactorer::ExposeEventsBasedBehaviorEvents(
     gd::Project& project,
     const gd::EventsBasedBehavior& eventsBasedBehavior,
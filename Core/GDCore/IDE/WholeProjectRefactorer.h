@@ -21,6 +21,7 @@ class EventsBasedBehavior;
 class ArbitraryEventsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ClonableArbitraryEventsWorkerWithContext;
 class Behavior;
 class BehaviorContent;
 class BehaviorMetadata;
@@ -57,6 +58,20 @@ class GD_CORE_API WholeProjectRefactorer {
   static void ExposeProjectEvents(gd::Project& project,
                                   gd::ArbitraryEventsWorkerWithContext& worker);
 
+  /**
+   * \brief Call clones of the specified worker on all events of the project
+   * (layout, external events, events functions...), concurrently, then merge
+   * their results into the worker.
+   *
+   * Events lists are the same as the ones given by ExposeProjectEvents, and
+   * results are merged in the same order.
+   *
+   * \see gd::ClonableArbitraryEventsWorkerWithContext
+   */
+  static void ExposeProjectEventsInParallel(
+      gd::Project& project,
+      gd::ClonableArbitraryEventsWorkerWithContext& worker);
+
   /**
    * \brief Call the specified worker on all events of the events based behavior
    *
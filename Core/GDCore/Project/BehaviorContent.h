@@ -32,7 +32,11 @@ namespace gd {
 class GD_CORE_API BehaviorContent {
  public:
   BehaviorContent(const gd::String& name_, const gd::String& type_)
-      : name(name_), type(type_){};
+      : name(name_), type(type_) {
+    // Behaviors contents are copied when the behaviors are serialized or
+    // when objects are copied: share their subtrees until they are modified.
+    content.EnableCopyOnWrite();
+  };
   virtual ~BehaviorContent();
   virtual BehaviorContent* Clone() const { return new BehaviorContent(*this); }
 
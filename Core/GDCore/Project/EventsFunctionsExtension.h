@@ -207,7 +207,7 @@ class GD_CORE_API EventsFunctionsExtension : public EventsFunctionsContainer {
   }
 
   gd::DependencyMetadata UnserializeDependencyFrom(
-      gd::SerializerElement& serializer) {
+      const gd::SerializerElement& serializer) {
     gd::DependencyMetadata dependency;
     dependency.SetDependencyType(serializer.GetStringAttribute("type"));
     dependency.SetExportName(serializer.GetStringAttribute("exportName"));
@@ -13,8 +13,45 @@
 
 namespace gd {
 
+ExternalLayout::ExternalLayout(const ExternalLayout& other)
+    : name(other.name),
+      instances(other.GetInitialInstances()),
+      sharedInstances(NULL),
+      editorSettings(other.editorSettings),
+      associatedLayout(other.associatedLayout) {}
+
+ExternalLayout& ExternalLayout::operator=(const ExternalLayout& other) {
+  if (this != &other) {
+    name = other.name;
+    instances = other.GetInitialInstances();
+    sharedInstances = NULL;
+    editorSettings = other.editorSettings;
+    associatedLayout = other.associatedLayout;
+  }
+  return *this;
+}
+
+void ExternalLayout::CopyOnWriteFrom(const gd::ExternalLayout& other) {
+  if (this == &other) return;
+
+  name = other.name;
+  instances.Clear();
+  sharedInstances = &other.GetInitialInstances();
+  editorSettings = other.editorSettings;
+  associatedLayout = other.associatedLayout;
+}
+
+gd::InitialInstancesContainer& ExternalLayout::GetInitialInstances() {
+  if (sharedInstances) {
+    instances = *sharedInstances;
+    sharedInstances = NULL;
+  }
+  return instances;
+}
+
 void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
   name = element.GetStringAttribute("name", "", "Name");
+  sharedInstances = NULL;
   instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
   editorSettings.UnserializeFrom(element.GetChild("editionSettings"));
   associatedLayout = element.GetStringAttribute("associatedLayout");
@@ -22,7 +59,7 @@ void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
 
 void ExternalLayout::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", name);
-  instances.SerializeTo(element.AddChild("instances"));
+  GetInitialInstances().SerializeTo(element.AddChild("instances"));
   editorSettings.SerializeTo(element.AddChild("editionSettings"));
   element.SetAttribute("associatedLayout", associatedLayout);
 }
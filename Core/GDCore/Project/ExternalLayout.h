@@ -23,7 +23,9 @@ namespace gd {
  */
 class GD_CORE_API ExternalLayout {
  public:
-  ExternalLayout(){};
+  ExternalLayout() : sharedInstances(NULL){};
+  ExternalLayout(const ExternalLayout& other);
+  ExternalLayout& operator=(const ExternalLayout& other);
   virtual ~ExternalLayout(){};
 
   /**
@@ -31,6 +33,16 @@ class GD_CORE_API ExternalLayout {
    */
   ExternalLayout* Clone() const { return new ExternalLayout(*this); };
 
+  /**
+   * \brief Make the external layout a copy of another one, sharing its
+   * initial instances until they are modified.
+   *
+   * \warning The other external layout must not be modified nor destroyed
+   * while this external layout is used.
+   * \see gd::Layout::CopyOnWriteFrom
+   */
+  void CopyOnWriteFrom(const gd::ExternalLayout& other);
+
   /**
    * \brief Return the name of the external layout.
    */
@@ -45,13 +57,13 @@ class GD_CORE_API ExternalLayout {
    * \brief Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
-    return instances;
+    return sharedInstances ? *sharedInstances : instances;
   }
 
   /**
    * \brief Return the container storing initial instances.
    */
-  gd::InitialInstancesContainer& GetInitialInstances() { return instances; }
+  gd::InitialInstancesContainer& GetInitialInstances();
 
   /**
    * \brief Get the user settings for the IDE.
@@ -92,6 +104,9 @@ class GD_CORE_API ExternalLayout {
  private:
   gd::String name;
   gd::InitialInstancesContainer instances;
+  const gd::InitialInstancesContainer*
+      sharedInstances;  ///< Initial instances of another external layout, used
+                        ///< instead of instances until modified. Can be NULL.
   gd::EditorSettings editorSettings;
   gd::String associatedLayout;
 };
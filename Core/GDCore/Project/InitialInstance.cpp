@@ -6,6 +6,7 @@
 
 #include "GDCore/Project/InitialInstance.h"
 
+#include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
@@ -32,6 +33,26 @@ InitialInstance::InitialInstance()
       locked(false),
       persistentUuid(UUID::MakeUuid4()) {}
 
+void InitialInstance::SetZOrder(int zOrder_) {
+  if (containerLink.container)
+    containerLink.container->RemoveFromZOrderIndex(*this);
+
+  zOrder = zOrder_;
+
+  if (containerLink.container)
+    containerLink.container->AddToZOrderIndex(*this);
+}
+
+void InitialInstance::SetLayer(const gd::String& layer_) {
+  if (containerLink.container)
+    containerLink.container->RemoveFromZOrderIndex(*this);
+
+  layer = layer_;
+
+  if (containerLink.container)
+    containerLink.container->AddToZOrderIndex(*this);
+}
+
 void InitialInstance::UnserializeFrom(const SerializerElement& element) {
   SetObjectName(element.GetStringAttribute("name", "", "nom"));
   SetX(element.GetDoubleAttribute("x"));
@@ -13,6 +13,7 @@ namespace gd {
 class PropertyDescriptor;
 class Project;
 class Layout;
+class InitialInstancesContainer;
 }
 
 namespace gd {
@@ -89,7 +90,7 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Set the Z order of the instance.
    */
-  void SetZOrder(int zOrder_) { zOrder = zOrder_; }
+  void SetZOrder(int zOrder_);
 
   /**
    * \brief Get the layer the instance belongs to.
@@ -99,7 +100,7 @@ class GD_CORE_API InitialInstance {
   /**
    * \brief Set the layer the instance belongs to.
    */
-  void SetLayer(const gd::String& layer_) { layer = layer_; }
+  void SetLayer(const gd::String& layer_);
 
   /**
    * \brief Return true if the instance has a size which is different from its
@@ -252,6 +253,21 @@ class GD_CORE_API InitialInstance {
   ///@}
 
  private:
+  friend class InitialInstancesContainer;
+
+  /**
+   * \brief Pointer to the container owning the instance, used to keep its
+   * Z order index up to date. It is not copied with the instance.
+   */
+  class ContainerLink {
+   public:
+    ContainerLink() : container(nullptr){};
+    ContainerLink(const ContainerLink&) : container(nullptr){};
+    ContainerLink& operator=(const ContainerLink&) { return *this; };
+
+    gd::InitialInstancesContainer* container;
+  };
+
   // More properties can be stored in numberProperties and stringProperties.
   // These properties are then managed by the Object class.
   std::map<gd::String, double>
@@ -271,6 +287,7 @@ class GD_CORE_API InitialInstance {
   gd::VariablesContainer initialVariables;  ///< Instance specific variables
   bool locked;                              ///< True if the instance is locked
   mutable gd::String persistentUuid; ///< A persistent random version 4 UUID, useful for hot reloading.
+  ContainerLink containerLink;  ///< The container owning the instance, if any.
 
   static gd::String*
       badStringProperyValue;  ///< Empty string returned by GetRawStringProperty
@@ -6,19 +6,137 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <new>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/FlatArrays.h"
 
 using namespace std;
 
 namespace gd {
 
+namespace {
+const std::size_t minChunkCapacity = 8;
+const std::size_t maxChunkCapacity = 1024;
+
+bool CompareZOrder(const gd::InitialInstance* a, const gd::InitialInstance* b) {
+  return a->GetZOrder() < b->GetZOrder();
+}
+}  // namespace
+
 gd::InitialInstance InitialInstancesContainer::badPosition;
 
-InitialInstancesContainer::~InitialInstancesContainer() {}
+InitialInstancesContainer::InitialInstancesContainer(
+    const InitialInstancesContainer& other) {
+  Init(other);
+}
+
+InitialInstancesContainer& InitialInstancesContainer::operator=(
+    const InitialInstancesContainer& other) {
+  if (this != &other) {
+    DestroyAllInstances();
+    Init(other);
+  }
+
+  return *this;
+}
+
+InitialInstancesContainer::~InitialInstancesContainer() {
+  DestroyAllInstances();
+}
+
+void InitialInstancesContainer::Init(const InitialInstancesContainer& other) {
+  initialInstances.reserve(other.initialInstances.size());
+  for (const gd::InitialInstance* instance : other.initialInstances) {
+    AddInstance(new (AllocateInstanceSlot(other.initialInstances.size()))
+                    gd::InitialInstance(*instance));
+  }
+}
+
+void* InitialInstancesContainer::AllocateInstanceSlot(
+    std::size_t chunkCapacityHint) {
+  if (!freeSlots.empty()) {
+    gd::InitialInstance* slot = freeSlots.back();
+    freeSlots.pop_back();
+    return slot;
+  }
+
+  if (chunks.empty() || chunks.back().used == chunks.back().capacity) {
+    std::size_t capacity =
+        chunkCapacityHint ? chunkCapacityHint
+                          : (chunks.empty() ? minChunkCapacity
+                                            : std::min(chunks.back().capacity * 2,
+                                                       maxChunkCapacity));
+    capacity = std::max(capacity, minChunkCapacity);
+
+    InstancesChunk chunk;
+    chunk.slots = std::allocator<gd::InitialInstance>().allocate(capacity);
+    chunk.capacity = capacity;
+    chunk.used = 0;
+    chunks.push_back(chunk);
+  }
+
+  InstancesChunk& chunk = chunks.back();
+  return chunk.slots + chunk.used++;
+}
+
+gd::InitialInstance& InitialInstancesContainer::AddInstance(
+    gd::InitialInstance* instance) {
+  instance->containerLink.container = this;
+  initialInstances.push_back(instance);
+  AddToZOrderIndex(*instance);
+
+  return *instance;
+}
+
+void InitialInstancesContainer::DestroyInstance(gd::InitialInstance* instance) {
+  RemoveFromZOrderIndex(*instance);
+  instance->~InitialInstance();
+  freeSlots.push_back(instance);
+}
+
+void InitialInstancesContainer::DestroyAllInstances() {
+  for (gd::InitialInstance* instance : initialInstances)
+    instance->~InitialInstance();
+  for (InstancesChunk& chunk : chunks)
+    std::allocator<gd::InitialInstance>().deallocate(chunk.slots,
+                                                     chunk.capacity);
+
+  initialInstances.clear();
+  chunks.clear();
+  freeSlots.clear();
+  zOrderedInstances.clear();
+}
+
+void InitialInstancesContainer::AddToZOrderIndex(
+    gd::InitialInstance& instance) {
+  auto it = zOrderedInstances.find(instance.GetLayer());
+  if (it == zOrderedInstances.end()) return;
+
+  std::vector<gd::InitialInstance*>& sortedInstances = it->second;
+  sortedInstances.insert(std::upper_bound(sortedInstances.begin(),
+                                          sortedInstances.end(),
+                                          &instance,
+                                          CompareZOrder),
+                         &instance);
+}
+
+void InitialInstancesContainer::RemoveFromZOrderIndex(
+    const gd::InitialInstance& instance) {
+  auto it = zOrderedInstances.find(instance.GetLayer());
+  if (it == zOrderedInstances.end()) return;
+
+  std::vector<gd::InitialInstance*>& sortedInstances = it->second;
+  auto range = std::equal_range(sortedInstances.begin(),
+                                sortedInstances.end(),
+                                &instance,
+                                CompareZOrder);
+  auto found = std::find(range.first, range.second, &instance);
+  if (found != range.second) sortedInstances.erase(found);
+}
 
 std::size_t InitialInstancesContainer::GetInstancesCount() const {
   return initialInstances.size();
@@ -26,68 +144,94 @@ std::size_t InitialInstancesContainer::GetInstancesCount() const {
 
 void InitialInstancesContainer::UnserializeFrom(
     const SerializerElement& element) {
-  initialInstances.clear();
+  DestroyAllInstances();
 
   element.ConsiderAsArrayOf("instance", "Objet");
-  for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
-    gd::InitialInstance instance;
-    instance.UnserializeFrom(element.GetChild(i));
-    initialInstances.push_back(instance);
+  const std::size_t instancesCount = element.GetChildrenCount();
+  initialInstances.reserve(instancesCount);
+
+  // Iterate on the children directly, as getting a child by its index is
+  // O(number of children).
+  for (const auto& child : element.GetAllChildren()) {
+    if (!child.second ||
+        (child.first != "instance" && child.first != "Objet" &&
+         !child.first.empty()))
+      continue;
+
+    // Instances are unserialized in place, in a single chunk of memory.
+    gd::InitialInstance* instance =
+        new (AllocateInstanceSlot(instancesCount)) gd::InitialInstance();
+    instance->UnserializeFrom(*child.second);
+    AddInstance(instance);
   }
 }
 
 void InitialInstancesContainer::IterateOverInstances(
     gd::InitialInstanceFunctor& func) {
-  for (auto& instance : initialInstances) func(instance);
+  // Use an index as the functor can add instances.
+  for (std::size_t i = 0; i < initialInstances.size(); ++i)
+    func(*initialInstances[i]);
 }
 
 void InitialInstancesContainer::IterateOverInstancesWithZOrdering(
     gd::InitialInstanceFunctor& func, const gd::String& layerName) {
-  std::vector<std::reference_wrapper<gd::InitialInstance>> sortedInstances;
-  std::copy_if(initialInstances.begin(),
-               initialInstances.end(),
-               std::inserter(sortedInstances, sortedInstances.begin()),
-               [&layerName](InitialInstance& instance) {
-                 return instance.GetLayer() == layerName;
-               });
-
-  std::sort(sortedInstances.begin(),
-            sortedInstances.end(),
-            [](gd::InitialInstance& a, gd::InitialInstance& b) {
-              return a.GetZOrder() < b.GetZOrder();
-            });
+  auto it = zOrderedInstances.find(layerName);
+  if (it == zOrderedInstances.end()) {
+    std::vector<gd::InitialInstance*> sortedInstances;
+    std::copy_if(initialInstances.begin(),
+                 initialInstances.end(),
+                 std::back_inserter(sortedInstances),
+                 [&layerName](const InitialInstance* instance) {
+                   return instance->GetLayer() == layerName;
+                 });
+    std::stable_sort(
+        sortedInstances.begin(), sortedInstances.end(), CompareZOrder);
+
+    it = zOrderedInstances
+             .insert(std::make_pair(layerName, std::move(sortedInstances)))
+             .first;
+  }
 
-  for (auto& instance : sortedInstances) func(instance);
+  // Iterate over a copy, as the functor can modify the instances (changing
+  // their Z order or layer), and so reorder or erase the index.
+  std::vector<gd::InitialInstance*> sortedInstances = it->second;
+  for (gd::InitialInstance* instance : sortedInstances) func(*instance);
 }
 
 #if defined(GD_IDE_ONLY)
 gd::InitialInstance& InitialInstancesContainer::InsertNewInitialInstance() {
-  gd::InitialInstance newInstance;
-  initialInstances.push_back(newInstance);
-
-  return initialInstances.back();
+  return AddInstance(new (AllocateInstanceSlot()) gd::InitialInstance());
 }
 
 void InitialInstancesContainer::RemoveInstanceIf(
     std::function<bool(const gd::InitialInstance&)> predicat) {
-  // Note that we can't use erase–remove idiom here because remove_if would
-  // move the instances, and the container must guarantee that
-  // iterators/pointers to instances always remain valid.
-  for (std::list<gd::InitialInstance>::iterator it = initialInstances.begin(),
-                                                end = initialInstances.end();
-       it != end;) {
-    if (predicat(*it))
-      it = initialInstances.erase(it);
-    else
-      ++it;
+  // Only the pointers are moved: the container must guarantee that
+  // pointers to the remaining instances always remain valid.
+  std::size_t keptCount = 0;
+  for (std::size_t i = 0; i < initialInstances.size(); ++i) {
+    gd::InitialInstance* instance = initialInstances[i];
+    if (predicat(*instance)) {
+      // The index of the layer is dropped and will be rebuilt when needed,
+      // rather than being updated for each removed instance.
+      zOrderedInstances.erase(instance->GetLayer());
+      DestroyInstance(instance);
+    } else {
+      initialInstances[keptCount++] = instance;
+    }
   }
+
+  initialInstances.resize(keptCount);
 }
 
 void InitialInstancesContainer::RemoveInstance(
     const gd::InitialInstance& instance) {
-  RemoveInstanceIf([&instance](const InitialInstance& currentInstance) {
-    return &instance == &currentInstance;
-  });
+  auto it = std::find(
+      initialInstances.begin(), initialInstances.end(), &instance);
+  if (it == initialInstances.end()) return;
+
+  gd::InitialInstance* instanceToRemove = *it;
+  initialInstances.erase(it);
+  DestroyInstance(instanceToRemove);
 }
 
 gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
@@ -95,9 +239,9 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
   try {
     const gd::InitialInstance& castedInstance =
         dynamic_cast<const gd::InitialInstance&>(instance);
-    initialInstances.push_back(castedInstance);
 
-    return initialInstances.back();
+    return AddInstance(new (AllocateInstanceSlot())
+                           gd::InitialInstance(castedInstance));
   } catch (...) {
     std::cout
         << "WARNING: Tried to add an gd::InitialInstance which is not a GD C++ "
@@ -109,8 +253,8 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
 
 void InitialInstancesContainer::RenameInstancesOfObject(
     const gd::String& oldName, const gd::String& newName) {
-  for (gd::InitialInstance& instance : initialInstances) {
-    if (instance.GetObjectName() == oldName) instance.SetObjectName(newName);
+  for (gd::InitialInstance* instance : initialInstances) {
+    if (instance->GetObjectName() == oldName) instance->SetObjectName(newName);
   }
 }
 
@@ -130,8 +274,12 @@ void InitialInstancesContainer::RemoveAllInstancesOnLayer(
 
 void InitialInstancesContainer::MoveInstancesToLayer(
     const gd::String& fromLayer, const gd::String& toLayer) {
-  for (gd::InitialInstance& instance : initialInstances) {
-    if (instance.GetLayer() == fromLayer) instance.SetLayer(toLayer);
+  // Indexes of both layers are dropped and will be rebuilt when needed,
+  // rather than being updated for each moved instance.
+  zOrderedInstances.erase(fromLayer);
+  zOrderedInstances.erase(toLayer);
+  for (gd::InitialInstance* instance : initialInstances) {
+    if (instance->GetLayer() == fromLayer) instance->SetLayer(toLayer);
   }
 }
 
@@ -139,8 +287,8 @@ bool InitialInstancesContainer::SomeInstancesAreOnLayer(
     const gd::String& layerName) {
   return std::any_of(initialInstances.begin(),
                      initialInstances.end(),
-                     [&layerName](const InitialInstance& currentInstance) {
-                       return currentInstance.GetLayer() == layerName;
+                     [&layerName](const InitialInstance* currentInstance) {
+                       return currentInstance->GetLayer() == layerName;
                      });
 }
 
@@ -148,8 +296,8 @@ bool InitialInstancesContainer::HasInstancesOfObject(
     const gd::String& objectName) {
   return std::any_of(initialInstances.begin(),
                      initialInstances.end(),
-                     [&objectName](const InitialInstance& currentInstance) {
-                       return currentInstance.GetObjectName() == objectName;
+                     [&objectName](const InitialInstance* currentInstance) {
+                       return currentInstance->GetObjectName() == objectName;
                      });
 }
 
@@ -168,11 +316,78 @@ void InitialInstancesContainer::Create(
 
 void InitialInstancesContainer::SerializeTo(SerializerElement& element) const {
   element.ConsiderAsArrayOf("instance");
-  for (auto instance : initialInstances)
-    instance.SerializeTo(element.AddChild("instance"));
+  for (const gd::InitialInstance* instance : initialInstances)
+    instance->SerializeTo(element.AddChild("instance"));
+}
+
+void InitialInstancesContainer::Clear() { DestroyAllInstances(); }
+
+void InitialInstancesContainer::ExportToFlatArrays(
+    gd::FlatArrays& arrays) const {
+  arrays.Reset(InstanceDoublesCount, InstanceIntegersCount);
+  arrays.Resize(initialInstances.size());
+  for (std::size_t i = 0; i < initialInstances.size(); ++i) {
+    const gd::InitialInstance& instance = *initialInstances[i];
+
+    double* doubles = arrays.GetDoubles(i);
+    doubles[InstanceX] = instance.GetX();
+    doubles[InstanceY] = instance.GetY();
+    doubles[InstanceAngle] = instance.GetAngle();
+    doubles[InstanceCustomWidth] = instance.GetCustomWidth();
+    doubles[InstanceCustomHeight] = instance.GetCustomHeight();
+
+    std::int32_t* integers = arrays.GetIntegers(i);
+    integers[InstanceZOrder] = instance.GetZOrder();
+    integers[InstanceLayer] = arrays.AddString(instance.GetLayer());
+    integers[InstanceObjectName] = arrays.AddString(instance.GetObjectName());
+    integers[InstanceFlags] =
+        (instance.IsLocked() ? InstanceLocked : 0) |
+        (instance.HasCustomSize() ? InstanceHasCustomSize : 0);
+  }
 }
 
-void InitialInstancesContainer::Clear() { initialInstances.clear(); }
+void InitialInstancesContainer::ImportFromFlatArrays(
+    const gd::FlatArrays& arrays) {
+  if (arrays.GetDoublesStride() < InstanceDoublesCount ||
+      arrays.GetIntegersStride() < InstanceIntegersCount) {
+    std::cout << "WARNING: Tried to import instances from arrays not having "
+                 "enough values for each instance."
+              << std::endl;
+    return;
+  }
+
+  std::size_t count = arrays.GetElementsCount();
+  for (std::size_t i = count; i < initialInstances.size(); ++i)
+    DestroyInstance(initialInstances[i]);
+  if (initialInstances.size() > count) initialInstances.resize(count);
+
+  initialInstances.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    gd::InitialInstance& instance = i < initialInstances.size()
+                                        ? *initialInstances[i]
+                                        : InsertNewInitialInstance();
+
+    const double* doubles = arrays.GetDoubles(i);
+    instance.SetX(doubles[InstanceX]);
+    instance.SetY(doubles[InstanceY]);
+    instance.SetAngle(doubles[InstanceAngle]);
+    instance.SetCustomWidth(doubles[InstanceCustomWidth]);
+    instance.SetCustomHeight(doubles[InstanceCustomHeight]);
+
+    // Only update the Z order index when needed.
+    const std::int32_t* integers = arrays.GetIntegers(i);
+    if (instance.GetZOrder() != integers[InstanceZOrder])
+      instance.SetZOrder(integers[InstanceZOrder]);
+    const gd::String& layer = arrays.GetString(integers[InstanceLayer]);
+    if (instance.GetLayer() != layer) instance.SetLayer(layer);
+    const gd::String& objectName =
+        arrays.GetString(integers[InstanceObjectName]);
+    if (instance.GetObjectName() != objectName)
+      instance.SetObjectName(objectName);
+    instance.SetLocked(integers[InstanceFlags] & InstanceLocked);
+    instance.SetHasCustomSize(integers[InstanceFlags] & InstanceHasCustomSize);
+  }
+}
 #endif
 
 InitialInstanceFunctor::~InitialInstanceFunctor(){};
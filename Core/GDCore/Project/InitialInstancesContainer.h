@@ -6,7 +6,10 @@
 
 #ifndef GDCORE_INITIALINSTANCESCONTAINER_H
 #define GDCORE_INITIALINSTANCESCONTAINER_H
-#include <list>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -17,6 +20,7 @@ class Project;
 }
 namespace gd {
 class SerializerElement;
+class FlatArrays;
 }
 
 namespace gd {
@@ -28,18 +32,28 @@ namespace gd {
  * to the elements of the container are not invalidated when
  * a change occurs (through InsertNewInitialInstance or RemoveInstance
  * for example). <br>
- * Thus, the implementations uses a std::list
- * for holding the instances. In this way, the container is not required
- * to provide a direct access to element based on an index. Instead,
- * the method IterateOverInstances is used to perform operations.
+ * Thus, the instances are constructed in chunks of memory that are never
+ * moved, and the order of the instances is kept in a separate array of
+ * pointers. The slots of removed instances are reused by the next inserted
+ * ones. The container is not required to provide a direct access to element
+ * based on an index. Instead, the method IterateOverInstances is used to
+ * perform operations.
+ *
+ * For each layer that was iterated with IterateOverInstancesWithZOrdering,
+ * the container also maintains an index of the instances sorted by Z order,
+ * updated when instances are added, removed or when their layer or Z order
+ * is changed.
  *
  * \see gd::InitialInstanceFunctor
  */
 class GD_CORE_API InitialInstancesContainer {
  public:
   InitialInstancesContainer(){};
+  InitialInstancesContainer(const InitialInstancesContainer &other);
   virtual ~InitialInstancesContainer();
 
+  InitialInstancesContainer &operator=(const InitialInstancesContainer &other);
+
   /**
    * \brief Return a pointer to a copy of the container.
    * A such method is needed as the IDE may want to store copies of some
@@ -91,7 +105,11 @@ class GD_CORE_API InitialInstancesContainer {
 
   /**
    * Get the instances on the specified layer,
-   * sort them regarding their Z order and then apply \a func on them.
+   * sorted regarding their Z order, and apply \a func on them.
+   *
+   * \note The instances are sorted only the first time a layer is iterated,
+   * the order is then kept up to date by the container.
+   *
    * \param func The functor to be applied.
    * \param layer The layer
    *
@@ -158,6 +176,58 @@ class GD_CORE_API InitialInstancesContainer {
 #endif
   ///@}
 
+#if defined(GD_IDE_ONLY)
+  /** \name Bulk access
+   * Members functions used to read or update all the instances at once.
+   */
+  ///@{
+
+  /**
+   * \brief The doubles stored for each instance by ExportToFlatArrays.
+   */
+  enum InstanceDouble {
+    InstanceX,
+    InstanceY,
+    InstanceAngle,
+    InstanceCustomWidth,
+    InstanceCustomHeight,
+    InstanceDoublesCount
+  };
+
+  /**
+   * \brief The integers stored for each instance by ExportToFlatArrays. The
+   * layer and the object name are indices in the strings table.
+   */
+  enum InstanceInteger {
+    InstanceZOrder,
+    InstanceLayer,
+    InstanceObjectName,
+    InstanceFlags,
+    InstanceIntegersCount
+  };
+
+  /**
+   * \brief The flags stored in the InstanceFlags integer.
+   */
+  enum InstanceFlag { InstanceLocked = 1, InstanceHasCustomSize = 2 };
+
+  /**
+   * \brief Store the positions, angles, sizes, Z orders, layers and objects of
+   * all the instances in \a arrays, in the order of IterateOverInstances.
+   */
+  void ExportToFlatArrays(gd::FlatArrays &arrays) const;
+
+  /**
+   * \brief Update the instances from values stored like ExportToFlatArrays.
+   *
+   * Each element updates the instance at the same position. New instances are
+   * created for the extra elements, and the instances without element are
+   * removed.
+   */
+  void ImportFromFlatArrays(const gd::FlatArrays &arrays);
+  ///@}
+#endif
+
   /** \name Saving and loading
    * Members functions related to saving and loading the object.
    */
@@ -177,10 +247,57 @@ class GD_CORE_API InitialInstancesContainer {
   ///@}
 
  private:
+  friend class InitialInstance;
+
+  /**
+   * \brief A chunk of memory where instances are constructed. Chunks are never
+   * reallocated so that pointers to instances stay valid.
+   */
+  struct InstancesChunk {
+    gd::InitialInstance *slots;
+    std::size_t capacity;
+    std::size_t used;
+  };
+
+  void Init(const InitialInstancesContainer &other);
+
+  /**
+   * \brief Return uninitialized memory for a new instance, reusing the slot of
+   * a removed instance if possible.
+   */
+  void *AllocateInstanceSlot(std::size_t chunkCapacityHint = 0);
+
+  /**
+   * \brief Register an instance constructed in a slot as owned by the
+   * container, at the end of the list.
+   */
+  gd::InitialInstance &AddInstance(gd::InitialInstance *instance);
+
+  /**
+   * \brief Destroy an instance and give back its slot, without removing it
+   * from the list of instances.
+   */
+  void DestroyInstance(gd::InitialInstance *instance);
+
+  /**
+   * \brief Destroy all the instances and release all the memory.
+   */
+  void DestroyAllInstances();
+
+  void AddToZOrderIndex(gd::InitialInstance &instance);
+  void RemoveFromZOrderIndex(const gd::InitialInstance &instance);
+
   void RemoveInstanceIf(
       std::function<bool(const gd::InitialInstance &)> predicat);
 
-  std::list<gd::InitialInstance> initialInstances;
+  std::vector<gd::InitialInstance *>
+      initialInstances;  ///< The instances, in insertion order.
+  std::vector<InstancesChunk> chunks;  ///< The memory storing the instances.
+  std::vector<gd::InitialInstance *>
+      freeSlots;  ///< Slots of removed instances, to be reused.
+  std::map<gd::String, std::vector<gd::InitialInstance *>>
+      zOrderedInstances;  ///< For each layer already iterated with Z ordering,
+                          ///< the instances sorted by Z order.
 
   static gd::InitialInstance badPosition;
 };
@@ -14,7 +14,12 @@ namespace gd {
 Camera Layer::badCamera;
 
 Layer::Layer()
-    : isVisible(true), isLightingLayer(false), followBaseLayerCamera(false) {}
+    : isVisible(true),
+      isLightingLayer(false),
+      followBaseLayerCamera(false),
+      ambientLightColorR(200),
+      ambientLightColorG(200),
+      ambientLightColorB(200) {}
 
 /**
  * Change cameras count, automatically adding/removing them.
@@ -71,7 +76,7 @@ void Layer::UnserializeFrom(const SerializerElement& element) {
                        element.GetIntAttribute("ambientLightColorB", 200));
 
   cameras.clear();
-  SerializerElement& camerasElement = element.GetChild("cameras");
+  const SerializerElement& camerasElement = element.GetChild("cameras");
   camerasElement.ConsiderAsArrayOf("camera");
   for (std::size_t i = 0; i < camerasElement.GetChildrenCount(); ++i) {
     const SerializerElement& cameraElement = camerasElement.GetChild(i);
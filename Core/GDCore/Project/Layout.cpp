@@ -49,6 +49,7 @@ Layout::Layout()
     : backgroundColorR(209),
       backgroundColorG(209),
       backgroundColorB(209),
+      sharedInitialInstances(NULL),
       stopSoundsOnStartup(true),
       standardSortMethod(true),
       oglFOV(90.0f),
@@ -57,6 +58,7 @@ Layout::Layout()
       disableInputWhenNotFocused(true)
 #if defined(GD_IDE_ONLY)
       ,
+      sharedEvents(NULL),
       profiler(NULL)
 #endif
 {
@@ -65,6 +67,33 @@ Layout::Layout()
   initialLayers.push_back(layer);
 }
 
+void Layout::CopyOnWriteFrom(const gd::Layout& other) {
+  if (this != &other) Init(other, true);
+}
+
+gd::InitialInstancesContainer& Layout::GetInitialInstances() {
+  if (sharedInitialInstances) {
+    initialInstances = *sharedInitialInstances;
+    sharedInitialInstances = NULL;
+  }
+  return initialInstances;
+}
+
+#if defined(GD_IDE_ONLY)
+gd::EventsList& Layout::GetEvents() {
+  if (sharedEvents) {
+    events = *sharedEvents;
+    sharedEvents = NULL;
+  }
+  return events;
+}
+
+void Layout::ClearEvents() {
+  sharedEvents = NULL;
+  events.Clear();
+}
+#endif
+
 void Layout::SetName(const gd::String& name_) {
   name = name_;
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
@@ -279,7 +308,7 @@ void Layout::SerializeTo(SerializerElement& element) const {
   GetVariables().SerializeTo(element.AddChild("variables"));
   GetInitialInstances().SerializeTo(element.AddChild("instances"));
   SerializeObjectsTo(element.AddChild("objects"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(GetEvents(),
                                                  element.AddChild("events"));
 
   SerializeLayersTo(element.AddChild("layers"));
@@ -319,6 +348,10 @@ void Layout::UnserializeLayersFrom(const SerializerElement& element) {
 
 void Layout::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
+  sharedInitialInstances = NULL;
+#if defined(GD_IDE_ONLY)
+  sharedEvents = NULL;
+#endif
   SetBackgroundColor(element.GetIntAttribute("r"),
                      element.GetIntAttribute("v"),
                      element.GetIntAttribute("b"));
@@ -358,11 +391,12 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
   // end of compatibility code
 
-  SerializerElement& behaviorsDataElement =
+  const SerializerElement& behaviorsDataElement =
       element.GetChild("behaviorsSharedData", 0, deprecatedTag1);
   behaviorsDataElement.ConsiderAsArrayOf("behaviorSharedData", deprecatedTag2);
   for (unsigned int i = 0; i < behaviorsDataElement.GetChildrenCount(); ++i) {
-    SerializerElement& sharedDataElement = behaviorsDataElement.GetChild(i);
+    const SerializerElement& sharedDataElement =
+        behaviorsDataElement.GetChild(i);
     gd::String type =
         sharedDataElement.GetStringAttribute("type", "", "Type")
             .FindAndReplace("Automatism",
@@ -386,7 +420,7 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
-void Layout::Init(const Layout& other) {
+void Layout::Init(const Layout& other, bool copyOnWrite) {
   SetName(other.name);
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
@@ -398,7 +432,13 @@ void Layout::Init(const Layout& other) {
   oglZFar = other.oglZFar;
   stopSoundsOnStartup = other.stopSoundsOnStartup;
   disableInputWhenNotFocused = other.disableInputWhenNotFocused;
-  initialInstances = other.initialInstances;
+  if (copyOnWrite) {
+    initialInstances.Clear();
+    sharedInitialInstances = &other.GetInitialInstances();
+  } else {
+    initialInstances = other.GetInitialInstances();
+    sharedInitialInstances = NULL;
+  }
   initialLayers = other.initialLayers;
   variables = other.GetVariables();
 
@@ -411,7 +451,13 @@ void Layout::Init(const Layout& other) {
   }
 
 #if defined(GD_IDE_ONLY)
-  events = other.events;
+  if (copyOnWrite) {
+    events.Clear();
+    sharedEvents = &other.GetEvents();
+  } else {
+    events = other.GetEvents();
+    sharedEvents = NULL;
+  }
   editorSettings = other.editorSettings;
   objectGroups = other.objectGroups;
 
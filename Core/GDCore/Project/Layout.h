@@ -50,6 +50,19 @@ class GD_CORE_API Layout : public ObjectsContainer {
    */
   Layout* Clone() const { return new Layout(*this); };
 
+  /**
+   * \brief Make the layout a copy of another one, sharing its initial
+   * instances and events until they are modified.
+   *
+   * The shared parts are only copied when first accessed through a non const
+   * getter, so that temporary copies (like the ones made for previews and
+   * exports) are cheap.
+   *
+   * \warning The other layout must not be modified nor destroyed while this
+   * layout is used.
+   */
+  void CopyOnWriteFrom(const gd::Layout& other);
+
   /** \name Common properties
    * Members functions related to common properties of layouts
    */
@@ -115,15 +128,13 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
-    return initialInstances;
+    return sharedInitialInstances ? *sharedInitialInstances : initialInstances;
   }
 
   /**
    * Return the container storing initial instances.
    */
-  gd::InitialInstancesContainer& GetInitialInstances() {
-    return initialInstances;
-  }
+  gd::InitialInstancesContainer& GetInitialInstances();
   ///@}
 
   /** \name Layout's events
@@ -135,12 +146,22 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Get the events of the layout
    */
-  const gd::EventsList& GetEvents() const { return events; }
+  const gd::EventsList& GetEvents() const {
+    return sharedEvents ? *sharedEvents : events;
+  }
 
   /**
    * Get the events of the layout
    */
-  gd::EventsList& GetEvents() { return events; }
+  gd::EventsList& GetEvents();
+
+  /**
+   * Remove all the events of the layout.
+   *
+   * \note Prefer this to `GetEvents().Clear()`, which copies the events first
+   * if they are shared with another layout.
+   */
+  void ClearEvents();
 #endif
   ///@}
 
@@ -416,6 +437,10 @@ class GD_CORE_API Layout : public ObjectsContainer {
   gd::String title;                  ///< Title displayed in the window
   gd::VariablesContainer variables;  ///< Variables list
   gd::InitialInstancesContainer initialInstances;  ///< Initial instances
+  const gd::InitialInstancesContainer*
+      sharedInitialInstances;  ///< Initial instances of another layout, used
+                               ///< instead of initialInstances until modified.
+                               ///< Can be NULL.
   std::vector<gd::Layer> initialLayers;            ///< Initial layers
   std::map<gd::String, std::unique_ptr<gd::BehaviorContent>>
       behaviorsSharedData;   ///< Initial shared datas of behaviors
@@ -436,6 +461,9 @@ class GD_CORE_API Layout : public ObjectsContainer {
                            ///< specified behavior shared data.
 #if defined(GD_IDE_ONLY)
   EventsList events;  ///< Scene events
+  const gd::EventsList* sharedEvents;  ///< Events of another layout, used
+                                       ///< instead of events until modified.
+                                       ///< Can be NULL.
   gd::EditorSettings editorSettings;
 #endif
 
@@ -447,8 +475,11 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param copyOnWrite If true, the initial instances and events of the other
+   * layout are shared instead of being copied (see CopyOnWriteFrom).
    */
-  void Init(const gd::Layout& other);
+  void Init(const gd::Layout& other, bool copyOnWrite = false);
 };
 
 /**
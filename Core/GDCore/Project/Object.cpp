@@ -129,7 +129,8 @@ void Object::UnserializeFrom(gd::Project& project,
   // Compatibility with GD <= 3.3
   if (element.HasChild("Automatism")) {
     for (std::size_t i = 0; i < element.GetChildrenCount("Automatism"); ++i) {
-      SerializerElement& behaviorElement = element.GetChild("Automatism", i);
+      const SerializerElement& behaviorElement =
+          element.GetChild("Automatism", i);
 
       gd::String type = behaviorElement.GetStringAttribute("type", "", "Type")
                             .FindAndReplace("Automatism", "Behavior");
@@ -142,11 +143,11 @@ void Object::UnserializeFrom(gd::Project& project,
   }
   // End of compatibility code
   else {
-    SerializerElement& behaviorsElement =
+    const SerializerElement& behaviorsElement =
         element.GetChild("behaviors", 0, "automatisms");
     behaviorsElement.ConsiderAsArrayOf("behavior", "automatism");
     for (std::size_t i = 0; i < behaviorsElement.GetChildrenCount(); ++i) {
-      SerializerElement& behaviorElement = behaviorsElement.GetChild(i);
+      const SerializerElement& behaviorElement = behaviorsElement.GetChild(i);
 
       gd::String type =
           behaviorElement.GetStringAttribute("type").FindAndReplace(
@@ -161,7 +162,7 @@ void Object::UnserializeFrom(gd::Project& project,
       // behavior element).
       if (behaviorElement.HasChild("content") &&
           behaviorElement.GetAllChildren().size() == 3) {
-        SerializerElement& contentElement = behaviorElement.GetChild("content");
+        SerializerElement contentElement = behaviorElement.GetChild("content");
 
         // Physics2 Behavior was using "type" for the type of the body. The name
         // conflicts with the behavior "type". Rename it.
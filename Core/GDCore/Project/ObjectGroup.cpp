@@ -56,7 +56,7 @@ void ObjectGroup::UnserializeFrom(const SerializerElement& element) {
   }
   // End of compatibility code
   else {
-    SerializerElement& objectsElement = element.GetChild("objects");
+    const SerializerElement& objectsElement = element.GetChild("objects");
     objectsElement.ConsiderAsArrayOf("object");
     for (std::size_t j = 0; j < objectsElement.GetChildrenCount(); ++j)
       AddObject(objectsElement.GetChild(j).GetStringAttribute("name"));
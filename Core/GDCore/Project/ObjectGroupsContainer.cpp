@@ -125,7 +125,7 @@ void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
   objectGroups.clear();
   element.ConsiderAsArrayOf("group", "Groupe");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
-    SerializerElement& groupElement = element.GetChild(i);
+    const SerializerElement& groupElement = element.GetChild(i);
     gd::ObjectGroup objectGroup;
 
     objectGroup.UnserializeFrom(groupElement);
@@ -11,6 +11,7 @@
 
 #include <SFML/System/Utf.hpp>
 #include <cctype>
+#include <cstring>
 #include <fstream>
 #include <map>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
 #include "GDCore/Tools/PolymorphicClone.h"
 #include "GDCore/Tools/UUID/UUID.h"
 #include "GDCore/Tools/VersionWrapper.h"
@@ -159,15 +161,23 @@ bool Project::HasLayoutNamed(const gd::String& name) const {
                   bind2nd(gd::LayoutHasName(), name)) != scenes.end());
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
+  gd::Layout& layout = *(*find_if(
       scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  LoadLayoutIfLazy(layout);
+  return layout;
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
+  const gd::Layout& layout = *(*find_if(
       scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  LoadLayoutIfLazy(layout);
+  return layout;
+}
+gd::Layout& Project::GetLayout(std::size_t index) {
+  LoadLayoutIfLazy(*scenes[index]);
+  return *scenes[index];
 }
-gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
+  LoadLayoutIfLazy(*scenes[index]);
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
@@ -212,6 +222,7 @@ void Project::RemoveLayout(const gd::String& name) {
       find_if(scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name));
   if (scene == scenes.end()) return;
 
+  lazyLayouts.erase(scene->get());
   scenes.erase(scene);
 }
 
@@ -624,6 +635,8 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  lazyLayouts.clear();
+  lazyLayoutsData.reset();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -798,6 +811,187 @@ void Project::SerializeTo(SerializerElement& element) const {
         externalSourceFilesElement.AddChild("sourceFile"));
 }
 
+namespace {
+// A binary project starts with this signature, followed by the size of the
+// sections table (on 4 bytes, little endian) and the table itself. Offsets
+// in the table are relative to the end of the table.
+const char binaryProjectSignature[] = "GDP1";
+const std::size_t binaryProjectHeaderSize = 8;
+
+const gd::String projectSectionKind = "project";
+const gd::String layoutSectionKind = "layout";
+const gd::String externalEventsSectionKind = "externalEvents";
+const gd::String eventsFunctionsExtensionSectionKind =
+    "eventsFunctionsExtension";
+
+struct BinaryProjectSection {
+  gd::String kind;
+  gd::String name;
+  std::size_t offset;
+  std::size_t size;
+};
+}  // namespace
+
+void Project::SerializeToBinary(std::string& output) const {
+  SerializerElement element;
+  SerializeTo(element);
+
+  SerializerElement table;
+  table.ConsiderAsArrayOf("section");
+  std::string sectionsData;
+  auto addSection = [&](const gd::String& kind,
+                        const SerializerElement& sectionElement) {
+    std::size_t offset = sectionsData.size();
+    gd::Serializer::ToBinary(sectionElement, sectionsData);
+
+    SerializerElement& sectionEntry = table.AddChild("section");
+    sectionEntry.SetAttribute("kind", kind);
+    sectionEntry.SetAttribute("name",
+                              sectionElement.GetStringAttribute("name"));
+    // Doubles are used as they can represent sizes up to 2^53 exactly.
+    sectionEntry.SetAttribute("offset", static_cast<double>(offset));
+    sectionEntry.SetAttribute(
+        "size", static_cast<double>(sectionsData.size() - offset));
+  };
+  auto extractSections = [&](const gd::String& arrayName,
+                             const gd::String& kind) {
+    for (const auto& child : element.GetChild(arrayName).GetAllChildren())
+      if (child.second) addSection(kind, *child.second);
+
+    element.RemoveChild(arrayName);
+  };
+
+  extractSections("layouts", layoutSectionKind);
+  extractSections("externalEvents", externalEventsSectionKind);
+  extractSections("eventsFunctionsExtensions",
+                  eventsFunctionsExtensionSectionKind);
+  addSection(projectSectionKind, element);
+
+  std::string tableData;
+  gd::Serializer::ToBinary(table, tableData);
+
+  output.append(binaryProjectSignature, 4);
+  for (int i = 0; i < 4; ++i)
+    output.push_back(static_cast<char>((tableData.size() >> (i * 8)) & 0xFF));
+  output.append(tableData);
+  output.append(sectionsData);
+}
+
+bool Project::UnserializeFromBinary(std::shared_ptr<const char> data,
+                                    std::size_t size,
+                                    bool lazyLayoutsLoading) {
+  if (!data || size < binaryProjectHeaderSize ||
+      memcmp(data.get(), binaryProjectSignature, 4) != 0)
+    return false;
+
+  std::size_t tableSize = 0;
+  for (int i = 0; i < 4; ++i)
+    tableSize |= static_cast<std::size_t>(
+                     static_cast<unsigned char>(data.get()[4 + i]))
+                 << (i * 8);
+  if (tableSize > size - binaryProjectHeaderSize) return false;
+
+  SerializerElement table;
+  if (!gd::Serializer::FromBinary(
+          data.get() + binaryProjectHeaderSize, tableSize, table))
+    return false;
+
+  const std::size_t sectionsStart = binaryProjectHeaderSize + tableSize;
+  std::vector<BinaryProjectSection> sections;
+  const BinaryProjectSection* projectSection = nullptr;
+  for (const auto& child : table.GetAllChildren()) {
+    const SerializerElement& sectionEntry = *child.second;
+    BinaryProjectSection section;
+    section.kind = sectionEntry.GetStringAttribute("kind");
+    section.name = sectionEntry.GetStringAttribute("name");
+    section.offset =
+        sectionsStart +
+        static_cast<std::size_t>(sectionEntry.GetDoubleAttribute("offset"));
+    section.size =
+        static_cast<std::size_t>(sectionEntry.GetDoubleAttribute("size"));
+    if (section.offset > size || section.size > size - section.offset)
+      return false;
+
+    sections.push_back(section);
+  }
+  for (const auto& section : sections)
+    if (section.kind == projectSectionKind) projectSection = &section;
+  if (!projectSection) return false;
+
+  SerializerElement element;
+  if (!gd::Serializer::FromBinary(data.get() + projectSection->offset,
+                                  projectSection->size,
+                                  element))
+    return false;
+
+  SerializerElement& layoutsElement = element.AddChild("layouts");
+  layoutsElement.ConsiderAsArrayOf("layout");
+  SerializerElement& externalEventsElement = element.AddChild("externalEvents");
+  externalEventsElement.ConsiderAsArrayOf("externalEvents");
+  SerializerElement& eventsFunctionsExtensionsElement =
+      element.AddChild("eventsFunctionsExtensions");
+  eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
+      "eventsFunctionsExtension");
+  for (const auto& section : sections) {
+    SerializerElement* arrayElement = nullptr;
+    if (section.kind == layoutSectionKind && !lazyLayoutsLoading)
+      arrayElement = &layoutsElement;
+    else if (section.kind == externalEventsSectionKind)
+      arrayElement = &externalEventsElement;
+    else if (section.kind == eventsFunctionsExtensionSectionKind)
+      arrayElement = &eventsFunctionsExtensionsElement;
+    if (!arrayElement) continue;
+
+    if (!gd::Serializer::FromBinary(
+            data.get() + section.offset,
+            section.size,
+            arrayElement->AddChild(arrayElement->ConsideredAsArrayOf())))
+      return false;
+  }
+
+  UnserializeFrom(element);
+
+  if (lazyLayoutsLoading) {
+    for (const auto& section : sections) {
+      if (section.kind != layoutSectionKind) continue;
+
+      gd::Layout& layout = InsertNewLayout(section.name, -1);
+      LazyLayout lazyLayout;
+      lazyLayout.offset = section.offset;
+      lazyLayout.size = section.size;
+      lazyLayouts[&layout] = lazyLayout;
+    }
+    if (!lazyLayouts.empty()) lazyLayoutsData = data;
+  }
+
+  return true;
+}
+
+void Project::LoadLayoutIfLazy(const gd::Layout& layout) const {
+  if (lazyLayouts.empty()) return;
+
+  auto lazyLayoutIt = lazyLayouts.find(&layout);
+  if (lazyLayoutIt == lazyLayouts.end()) return;
+
+  LazyLayout lazyLayout = lazyLayoutIt->second;
+  lazyLayouts.erase(lazyLayoutIt);
+
+  SerializerElement layoutElement;
+  if (gd::Serializer::FromBinary(lazyLayoutsData.get() + lazyLayout.offset,
+                                 lazyLayout.size,
+                                 layoutElement)) {
+    // The layout is considered as already loaded by the project, so it can be
+    // unserialized even if it's accessed from a const method.
+    const_cast<gd::Layout&>(layout).UnserializeFrom(
+        const_cast<gd::Project&>(*this), layoutElement);
+  } else {
+    gd::LogError(_("Unable to load the scene \"") + layout.GetName() +
+                 _("\": its data is invalid. The scene is left empty."));
+  }
+
+  if (lazyLayouts.empty()) lazyLayoutsData.reset();
+}
+
 bool Project::ValidateName(const gd::String& name) {
   if (name.empty()) return false;
 
@@ -824,7 +1018,7 @@ void Project::ExposeResources(gd::ArbitraryResourceWorker& worker) {
          ++j)  // Add objects resources
       GetLayout(s).GetObject(j).ExposeResources(worker);
 
-    LaunchResourceWorkerOnEvents(*this, GetLayout(s).GetEvents(), worker);
+    LaunchResourceWorkerOnLayoutEvents(*this, GetLayout(s), worker);
   }
   // Add external events resources
   for (std::size_t s = 0; s < GetExternalEventsCount(); s++) {
@@ -906,7 +1100,11 @@ Project& Project::operator=(const Project& other) {
   return *this;
 }
 
-void Project::Init(const gd::Project& game) {
+void Project::CopyOnWriteFrom(const gd::Project& project) {
+  if (this != &project) Init(project, true);
+}
+
+void Project::Init(const gd::Project& game, bool copyOnWrite) {
   name = game.name;
   version = game.version;
   windowWidth = game.windowWidth;
@@ -944,11 +1142,33 @@ void Project::Init(const gd::Project& game) {
 
   initialObjects = gd::Clone(game.initialObjects);
 
-  scenes = gd::Clone(game.scenes);
+  scenes.clear();
+  lazyLayouts.clear();
+  for (std::size_t i = 0; i < game.scenes.size(); ++i) {
+    auto lazyLayout = game.lazyLayouts.find(game.scenes[i].get());
+    if (lazyLayout != game.lazyLayouts.end()) {
+      scenes.push_back(gd::Clone(game.scenes[i]));
+      lazyLayouts[scenes[i].get()] = lazyLayout->second;
+    } else if (copyOnWrite) {
+      scenes.push_back(gd::make_unique<gd::Layout>());
+      scenes[i]->CopyOnWriteFrom(*game.scenes[i]);
+    } else {
+      scenes.push_back(gd::Clone(game.scenes[i]));
+    }
+  }
+  lazyLayoutsData = lazyLayouts.empty() ? nullptr : game.lazyLayoutsData;
 
   externalEvents = gd::Clone(game.externalEvents);
 
-  externalLayouts = gd::Clone(game.externalLayouts);
+  if (copyOnWrite) {
+    externalLayouts.clear();
+    for (const auto& externalLayout : game.externalLayouts) {
+      externalLayouts.push_back(gd::make_unique<gd::ExternalLayout>());
+      externalLayouts.back()->CopyOnWriteFrom(*externalLayout);
+    }
+  } else {
+    externalLayouts = gd::Clone(game.externalLayouts);
+  }
   eventsFunctionsExtensions = gd::Clone(game.eventsFunctionsExtensions);
 
   useExternalSourceFiles = game.useExternalSourceFiles;
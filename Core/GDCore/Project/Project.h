@@ -7,6 +7,8 @@
 #ifndef GDCORE_PROJECT_H
 #define GDCORE_PROJECT_H
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Project/ExtensionProperties.h"
@@ -50,6 +52,20 @@ class GD_CORE_API Project : public ObjectsContainer {
   virtual ~Project();
   Project& operator=(const Project& rhs);
 
+  /**
+   * \brief Make the project a copy of another one, sharing the initial
+   * instances and events of its layouts and external layouts until they are
+   * modified.
+   *
+   * This is much cheaper than a copy when only a few parts of the project are
+   * modified, like when exporting it.
+   *
+   * \warning The other project must not be modified nor destroyed while this
+   * project is used.
+   * \see gd::Layout::CopyOnWriteFrom
+   */
+  void CopyOnWriteFrom(const gd::Project& project);
+
   /** \name Common properties
    * Some properties for the project
    */
@@ -508,6 +524,52 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Serialize the project to a binary format, where each layout,
+   * external events and events functions extension is stored in its own
+   * section, listed in a table at the beginning of the data.
+   *
+   * \see gd::Serializer::ToBinary
+   */
+  void SerializeToBinary(std::string& output) const;
+
+  /**
+   * \brief Unserialize the project from data written by SerializeToBinary.
+   *
+   * \param data The binary data. It can be an aliasing pointer to the content
+   * of another object (for example, a gd::MappedFile).
+   * \param size The size of the data.
+   * \param lazyLayoutsLoading If true, layouts are created with only their
+   * names and are unserialized the first time they are returned by GetLayout.
+   * The data is kept until all the layouts are unserialized.
+   * \return false if the data is not a valid binary project.
+   */
+  bool UnserializeFromBinary(std::shared_ptr<const char> data,
+                             std::size_t size,
+                             bool lazyLayoutsLoading = false);
+
+  /**
+   * \brief Unserialize the project from data written by SerializeToBinary.
+   *
+   * \see UnserializeFromBinary
+   */
+  bool UnserializeFromBinary(std::shared_ptr<const std::string> data,
+                             bool lazyLayoutsLoading = false) {
+    std::size_t size = data ? data->size() : 0;
+    return UnserializeFromBinary(
+        std::shared_ptr<const char>(data, data ? data->data() : nullptr),
+        size,
+        lazyLayoutsLoading);
+  }
+
+  /**
+   * \brief Return the number of layouts that were loaded lazily and were not
+   * yet unserialized.
+   *
+   * \see UnserializeFromBinary
+   */
+  std::size_t GetLazyLayoutsCount() const { return lazyLayouts.size(); }
+
   /**
    * Get the major version of GDevelop used to save the project.
    */
@@ -880,8 +942,26 @@ class GD_CORE_API Project : public ObjectsContainer {
   /**
    * Initialize from another game. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param copyOnWrite If true, the contents of the layouts and external
+   * layouts are shared instead of being copied (see CopyOnWriteFrom).
    */
-  void Init(const gd::Project& project);
+  void Init(const gd::Project& project, bool copyOnWrite = false);
+
+  /**
+   * Unserialize the layout if it was loaded lazily and not yet accessed.
+   * \warning Not thread-safe: lazily loaded layouts must be first accessed
+   * from a single thread.
+   */
+  void LoadLayoutIfLazy(const gd::Layout& layout) const;
+
+  /**
+   * \brief The position of a lazily loaded layout in lazyLayoutsData.
+   */
+  struct LazyLayout {
+    std::size_t offset;
+    std::size_t size;
+  };
 
   gd::String name;            ///< Game name
   gd::String version;         ///< Game version number (used for some exports)
@@ -907,6 +987,10 @@ class GD_CORE_API Project : public ObjectsContainer {
                                           ///< found on the layer at the scene
                                           ///< startup.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  mutable std::unordered_map<const gd::Layout*, LazyLayout>
+      lazyLayouts;  ///< Layouts to be unserialized when first accessed.
+  mutable std::shared_ptr<const char>
+      lazyLayoutsData;  ///< The data containing the lazily loaded layouts.
   gd::VariablesContainer variables;  ///< Initial global variables
   std::vector<std::unique_ptr<gd::ExternalLayout> >
       externalLayouts;  ///< List of all externals layouts
@@ -8,7 +8,6 @@
 
 #include <iostream>
 #include <map>
-#include <unordered_set>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/Project.h"
@@ -22,6 +21,15 @@ namespace gd {
 
 gd::String Resource::badStr;
 
+void Resource::SetName(const gd::String& name_) {
+  name = name_;
+  if (managerLink.manager) managerLink.manager->OnResourceNameChanged();
+}
+
+void Resource::NotifyFileChanged() {
+  if (managerLink.manager) managerLink.manager->OnResourceFileChanged();
+}
+
 Resource ResourcesManager::badResource;
 gd::String ResourcesManager::badResourceName;
 #if defined(GD_IDE_ONLY)
@@ -41,9 +49,12 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 #endif
 
 void ResourcesManager::Init(const ResourcesManager& other) {
+  UnlinkResources();
   resources.clear();
+  InvalidateIndexes();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
+    LinkResource(resources.size() - 1);
   }
 #if defined(GD_IDE_ONLY)
   folders.clear();
@@ -53,20 +64,53 @@ void ResourcesManager::Init(const ResourcesManager& other) {
 #endif
 }
 
-Resource& ResourcesManager::GetResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+void ResourcesManager::LinkResource(std::size_t position) {
+  Resource& resource = *resources[position];
+  resource.managerLink.manager = this;
+
+  // Resources are added at the end, so they don't replace any existing entry
+  // of the indexes.
+  if (namesIndexValid) namesIndex.emplace(resource.GetName(), position);
+  if (filesIndexValid) filesIndex.emplace(resource.GetFile(), position);
+}
+
+void ResourcesManager::UnlinkResources() {
+  for (auto& resource : resources) {
+    if (resource && resource->managerLink.manager == this)
+      resource->managerLink.manager = nullptr;
   }
+}
 
-  return badResource;
+void ResourcesManager::UpdateNamesIndex() const {
+  if (namesIndexValid) return;
+
+  namesIndex.clear();
+  namesIndex.reserve(resources.size());
+  for (std::size_t i = 0; i < resources.size(); ++i) {
+    if (resources[i]) namesIndex.emplace(resources[i]->GetName(), i);
+  }
+  namesIndexValid = true;
 }
 
-const Resource& ResourcesManager::GetResource(const gd::String& name) const {
+void ResourcesManager::UpdateFilesIndex() const {
+  if (filesIndexValid) return;
+
+  filesIndex.clear();
+  filesIndex.reserve(resources.size());
   for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+    if (resources[i]) filesIndex.emplace(resources[i]->GetFile(), i);
   }
+  filesIndexValid = true;
+}
 
-  return badResource;
+Resource& ResourcesManager::GetResource(const gd::String& name) {
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? *resources[position] : badResource;
+}
+
+const Resource& ResourcesManager::GetResource(const gd::String& name) const {
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? *resources[position] : badResource;
 }
 
 std::shared_ptr<Resource> ResourcesManager::CreateResource(
@@ -89,11 +133,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return GetResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
@@ -112,15 +152,10 @@ const gd::String& ResourcesManager::GetResourceNameWithOrigin(
 
 const gd::String& ResourcesManager::GetResourceNameWithFile(
     const gd::String& file) const {
-  for (const auto& resource : resources) {
-    if (!resource) continue;
-
-    if (resource->GetFile() == file) {
-      return resource->GetName();
-    }
-  }
-
-  return badResourceName;
+  UpdateFilesIndex();
+  auto it = filesIndex.find(file);
+  return it != filesIndex.end() ? resources[it->second]->GetName()
+                                : badResourceName;
 }
 
 std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
@@ -133,14 +168,11 @@ std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
 
 std::vector<gd::String> ResourcesManager::FindFilesNotInResources(
     const std::vector<gd::String>& filesToCheck) const {
-  std::unordered_set<gd::String> resourceFiles;
-  for (const auto& resource: resources) {
-    resourceFiles.insert(resource->GetFile());
-  }
+  UpdateFilesIndex();
 
   std::vector<gd::String> filesNotInResources;
   for(const gd::String& file: filesToCheck) {
-    if (resourceFiles.find(file) == resourceFiles.end())
+    if (filesIndex.find(file) == filesIndex.end())
       filesNotInResources.push_back(file);
   }
 
@@ -207,6 +239,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
   if (newResource == std::shared_ptr<Resource>()) return false;
 
   resources.push_back(newResource);
+  LinkResource(resources.size() - 1);
   return true;
 }
 
@@ -220,6 +253,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetName(name);
 
   resources.push_back(res);
+  LinkResource(resources.size() - 1);
 
   return true;
 }
@@ -296,19 +330,20 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
+  InvalidateIndexes();
   return gd::MoveResourceUpInList(resources, name);
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
+  InvalidateIndexes();
   return gd::MoveResourceDownInList(resources, name);
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  UpdateNamesIndex();
+  auto it = namesIndex.find(name);
+  return it != namesIndex.end() ? it->second : gd::String::npos;
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -318,6 +353,7 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  InvalidateIndexes();
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -344,11 +380,9 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
-
-  return std::shared_ptr<gd::Resource>();
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? resources[position]
+                                      : std::shared_ptr<gd::Resource>();
 }
 
 bool ResourcesManager::HasFolder(const gd::String& name) const {
@@ -434,11 +468,13 @@ void ResourceFolder::RemoveResource(const gd::String& name) {
 void ResourcesManager::RemoveResource(const gd::String& name) {
   for (std::size_t i = 0; i < resources.size();) {
     if (resources[i] != std::shared_ptr<Resource>() &&
-        resources[i]->GetName() == name)
+        resources[i]->GetName() == name) {
+      resources[i]->managerLink.manager = nullptr;
       resources.erase(resources.begin() + i);
-    else
+    } else
       ++i;
   }
+  InvalidateIndexes();
 
   for (std::size_t i = 0; i < folders.size(); ++i)
     folders[i].RemoveResource(name);
@@ -451,7 +487,7 @@ void ResourceFolder::UnserializeFrom(const SerializerElement& element,
   name = element.GetStringAttribute("name");
 
   resources.clear();
-  SerializerElement& resourcesElement =
+  const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
   for (std::size_t i = 0; i < resourcesElement.GetChildrenCount(); ++i)
@@ -473,7 +509,9 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 #endif
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
+  UnlinkResources();
   resources.clear();
+  InvalidateIndexes();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -498,6 +536,7 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
     resource->UnserializeFrom(resourceElement);
 
     resources.push_back(resource);
+    LinkResource(resources.size() - 1);
   }
 
 #if defined(GD_IDE_ONLY)
@@ -551,6 +590,8 @@ void ImageResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void ImageResource::UnserializeFrom(const SerializerElement& element) {
@@ -575,6 +616,8 @@ void AudioResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void AudioResource::UnserializeFrom(const SerializerElement& element) {
@@ -599,6 +642,8 @@ void FontResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void FontResource::UnserializeFrom(const SerializerElement& element) {
@@ -619,6 +664,8 @@ void VideoResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void VideoResource::UnserializeFrom(const SerializerElement& element) {
@@ -639,6 +686,8 @@ void JsonResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void JsonResource::UnserializeFrom(const SerializerElement& element) {
@@ -680,6 +729,8 @@ void BitmapFontResource::SetFile(const gd::String& newFile) {
   // Convert all backslash to slashs.
   while (file.find('\\') != gd::String::npos)
     file.replace(file.find('\\'), 1, "/");
+
+  NotifyFileChanged();
 }
 
 void BitmapFontResource::UnserializeFrom(const SerializerElement& element) {
@@ -704,7 +755,8 @@ ResourceFolder& ResourceFolder::operator=(const ResourceFolder& other) {
 }
 #endif
 
-ResourcesManager::ResourcesManager(const ResourcesManager& other) {
+ResourcesManager::ResourcesManager(const ResourcesManager& other)
+    : namesIndexValid(false), filesIndexValid(false) {
   Init(other);
 }
 
@@ -714,12 +766,9 @@ ResourcesManager& ResourcesManager::operator=(const ResourcesManager& other) {
   return *this;
 }
 
-ResourcesManager::ResourcesManager() {
-  // ctor
-}
+ResourcesManager::ResourcesManager()
+    : namesIndexValid(false), filesIndexValid(false) {}
 
-ResourcesManager::~ResourcesManager() {
-  // dtor
-}
+ResourcesManager::~ResourcesManager() { UnlinkResources(); }
 
 }  // namespace gd
@@ -7,6 +7,7 @@
 #define GDCORE_RESOURCESMANAGER_H
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -15,6 +16,7 @@ class Project;
 class ResourceFolder;
 class SerializerElement;
 class PropertyDescriptor;
+class ResourcesManager;
 }  // namespace gd
 
 namespace gd {
@@ -32,7 +34,7 @@ class GD_CORE_API Resource {
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_);
 
   /** \brief Return the name of the resource.
    */
@@ -148,7 +150,27 @@ class GD_CORE_API Resource {
    */
   virtual void UnserializeFrom(const SerializerElement& element){};
 
+ protected:
+  /**
+   * \brief Must be called by resources when their file is changed, so that
+   * the resources manager owning them is kept up to date.
+   */
+  void NotifyFileChanged();
+
  private:
+  /**
+   * \brief Pointer to the resources manager owning the resource, used to keep
+   * its indexes up to date. It is not copied with the resource.
+   */
+  class ManagerLink {
+   public:
+    ManagerLink() : manager(nullptr){};
+    ManagerLink(const ManagerLink&) : manager(nullptr){};
+    ManagerLink& operator=(const ManagerLink&) { return *this; };
+
+    gd::ResourcesManager* manager;
+  };
+
   gd::String kind;
   gd::String name;
   gd::String metadata;
@@ -156,8 +178,11 @@ class GD_CORE_API Resource {
   gd::String originIdentifier;
   bool userAdded;  ///< True if the resource was added by the user, and not
                    ///< automatically by GDevelop.
+  ManagerLink managerLink;  ///< The manager owning the resource, if any.
 
   static gd::String badStr;
+
+  friend class ResourcesManager;
 };
 
 /**
@@ -567,11 +592,48 @@ class GD_CORE_API ResourcesManager {
  private:
   void Init(const ResourcesManager& other);
 
+  /**
+   * \brief Link a resource added to the list to this manager, and add it to
+   * the indexes.
+   */
+  void LinkResource(std::size_t position);
+
+  /**
+   * \brief Unlink all the resources from this manager, before they are
+   * removed or when the manager is destroyed.
+   */
+  void UnlinkResources();
+
+  /**
+   * \brief Mark indexes as to be rebuilt at the next lookup, after resources
+   * were moved, removed or renamed.
+   */
+  void InvalidateIndexes() {
+    namesIndexValid = false;
+    filesIndexValid = false;
+  };
+
+  void UpdateNamesIndex() const;
+  void UpdateFilesIndex() const;
+
+  // Called by resources when they are changed.
+  void OnResourceNameChanged() { namesIndexValid = false; };
+  void OnResourceFileChanged() { filesIndexValid = false; };
+
   std::vector<std::shared_ptr<Resource> > resources;
 #if defined(GD_IDE_ONLY)
   std::vector<ResourceFolder> folders;
 #endif
 
+  mutable std::unordered_map<gd::String, std::size_t>
+      namesIndex;  ///< Position of the resources, by name.
+  mutable std::unordered_map<gd::String, std::size_t>
+      filesIndex;  ///< Position of the first resource using a file.
+  mutable bool namesIndexValid;
+  mutable bool filesIndexValid;
+
+  friend class Resource;
+
 #if defined(GD_IDE_ONLY)
   static ResourceFolder badFolder;
 #endif
@@ -6,10 +6,12 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include <algorithm>
 #include <iostream>
+#include <unordered_map>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/TinyXml/tinyxml.h"
+#include "GDCore/Tools/FlatArrays.h"
 
 namespace gd {
 
@@ -157,6 +159,81 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
 }
+
+void VariablesContainer::ExportToFlatArrays(gd::FlatArrays& arrays) const {
+  arrays.Reset(VariableDoublesCount, VariableIntegersCount);
+  arrays.Resize(variables.size());
+  for (std::size_t i = 0; i < variables.size(); ++i) {
+    const gd::Variable& variable = *variables[i].second;
+    gd::Variable::Type type = variable.GetType();
+
+    double* doubles = arrays.GetDoubles(i);
+    doubles[VariableValue] =
+        type == gd::Variable::Number
+            ? variable.GetValue()
+            : (type == gd::Variable::Boolean && variable.GetBool() ? 1 : 0);
+
+    std::int32_t* integers = arrays.GetIntegers(i);
+    integers[VariableName] = arrays.AddString(variables[i].first);
+    integers[VariableType] = type;
+    integers[VariableString] = type == gd::Variable::String
+                                   ? arrays.AddString(variable.GetString())
+                                   : -1;
+  }
+}
+
+void VariablesContainer::ImportFromFlatArrays(const gd::FlatArrays& arrays) {
+  if (arrays.GetDoublesStride() < VariableDoublesCount ||
+      arrays.GetIntegersStride() < VariableIntegersCount) {
+    std::cout << "WARNING: Tried to import variables from arrays not having "
+                 "enough values for each variable."
+              << std::endl;
+    return;
+  }
+
+  // Existing variables are kept, so that references to them stay valid.
+  std::unordered_map<gd::String, std::shared_ptr<gd::Variable>>
+      existingVariables;
+  for (auto& nameAndVariable : variables)
+    existingVariables[nameAndVariable.first] = nameAndVariable.second;
+
+  std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>>
+      newVariables;
+  newVariables.reserve(arrays.GetElementsCount());
+  for (std::size_t i = 0; i < arrays.GetElementsCount(); ++i) {
+    const double* doubles = arrays.GetDoubles(i);
+    const std::int32_t* integers = arrays.GetIntegers(i);
+    const gd::String& name = arrays.GetString(integers[VariableName]);
+
+    std::shared_ptr<gd::Variable> variable;
+    auto it = existingVariables.find(name);
+    if (it != existingVariables.end()) {
+      variable = it->second;
+      existingVariables.erase(it);  // Each variable is used only once.
+    } else {
+      variable = std::make_shared<gd::Variable>();
+    }
+
+    switch (integers[VariableType]) {
+      case gd::Variable::String:
+        variable->SetString(arrays.GetString(integers[VariableString]));
+        break;
+      case gd::Variable::Boolean:
+        variable->SetBool(doubles[VariableValue] != 0);
+        break;
+      case gd::Variable::Structure:
+      case gd::Variable::Array:
+        if (variable->GetType() != integers[VariableType])
+          variable->CastTo((gd::Variable::Type)integers[VariableType]);
+        break;
+      default:
+        variable->SetValue(doubles[VariableValue]);
+    }
+    newVariables.push_back(std::make_pair(name, variable));
+  }
+
+  variables = std::move(newVariables);
+}
 #endif
 
 void VariablesContainer::SerializeTo(SerializerElement& element) const {
@@ -12,6 +12,7 @@
 #include "GDCore/String.h"
 namespace gd {
 class SerializerElement;
+class FlatArrays;
 }
 class TiXmlElement;
 
@@ -139,6 +140,46 @@ class GD_CORE_API VariablesContainer {
   inline void Clear() { variables.clear(); }
   ///@}
 
+#if defined(GD_IDE_ONLY)
+  /** \name Bulk access
+   * Members functions used to read or update all the variables at once.
+   */
+  ///@{
+
+  /**
+   * \brief The doubles stored for each variable by ExportToFlatArrays: the
+   * value of a number, or 1 or 0 for a boolean.
+   */
+  enum VariableDouble { VariableValue, VariableDoublesCount };
+
+  /**
+   * \brief The integers stored for each variable by ExportToFlatArrays. The
+   * name and the string are indices in the strings table (the string is -1 if
+   * the variable is not a string).
+   */
+  enum VariableInteger {
+    VariableName,
+    VariableType,
+    VariableString,
+    VariableIntegersCount
+  };
+
+  /**
+   * \brief Store the names, types and values of the variables in \a arrays.
+   * Children of structures and arrays are not stored.
+   */
+  void ExportToFlatArrays(gd::FlatArrays& arrays) const;
+
+  /**
+   * \brief Set the variables from values stored like ExportToFlatArrays.
+   *
+   * Variables are ordered like the elements, and the variables without
+   * element are removed. Existing structures and arrays keep their children.
+   */
+  void ImportFromFlatArrays(const gd::FlatArrays& arrays);
+  ///@}
+#endif
+
   /** \name Saving and loading
    * Members functions related to saving and loading the object.
    */
@@ -6,15 +6,22 @@
 
 #include "GDCore/Serialization/Serializer.h"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/Log.h"
 #include "rapidjson/document.h"
+#include "rapidjson/error/en.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
 #if !defined(EMSCRIPTEN)
@@ -142,22 +149,36 @@ void RapidJsonValueToElement(const Value& value,
   }
 }
 
+void ValueToRapidJson(const gd::SerializerValue& serializerValue,
+                      Value& value,
+                      Document::AllocatorType& allocator) {
+  switch (serializerValue.GetType()) {
+    case SerializerValue::Boolean:
+      value.SetBool(serializerValue.GetRawBool());
+      break;
+    case SerializerValue::Double:
+      value.SetDouble(serializerValue.GetRawDouble());
+      break;
+    case SerializerValue::Int:
+      value.SetInt(serializerValue.GetRawInt());
+      break;
+    case SerializerValue::String: {
+      // This does a copy of the string, without measuring its length.
+      const std::string& str = serializerValue.GetRawString().Raw();
+      value.SetString(
+          str.c_str(), static_cast<SizeType>(str.size()), allocator);
+      break;
+    }
+    default:
+      break;  // Values of unknown type are not written.
+  }
+}
+
 void ElementToRapidJson(const gd::SerializerElement& element,
                         Value& value,
                         Document::AllocatorType& allocator) {
   if (!element.IsValueUndefined()) {
-    const SerializerValue& serializerValue = element.GetValue();
-    // TODO: use GetRaw to avoid conversions
-    if (serializerValue.IsBoolean())
-      value.SetBool(serializerValue.GetBool());
-    else if (serializerValue.IsDouble())
-      value.SetDouble(serializerValue.GetDouble());
-    else if (serializerValue.IsInt())
-      value.SetInt(serializerValue.GetInt());
-    else if (serializerValue.IsString()) {
-      // This does a copy of the string, and measure the string length.
-      value.SetString(serializerValue.GetRawString().c_str(), allocator);
-    }
+    ValueToRapidJson(element.GetValue(), value, allocator);
   } else if (element.ConsideredAsArray()) {
     value.SetArray();
 
@@ -179,7 +200,7 @@ void ElementToRapidJson(const gd::SerializerElement& element,
       Value name(attribute.first.c_str(),
                  allocator);  // Copying the name is required.
       Value childValue;
-      ElementToRapidJson(attribute.second, childValue, allocator);
+      ValueToRapidJson(attribute.second, childValue, allocator);
       value.AddMember(name, childValue, allocator);
     }
     for (const auto& child : children) {
@@ -191,26 +212,51 @@ void ElementToRapidJson(const gd::SerializerElement& element,
     }
   }
 }
+
+void LogParseError(const Document& document) {
+  gd::LogError(_("Unable to parse JSON: ") +
+               gd::String(GetParseError_En(document.GetParseError())) +
+               _(" (at offset ") +
+               gd::String::From(document.GetErrorOffset()) + ")");
+}
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
-  SerializerElement element;
   size_t len = strlen(json);
-  if (len != 0) {
-    Document document;
+  if (len == 0) return SerializerElement();
 
-    // In-situ parsing, decode strings directly in the source string. Source
-    // must be string.
-    char buffer[len + 1];
-    memcpy(buffer, json, len + 1);
-    if (document.ParseInsitu(buffer).HasParseError()) {
-      std::cout << "TODO: error while parsing" << std::endl;
-      return element;
-    }
+  // In-situ parsing, decode strings directly in a copy of the source string.
+  // The buffer is allocated on the heap as projects can be larger than the
+  // stack.
+  std::vector<char> buffer(json, json + len + 1);
+  return FromJSONInSitu(buffer.data());
+}
 
-    RapidJsonValueToElement(document, element);
+SerializerElement Serializer::FromJSONInSitu(char* json) {
+  SerializerElement element;
+  if (json[0] == '\0') return element;
+
+  Document document;
+  if (document.ParseInsitu(json).HasParseError()) {
+    LogParseError(document);
+    return element;
+  }
+
+  RapidJsonValueToElement(document, element);
+  return element;
+}
+
+SerializerElement Serializer::FromJSON(const char* json, std::size_t length) {
+  SerializerElement element;
+  if (length == 0) return element;
+
+  Document document;
+  if (document.Parse(json, length).HasParseError()) {
+    LogParseError(document);
+    return element;
   }
 
+  RapidJsonValueToElement(document, element);
   return element;
 }
 
@@ -227,4 +273,296 @@ gd::String Serializer::ToJSON(const SerializerElement& element) {
   return buffer.GetString();  // Temporary copy
 }
 
+namespace {
+// See Serializer::BinaryFormat for the description of these constants.
+const unsigned char undefinedValueType = Serializer::BinaryUndefinedValueType;
+const unsigned char integralDoubleValueType =
+    Serializer::BinaryIntegralDoubleValueType;
+const unsigned char valueTypeMask = Serializer::BinaryValueTypeMask;
+const unsigned char isArrayFlag = Serializer::BinaryIsArrayFlag;
+const unsigned char hasAttributesFlag = Serializer::BinaryHasAttributesFlag;
+const unsigned char hasChildrenFlag = Serializer::BinaryHasChildrenFlag;
+const std::size_t maxSharedStringSize = Serializer::BinaryMaxSharedStringSize;
+
+// Elements nested deeper than this are considered as invalid data, so that
+// reading them can't overflow the stack.
+const std::size_t maxElementsDepth = 1024;
+
+uint64_t ToZigZag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+int64_t FromZigZag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+bool IsIntegralDouble(double value) {
+  return value >= INT32_MIN && value <= INT32_MAX &&
+         value == static_cast<double>(static_cast<int32_t>(value)) &&
+         !(value == 0 && std::signbit(value));
+}
+
+class BinaryWriter {
+ public:
+  BinaryWriter(std::string& output_) : output(output_){};
+
+  void WriteElement(const SerializerElement& element) {
+    const auto& attributes = element.GetAllAttributes();
+    const auto& children = element.GetAllChildren();
+    std::size_t childrenCount = 0;
+    for (const auto& child : children)
+      if (child.second) childrenCount++;
+
+    unsigned char header =
+        element.IsValueUndefined() ? undefinedValueType
+                                   : GetValueType(element.GetValue());
+    if (element.ConsideredAsArray()) header |= isArrayFlag;
+    if (!attributes.empty()) header |= hasAttributesFlag;
+    if (childrenCount) header |= hasChildrenFlag;
+    output.push_back(static_cast<char>(header));
+
+    if (!element.IsValueUndefined()) WriteValuePayload(element.GetValue());
+    if (element.ConsideredAsArray()) WriteString(element.ConsideredAsArrayOf());
+
+    if (!attributes.empty()) {
+      WriteSize(attributes.size());
+      for (const auto& attribute : attributes) {
+        WriteString(attribute.first);
+        output.push_back(static_cast<char>(GetValueType(attribute.second)));
+        WriteValuePayload(attribute.second);
+      }
+    }
+
+    if (childrenCount) {
+      WriteSize(childrenCount);
+      for (const auto& child : children) {
+        if (!child.second) continue;
+
+        // Children of arrays are all named after the array elements.
+        if (!element.ConsideredAsArray()) WriteString(child.first);
+        WriteElement(*child.second);
+      }
+    }
+  }
+
+ private:
+  void WriteSize(uint64_t size) {
+    // Sizes are stored on 7 bits per byte, the high bit telling if there is
+    // another byte.
+    while (size >= 0x80) {
+      output.push_back(static_cast<char>((size & 0x7F) | 0x80));
+      size >>= 7;
+    }
+    output.push_back(static_cast<char>(size));
+  }
+
+  void WriteString(const gd::String& str) {
+    const std::string& rawString = str.Raw();
+    if (rawString.size() <= maxSharedStringSize) {
+      auto existingString = sharedStrings.find(rawString);
+      if (existingString != sharedStrings.end()) {
+        WriteSize((existingString->second << 1) | 1);
+        return;
+      }
+
+      std::size_t index = sharedStrings.size();
+      sharedStrings[rawString] = index;
+    }
+
+    WriteSize(rawString.size() << 1);
+    output.append(rawString);
+  }
+
+  unsigned char GetValueType(const SerializerValue& value) {
+    if (value.GetType() == SerializerValue::Double &&
+        IsIntegralDouble(value.GetRawDouble()))
+      return integralDoubleValueType;
+
+    return value.GetType();
+  }
+
+  void WriteValuePayload(const SerializerValue& value) {
+    switch (GetValueType(value)) {
+      case SerializerValue::Boolean:
+        output.push_back(value.GetRawBool() ? 1 : 0);
+        break;
+      case SerializerValue::Int:
+        WriteSize(ToZigZag(value.GetRawInt()));
+        break;
+      case integralDoubleValueType:
+        WriteSize(ToZigZag(static_cast<int32_t>(value.GetRawDouble())));
+        break;
+      case SerializerValue::Double: {
+        double doubleValue = value.GetRawDouble();
+        uint64_t bits;
+        memcpy(&bits, &doubleValue, sizeof(bits));
+        for (int i = 0; i < 8; ++i)
+          output.push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+        break;
+      }
+      default:
+        WriteString(value.GetRawString());
+        break;
+    }
+  }
+
+  std::string& output;
+  std::unordered_map<std::string, std::size_t> sharedStrings;
+};
+
+/**
+ * \brief Read the data written by BinaryWriter, stopping at the first invalid
+ * data.
+ */
+class BinaryReader {
+ public:
+  BinaryReader(const char* data_, std::size_t size)
+      : data(reinterpret_cast<const unsigned char*>(data_)),
+        end(data + size),
+        valid(true){};
+
+  bool IsValid() const { return valid; }
+
+  void ReadElement(SerializerElement& element, std::size_t depth = 0) {
+    if (depth > maxElementsDepth) {
+      valid = false;
+      return;
+    }
+
+    unsigned char header = ReadByte();
+    unsigned char valueType = header & valueTypeMask;
+    if (valueType != undefinedValueType) {
+      SerializerValue value;
+      ReadValue(valueType, value);
+      element.SetValue(value);
+    }
+
+    bool isArray = header & isArrayFlag;
+    if (isArray) element.ConsiderAsArrayOf(ReadString());
+
+    if (header & hasAttributesFlag) {
+      uint64_t attributesCount = ReadSize();
+      for (uint64_t i = 0; i < attributesCount && valid; ++i) {
+        gd::String name = ReadString();
+        SerializerValue value;
+        ReadValue(ReadByte(), value);
+        if (value.IsBoolean())
+          element.SetAttribute(name, value.GetRawBool());
+        else if (value.IsInt())
+          element.SetAttribute(name, value.GetRawInt());
+        else if (value.IsDouble())
+          element.SetAttribute(name, value.GetRawDouble());
+        else
+          element.SetAttribute(name, value.GetRawString());
+      }
+    }
+
+    if (header & hasChildrenFlag) {
+      uint64_t childrenCount = ReadSize();
+      for (uint64_t i = 0; i < childrenCount && valid; ++i) {
+        gd::String name =
+            isArray ? element.ConsideredAsArrayOf() : ReadString();
+        ReadElement(element.AddChild(name), depth + 1);
+      }
+    }
+  }
+
+ private:
+  unsigned char ReadByte() {
+    if (data >= end) {
+      valid = false;
+      return 0;
+    }
+    return *(data++);
+  }
+
+  uint64_t ReadSize() {
+    uint64_t size = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+      unsigned char byte = ReadByte();
+      size |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return size;
+    }
+
+    valid = false;
+    return 0;
+  }
+
+  gd::String ReadString() {
+    uint64_t header = ReadSize();
+    if (header & 1) {
+      uint64_t index = header >> 1;
+      if (index >= sharedStrings.size()) {
+        valid = false;
+        return "";
+      }
+      return sharedStrings[index];
+    }
+
+    uint64_t size = header >> 1;
+    if (!valid || size > static_cast<uint64_t>(end - data)) {
+      valid = false;
+      return "";
+    }
+
+    gd::String str;
+    str.Raw().assign(reinterpret_cast<const char*>(data), size);
+    data += size;
+    if (size <= maxSharedStringSize) sharedStrings.push_back(str);
+    return str;
+  }
+
+  void ReadValue(unsigned char type, SerializerValue& value) {
+    switch (type) {
+      case SerializerValue::Boolean:
+        value.SetBool(ReadByte() != 0);
+        break;
+      case SerializerValue::Int:
+        value.SetInt(static_cast<int>(FromZigZag(ReadSize())));
+        break;
+      case integralDoubleValueType:
+        value.SetDouble(static_cast<double>(FromZigZag(ReadSize())));
+        break;
+      case SerializerValue::Double: {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i)
+          bits |= static_cast<uint64_t>(ReadByte()) << (i * 8);
+        double doubleValue;
+        memcpy(&doubleValue, &bits, sizeof(bits));
+        value.SetDouble(doubleValue);
+        break;
+      }
+      case SerializerValue::String:
+        value.SetString(ReadString());
+        break;
+      case SerializerValue::Unknown:
+        value.Set(ReadString());
+        break;
+      default:
+        valid = false;
+        break;
+    }
+  }
+
+  const unsigned char* data;
+  const unsigned char* end;
+  bool valid;
+  std::vector<gd::String> sharedStrings;
+};
+}  // namespace
+
+void Serializer::ToBinary(const SerializerElement& element,
+                          std::string& output) {
+  BinaryWriter writer(output);
+  writer.WriteElement(element);
+}
+
+bool Serializer::FromBinary(const char* data,
+                            std::size_t size,
+                            SerializerElement& element) {
+  BinaryReader reader(data, size);
+  reader.ReadElement(element);
+  return reader.IsValid();
+}
+
 }  // namespace gd
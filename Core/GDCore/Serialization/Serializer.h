@@ -14,7 +14,7 @@ namespace gd {
 
 /**
  * \brief The class used to save/load projects and GDCore classes
- * from/to XML or JSON.
+ * from/to XML, JSON or a binary format.
  */
 class GD_CORE_API Serializer {
  public:
@@ -55,6 +55,66 @@ class GD_CORE_API Serializer {
   static SerializerElement FromJSON(const gd::String& json) {
     return FromJSON(json.c_str());
   }
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string of the given
+   * length, without copying it (for example, a file mapped in memory).
+   *
+   * The string does not need to be null-terminated.
+   */
+  static SerializerElement FromJSON(const char* json, std::size_t length);
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string, decoding the
+   * strings directly in it: the content of \a json is modified.
+   *
+   * \param json A null-terminated string, which can be discarded after the
+   * call.
+   */
+  static SerializerElement FromJSONInSitu(char* json);
+  ///@}
+
+  /** \name Binary serialization.
+   * Convert a gd::SerializerElement from/to a compact binary format, faster
+   * to read than JSON. Strings are stored with their length and values keep
+   * their types.
+   */
+  ///@{
+  /**
+   * \brief Append the binary representation of a gd::SerializerElement to
+   * \a output.
+   */
+  static void ToBinary(const SerializerElement& element, std::string& output);
+
+  /**
+   * \brief Read a gd::SerializerElement written by ToBinary.
+   *
+   * \return false if the data is not a valid element (including if elements
+   * are nested too deeply).
+   */
+  static bool FromBinary(const char* data,
+                         std::size_t size,
+                         SerializerElement& element);
+
+  /**
+   * \brief Constants of the binary format, also used by the encoder and
+   * decoder of libGD.js.
+   */
+  enum BinaryFormat {
+    /// Each element starts with a byte made of the type of its value (3 bits)
+    /// and flags telling if it's an array and if it has attributes and
+    /// children. The value types are the ones of gd::SerializerValue::Type,
+    /// and:
+    BinaryUndefinedValueType = 7,
+    BinaryIntegralDoubleValueType = 5,  ///< A double stored as an integer.
+    BinaryValueTypeMask = 0x07,
+    BinaryIsArrayFlag = 0x08,
+    BinaryHasAttributesFlag = 0x10,
+    BinaryHasChildrenFlag = 0x20,
+    /// Strings up to this size are stored only once, and then referred to by
+    /// their index (as names of children and attributes are repeated a lot).
+    BinaryMaxSharedStringSize = 32
+  };
   ///@}
 
   virtual ~Serializer(){};
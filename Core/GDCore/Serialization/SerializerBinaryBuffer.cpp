@@ -0,0 +1,22 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/SerializerBinaryBuffer.h"
+
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+void SerializerBinaryBuffer::WriteElement(const SerializerElement& element) {
+  data.clear();
+  Serializer::ToBinary(element, data);
+}
+
+bool SerializerBinaryBuffer::ReadElement(SerializerElement& element) const {
+  return Serializer::FromBinary(data.data(), data.size(), element);
+}
+
+}  // namespace gd
@@ -0,0 +1,66 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SERIALIZERBINARYBUFFER_H
+#define GDCORE_SERIALIZERBINARYBUFFER_H
+#include <string>
+
+namespace gd {
+class SerializerElement;
+}
+
+namespace gd {
+
+/**
+ * \brief A buffer storing a gd::SerializerElement in the binary format of
+ * gd::Serializer::ToBinary.
+ *
+ * This is used to move a whole tree of elements from/to JavaScript in a single
+ * call: the buffer memory is read or written directly from JavaScript (using a
+ * typed array viewing the memory of libGD.js) and only converted once from/to
+ * an element.
+ *
+ * \see gd::Serializer::ToBinary
+ * \ingroup Serialization
+ */
+class GD_CORE_API SerializerBinaryBuffer {
+ public:
+  SerializerBinaryBuffer(){};
+  virtual ~SerializerBinaryBuffer(){};
+
+  /**
+   * \brief Replace the content of the buffer by the binary representation of
+   * the element.
+   */
+  void WriteElement(const SerializerElement& element);
+
+  /**
+   * \brief Read the element stored in the buffer.
+   *
+   * \return false if the buffer does not contain a valid element.
+   */
+  bool ReadElement(SerializerElement& element) const;
+
+  /**
+   * \brief Change the size of the buffer, so that its data can be written
+   * before calling ReadElement.
+   */
+  void Resize(std::size_t size) { data.resize(size); }
+
+  /** \name Raw access
+   * Members functions used to read or write the buffer without copying it.
+   */
+  ///@{
+  char* GetData() { return &data[0]; }
+  std::size_t GetSize() const { return data.size(); }
+  ///@}
+
+ private:
+  std::string data;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SERIALIZERBINARYBUFFER_H
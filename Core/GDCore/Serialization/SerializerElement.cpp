@@ -1,15 +1,55 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
 #include <iostream>
+#include <utility>
 
 namespace gd {
 
+#if !defined(EMSCRIPTEN)
+thread_local SerializerElement SerializerElement::nullElement;
+#else
 SerializerElement SerializerElement::nullElement;
+#endif
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true), isArray(false), copyOnWrite(false) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      isArray(false),
+      copyOnWrite(false) {}
+
+SerializerElement::SerializerElement(gd::SerializerElement&& other) noexcept
+    : valueUndefined(other.valueUndefined),
+      elementValue(std::move(other.elementValue)),
+      attributes(std::move(other.attributes)),
+      children(std::move(other.children)),
+      isArray(other.isArray),
+      arrayOf(std::move(other.arrayOf)),
+      deprecatedArrayOf(std::move(other.deprecatedArrayOf)),
+      copyOnWrite(other.copyOnWrite) {
+  other.valueUndefined = true;
+  other.children.clear();
+}
+
+SerializerElement& SerializerElement::operator=(
+    gd::SerializerElement&& other) noexcept {
+  if (this == &other) return *this;
+
+  valueUndefined = other.valueUndefined;
+  elementValue = std::move(other.elementValue);
+  attributes = std::move(other.attributes);
+  children = std::move(other.children);
+  isArray = other.isArray;
+  arrayOf = std::move(other.arrayOf);
+  deprecatedArrayOf = std::move(other.deprecatedArrayOf);
+  copyOnWrite = other.copyOnWrite;
+
+  other.valueUndefined = true;
+  other.children.clear();
+  return *this;
+}
 
 SerializerElement::~SerializerElement() {}
 
@@ -70,7 +110,7 @@ bool SerializerElement::GetBoolAttribute(const gd::String& name,
     return attributes.find(deprecatedName)->second.GetBool();
   } else {
     if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+      const SerializerElement& child = GetChild(name, 0, deprecatedName);
       if (!child.IsValueUndefined()) {
         return child.GetValue().GetBool();
       }
@@ -93,7 +133,7 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
     return attributes.find(deprecatedName)->second.GetString();
   else {
     if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+      const SerializerElement& child = GetChild(name, 0, deprecatedName);
       if (!child.IsValueUndefined()) return child.GetValue().GetString();
     }
   }
@@ -111,7 +151,7 @@ int SerializerElement::GetIntAttribute(const gd::String& name,
     return attributes.find(deprecatedName)->second.GetInt();
   else {
     if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+      const SerializerElement& child = GetChild(name, 0, deprecatedName);
       if (!child.IsValueUndefined()) return child.GetValue().GetInt();
     }
   }
@@ -129,7 +169,7 @@ double SerializerElement::GetDoubleAttribute(const gd::String& name,
     return attributes.find(deprecatedName)->second.GetDouble();
   else {
     if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+      const SerializerElement& child = GetChild(name, 0, deprecatedName);
       if (!child.IsValueUndefined()) return child.GetValue().GetDouble();
     }
   }
@@ -162,17 +202,52 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
   }
 
   std::shared_ptr<SerializerElement> newElement(new SerializerElement);
+  newElement->copyOnWrite = copyOnWrite;
   children.push_back(std::make_pair(name, newElement));
 
   return *newElement;
 }
 
-SerializerElement& SerializerElement::GetChild(std::size_t index) const {
+const SerializerElement& SerializerElement::GetChild(
+    std::size_t index) const {
+  std::size_t position = GetChildPosition(index);
+  if (position >= children.size()) return nullElement;
+
+  return *children[position].second;
+}
+
+SerializerElement& SerializerElement::GetChild(std::size_t index) {
+  std::size_t position = GetChildPosition(index);
+  if (position >= children.size()) return nullElement;
+
+  UnshareChild(position);
+  return *children[position].second;
+}
+
+const SerializerElement& SerializerElement::GetChild(
+    gd::String name, std::size_t index, gd::String deprecatedName) const {
+  std::size_t position = GetChildPosition(name, index, deprecatedName);
+  if (position >= children.size()) return nullElement;
+
+  return *children[position].second;
+}
+
+SerializerElement& SerializerElement::GetChild(gd::String name,
+                                               std::size_t index,
+                                               gd::String deprecatedName) {
+  std::size_t position = GetChildPosition(name, index, deprecatedName);
+  if (position >= children.size()) return nullElement;
+
+  UnshareChild(position);
+  return *children[position].second;
+}
+
+std::size_t SerializerElement::GetChildPosition(std::size_t index) const {
   if (!isArray) {
     std::cout << "ERROR: Getting a child from its index whereas the parent is "
                  "not considered as an array."
               << std::endl;
-    return nullElement;
+    return children.size();
   }
 
   std::size_t currentIndex = 0;
@@ -183,7 +258,7 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
         (!deprecatedArrayOf.empty() &&
          children[i].first == deprecatedArrayOf)) {
       if (index == currentIndex)
-        return *children[i].second;
+        return i;
       else
         currentIndex++;
     }
@@ -191,10 +266,10 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
 
   std::cout << "ERROR: Requested out of bound child at index " << index
             << std::endl;
-  return nullElement;
+  return children.size();
 }
 
-SerializerElement& SerializerElement::GetChild(
+std::size_t SerializerElement::GetChildPosition(
     gd::String name, std::size_t index, gd::String deprecatedName) const {
   if (isArray) {
     if (name != arrayOf) {
@@ -214,7 +289,7 @@ SerializerElement& SerializerElement::GetChild(
         (isArray && children[i].first.empty()) ||
         (!deprecatedName.empty() && children[i].first == deprecatedName)) {
       if (index == currentIndex)
-        return *children[i].second;
+        return i;
       else
         currentIndex++;
     }
@@ -222,7 +297,7 @@ SerializerElement& SerializerElement::GetChild(
 
   std::cout << "Child " << name << " not found in SerializerElement::GetChild"
             << std::endl;
-  return nullElement;
+  return children.size();
 }
 
 std::size_t SerializerElement::GetChildrenCount(
@@ -280,12 +355,19 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   elementValue = other.elementValue;
   attributes = other.attributes;
 
-  children.clear();
-  for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+  if (other.copyOnWrite) {
+    // Share the children: both elements are responsible for copying them
+    // before modifying them.
+    copyOnWrite = true;
+    children = other.children;
+  } else {
+    children.clear();
+    for (const auto& child : other.children) {
+      children.push_back(
+          std::make_pair(child.first,
+                         std::shared_ptr<SerializerElement>(
+                             new SerializerElement(*child.second))));
+    }
   }
 
   isArray = other.isArray;
@@ -293,4 +375,16 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   deprecatedArrayOf = other.deprecatedArrayOf;
 }
 
+void SerializerElement::UnshareChild(std::size_t position) {
+  std::shared_ptr<SerializerElement>& child = children[position].second;
+  if (!copyOnWrite || child.use_count() <= 1) return;
+
+  // The copy shares the children of the original child, which will themselves
+  // be copied when accessed.
+  std::shared_ptr<SerializerElement> childCopy(new SerializerElement);
+  childCopy->copyOnWrite = true;
+  childCopy->Init(*child);
+  child = childCopy;
+}
+
 }  // namespace gd
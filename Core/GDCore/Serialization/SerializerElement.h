@@ -31,6 +31,10 @@ namespace gd {
  * means that their access/removal is O(number of children). This class
  * is not appropriated for a use in game where fast access is required.
  *
+ * \note By default, copying an element copies all its children. Elements
+ * can be put in a copy-on-write mode (see EnableCopyOnWrite) where copies
+ * share their children until they are modified.
+ *
  * \see gd::Serializer
  */
 class GD_CORE_API SerializerElement {
@@ -49,7 +53,15 @@ class GD_CORE_API SerializerElement {
   /**
    * Copy constructor.
    */
-  SerializerElement(const gd::SerializerElement &object) { Init(object); };
+  SerializerElement(const gd::SerializerElement &object)
+      : copyOnWrite(false) {
+    Init(object);
+  };
+
+  /**
+   * Move constructor.
+   */
+  SerializerElement(gd::SerializerElement &&object) noexcept;
 
   /**
    * Assignment operator.
@@ -59,6 +71,11 @@ class GD_CORE_API SerializerElement {
     return *this;
   }
 
+  /**
+   * Move assignment operator.
+   */
+  SerializerElement &operator=(gd::SerializerElement &&object) noexcept;
+
   virtual ~SerializerElement();
 
   /** \name Value
@@ -384,9 +401,19 @@ class GD_CORE_API SerializerElement {
    * \param name The name of the child.
    * \param name The index of the child, in case of an array.
    */
+  const SerializerElement &GetChild(gd::String name,
+                                    std::size_t index = 0,
+                                    gd::String deprecatedName = "") const;
+
+  /**
+   * \brief Get a child of the element using its name, to modify it.
+   *
+   * If the child is shared with a copy of the element (see
+   * EnableCopyOnWrite), it's copied first.
+   */
   SerializerElement &GetChild(gd::String name,
                               std::size_t index = 0,
-                              gd::String deprecatedName = "") const;
+                              gd::String deprecatedName = "");
 
   /**
    * \brief Get a child of the element using its index (when the element is
@@ -394,7 +421,15 @@ class GD_CORE_API SerializerElement {
    *
    * \param name The index of the child
    */
-  SerializerElement &GetChild(std::size_t index) const;
+  const SerializerElement &GetChild(std::size_t index) const;
+
+  /**
+   * \brief Get a child of the element using its index, to modify it.
+   *
+   * If the child is shared with a copy of the element (see
+   * EnableCopyOnWrite), it's copied first.
+   */
+  SerializerElement &GetChild(std::size_t index);
 
   /**
    * \brief Get the number of children having a specific name.
@@ -433,7 +468,42 @@ class GD_CORE_API SerializerElement {
   };
   ///@}
 
+  /** \name Copy-on-write
+   * Methods related to the sharing of children between copies.
+   */
+  ///@{
+  /**
+   * \brief Make the copies of this element, and the copies of the copies,
+   * share their children instead of copying them.
+   *
+   * A shared child is copied when it is accessed to be modified, with the
+   * non-const GetChild or AddChild (its own children being shared again), so
+   * that a copy is O(number of children) and modifying it never changes the
+   * other copies. Children added to an element in this mode are also in this
+   * mode. Only the elements in this mode share their children with their
+   * copies.
+   *
+   * \warning Children returned by GetAllChildren must only be read, and a
+   * reference to a child obtained before a copy must not be used to modify
+   * it after the copy.
+   */
+  void EnableCopyOnWrite() const { copyOnWrite = true; };
+
+  /**
+   * \brief Return true if the copies of this element share their children.
+   */
+  bool IsCopyOnWriteEnabled() const { return copyOnWrite; };
+  ///@}
+
+#if !defined(EMSCRIPTEN)
+  /**
+   * Returned when a child is not found. As callers can modify it, each thread
+   * has its own.
+   */
+  static thread_local SerializerElement nullElement;
+#else
   static SerializerElement nullElement;
+#endif
 
  private:
   /**
@@ -442,6 +512,26 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement& other);
 
+  /**
+   * Return the position, in the children, of the child of the array at the
+   * given index, or the number of children if it's not found.
+   */
+  std::size_t GetChildPosition(std::size_t index) const;
+
+  /**
+   * Return the position, in the children, of the child with the given name,
+   * or the number of children if it's not found.
+   */
+  std::size_t GetChildPosition(gd::String name,
+                               std::size_t index,
+                               gd::String deprecatedName) const;
+
+  /**
+   * Replace the child at the given position by a copy if it's shared with
+   * another element.
+   */
+  void UnshareChild(std::size_t position);
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -452,6 +542,7 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+  mutable bool copyOnWrite;  ///< true if children are shared between copies
 };
 
 }  // namespace gd
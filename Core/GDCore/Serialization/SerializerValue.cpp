@@ -1,157 +1,191 @@
 #include "GDCore/Serialization/SerializerValue.h"
+
+#include <new>
+#include <utility>
+
 #include "GDCore/CommonTools.h"
 
 namespace gd {
 
-SerializerValue::SerializerValue()
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {}
-
-SerializerValue::SerializerValue(bool val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetBool(val);
-}
-SerializerValue::SerializerValue(const gd::String &val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetString(val);
-}
-SerializerValue::SerializerValue(int val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetInt(val);
+const gd::String SerializerValue::noString;
+
+SerializerValue::SerializerValue() : type(Unknown) {
+  new (&stringValue) gd::String();
+}
+
+SerializerValue::SerializerValue(bool val) : type(Boolean), booleanValue(val) {}
+
+SerializerValue::SerializerValue(const gd::String &val) : type(String) {
+  new (&stringValue) gd::String(val);
 }
+
+SerializerValue::SerializerValue(int val) : type(Int), intValue(val) {}
+
 SerializerValue::SerializerValue(double val)
-    : isUnknown(true),
-      isBoolean(false),
-      isString(false),
-      isInt(false),
-      isDouble(false),
-      booleanValue(false),
-      intValue(0),
-      doubleValue(0) {
-  SetDouble(val);
+    : type(Double), doubleValue(val) {}
+
+SerializerValue::SerializerValue(const gd::SerializerValue &other)
+    : type(other.type) {
+  switch (type) {
+    case Boolean:
+      booleanValue = other.booleanValue;
+      break;
+    case Int:
+      intValue = other.intValue;
+      break;
+    case Double:
+      doubleValue = other.doubleValue;
+      break;
+    default:
+      new (&stringValue) gd::String(other.stringValue);
+      break;
+  }
 }
 
-bool SerializerValue::GetBool() const {
-  if (isString || isUnknown)
-    return stringValue != "false";
-  else if (isInt)
-    return intValue != 0;
-  else if (isDouble)
-    return doubleValue != 0.0;
+SerializerValue::SerializerValue(gd::SerializerValue &&other) noexcept
+    : type(other.type) {
+  switch (type) {
+    case Boolean:
+      booleanValue = other.booleanValue;
+      break;
+    case Int:
+      intValue = other.intValue;
+      break;
+    case Double:
+      doubleValue = other.doubleValue;
+      break;
+    default:
+      new (&stringValue) gd::String(std::move(other.stringValue));
+      break;
+  }
+}
 
-  return booleanValue;
+SerializerValue &SerializerValue::operator=(const gd::SerializerValue &other) {
+  if (this == &other) return *this;
+
+  switch (other.type) {
+    case Boolean:
+      SetBool(other.booleanValue);
+      break;
+    case Int:
+      SetInt(other.intValue);
+      break;
+    case Double:
+      SetDouble(other.doubleValue);
+      break;
+    default:
+      SetStringOfType(other.type, other.stringValue);
+      break;
+  }
+  return *this;
 }
 
-gd::String SerializerValue::GetString() const {
-  if (isBoolean)
-    return booleanValue ? gd::String("true") : gd::String("false");
-  else if (isInt)
-    return gd::String::From(intValue);
-  else if (isDouble)
-    return gd::String::From(doubleValue);
-  else if (isUnknown)
-    return stringValue;
+SerializerValue &SerializerValue::operator=(
+    gd::SerializerValue &&other) noexcept {
+  if (this == &other) return *this;
+
+  if (other.HoldsString()) {
+    if (HoldsString())
+      stringValue = std::move(other.stringValue);
+    else
+      new (&stringValue) gd::String(std::move(other.stringValue));
+    type = other.type;
+  } else {
+    *this = static_cast<const gd::SerializerValue &>(other);
+  }
+  return *this;
+}
 
-  return stringValue;
+SerializerValue::~SerializerValue() {
+  if (HoldsString()) stringValue.gd::String::~String();
 }
 
-int SerializerValue::GetInt() const {
-  if (isBoolean)
-    return booleanValue ? 1 : 0;
-  else if (isString || isUnknown)
-    return stringValue.To<int>();
-  else if (isDouble)
-    return doubleValue;
+bool SerializerValue::GetBool() const {
+  switch (type) {
+    case Int:
+      return intValue != 0;
+    case Double:
+      return doubleValue != 0.0;
+    case Boolean:
+      return booleanValue;
+    default:
+      return stringValue != "false";
+  }
+}
 
-  return intValue;
+gd::String SerializerValue::GetString() const {
+  switch (type) {
+    case Boolean:
+      return booleanValue ? gd::String("true") : gd::String("false");
+    case Int:
+      return gd::String::From(intValue);
+    case Double:
+      return gd::String::From(doubleValue);
+    default:
+      return stringValue;
+  }
 }
 
-double SerializerValue::GetDouble() const {
-  if (isBoolean)
-    return booleanValue ? 1 : 0;
-  else if (isString || isUnknown)
-    return stringValue.To<double>();
-  else if (isInt)
-    return intValue;
+int SerializerValue::GetInt() const {
+  switch (type) {
+    case Boolean:
+      return booleanValue ? 1 : 0;
+    case Double:
+      return doubleValue;
+    case Int:
+      return intValue;
+    default:
+      return stringValue.To<int>();
+  }
+}
 
-  return doubleValue;
+double SerializerValue::GetDouble() const {
+  switch (type) {
+    case Boolean:
+      return booleanValue ? 1 : 0;
+    case Int:
+      return intValue;
+    case Double:
+      return doubleValue;
+    default:
+      return stringValue.To<double>();
+  }
 }
 
 void SerializerValue::Set(const gd::String &val) {
-  isUnknown = true;
-  isBoolean = false;
-  isString = false;
-  isInt = false;
-  isDouble = false;
-
-  stringValue = val;
+  SetStringOfType(Unknown, val);
 }
 
 void SerializerValue::SetBool(bool val) {
-  isUnknown = false;
-  isBoolean = true;
-  isString = false;
-  isInt = false;
-  isDouble = false;
-
+  SetScalarType(Boolean);
   booleanValue = val;
 }
 
 void SerializerValue::SetString(const gd::String &val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = true;
-  isInt = false;
-  isDouble = false;
-
-  stringValue = val;
+  SetStringOfType(String, val);
 }
 
 void SerializerValue::SetInt(int val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = false;
-  isInt = true;
-  isDouble = false;
-
+  SetScalarType(Int);
   intValue = val;
 }
 
 void SerializerValue::SetDouble(double val) {
-  isUnknown = false;
-  isBoolean = false;
-  isString = false;
-  isInt = false;
-  isDouble = true;
-
+  SetScalarType(Double);
   doubleValue = val;
 }
 
+void SerializerValue::SetScalarType(Type newType) {
+  if (HoldsString()) stringValue.gd::String::~String();
+  type = newType;
+}
+
+void SerializerValue::SetStringOfType(Type newType, const gd::String &val) {
+  if (HoldsString())
+    stringValue = val;
+  else
+    new (&stringValue) gd::String(val);
+  type = newType;
+}
+
 }  // namespace gd
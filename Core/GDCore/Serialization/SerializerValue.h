@@ -14,17 +14,36 @@ namespace gd {
 /**
  * \brief A value stored inside a gd::SerializerElement.
  *
+ * The value is stored as a tagged union: a value only takes the size of
+ * a gd::String and of its one-byte type (short strings are stored without
+ * allocation by gd::String).
+ *
  * \see gd::Serializer
  * \see gd::SerializerElement
  */
 class GD_CORE_API SerializerValue {
  public:
+  /**
+   * \brief The type of the stored value.
+   */
+  enum Type : unsigned char {
+    Unknown,  ///< The type is unknown but the value is stored as a string.
+    Boolean,
+    String,
+    Int,
+    Double
+  };
+
   SerializerValue();
   SerializerValue(bool val);
   SerializerValue(const gd::String &val);
   SerializerValue(int val);
   SerializerValue(double val);
-  virtual ~SerializerValue(){};
+  SerializerValue(const gd::SerializerValue &other);
+  SerializerValue(gd::SerializerValue &&other) noexcept;
+  SerializerValue &operator=(const gd::SerializerValue &other);
+  SerializerValue &operator=(gd::SerializerValue &&other) noexcept;
+  ~SerializerValue();
 
   /**
    * Set the value, its type being a boolean.
@@ -65,7 +84,9 @@ class GD_CORE_API SerializerValue {
    * Get the string value, without attempting any conversion.
    * Make sure to check that IsString is true beforehand.
    */
-  const gd::String& GetRawString() const { return stringValue; };
+  const gd::String &GetRawString() const {
+    return HoldsString() ? stringValue : noString;
+  };
 
   /**
    * Get the value, its type being an int.
@@ -77,35 +98,71 @@ class GD_CORE_API SerializerValue {
    */
   double GetDouble() const;
 
+  /**
+   * Get the boolean value, without attempting any conversion.
+   * Make sure to check that IsBoolean is true beforehand.
+   */
+  bool GetRawBool() const { return type == Boolean && booleanValue; };
+
+  /**
+   * Get the int value, without attempting any conversion.
+   * Make sure to check that IsInt is true beforehand.
+   */
+  int GetRawInt() const { return type == Int ? intValue : 0; };
+
+  /**
+   * Get the double value, without attempting any conversion.
+   * Make sure to check that IsDouble is true beforehand.
+   */
+  double GetRawDouble() const { return type == Double ? doubleValue : 0; };
+
+  /**
+   * \brief Return the type of the value, to be used with the GetRawXxx
+   * methods.
+   */
+  Type GetType() const { return type; }
+
   /**
    * \brief Return true if the value is a boolean.
    */
-  bool IsBoolean() const { return isBoolean; }
+  bool IsBoolean() const { return type == Boolean; }
   /**
    * \brief Return true if the value is a string.
    */
-  bool IsString() const { return isString; }
+  bool IsString() const { return type == String; }
   /**
    * \brief Return true if the value is an int.
    */
-  bool IsInt() const { return isInt; }
+  bool IsInt() const { return type == Int; }
   /**
    * \brief Return true if the value is a double.
    */
-  bool IsDouble() const { return isDouble; }
+  bool IsDouble() const { return type == Double; }
 
  private:
-  bool isUnknown;  ///< If true, the type is unknown but the value is stored as
-                   ///< a string in stringValue member.
-  bool isBoolean;
-  bool isString;
-  bool isInt;
-  bool isDouble;
-
-  bool booleanValue;
-  gd::String stringValue;
-  int intValue;
-  double doubleValue;
+  bool HoldsString() const { return type == String || type == Unknown; }
+
+  /**
+   * Destroy the string, if any, and change the type of the value (leaving
+   * the value uninitialized).
+   */
+  void SetScalarType(Type newType);
+
+  /**
+   * Store a string, with the given type (String or Unknown).
+   */
+  void SetStringOfType(Type newType, const gd::String &val);
+
+  Type type;
+  union {
+    bool booleanValue;
+    int intValue;
+    double doubleValue;
+    gd::String stringValue;  ///< Active if the type is String or Unknown.
+  };
+
+  static const gd::String noString;  ///< Returned by GetRawString when the
+                                     ///< value is not a string.
 };
 
 }  // namespace gd
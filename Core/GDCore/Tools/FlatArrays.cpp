@@ -0,0 +1,45 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/FlatArrays.h"
+
+namespace gd {
+
+gd::String FlatArrays::badString;
+
+void FlatArrays::Reset(std::size_t doublesStride_,
+                       std::size_t integersStride_) {
+  doublesStride = doublesStride_;
+  integersStride = integersStride_;
+  elementsCount = 0;
+  doubles.clear();
+  integers.clear();
+  strings.clear();
+  stringsIndices.clear();
+}
+
+void FlatArrays::Resize(std::size_t elementsCount_) {
+  elementsCount = elementsCount_;
+  doubles.resize(elementsCount * doublesStride, 0);
+  integers.resize(elementsCount * integersStride, 0);
+}
+
+std::int32_t FlatArrays::AddString(const gd::String& str) {
+  auto it = stringsIndices.find(str);
+  if (it != stringsIndices.end()) return it->second;
+
+  std::int32_t index = strings.size();
+  strings.push_back(str);
+  stringsIndices[str] = index;
+  return index;
+}
+
+const gd::String& FlatArrays::GetString(std::int32_t index) const {
+  if (index < 0 || (std::size_t)index >= strings.size()) return badString;
+
+  return strings[index];
+}
+
+}  // namespace gd
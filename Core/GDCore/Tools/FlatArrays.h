@@ -0,0 +1,110 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_FLATARRAYS_H
+#define GDCORE_FLATARRAYS_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief The values of a list of elements, stored in flat arrays so that they
+ * can be read or written in bulk (for example from JavaScript, with typed
+ * arrays viewing the memory of libGD.js).
+ *
+ * Each element has the same number of doubles and of integers. Strings are
+ * stored once in a table, and referred to by their index in the integers.
+ *
+ * \see gd::InitialInstancesContainer::ExportToFlatArrays
+ * \see gd::VariablesContainer::ExportToFlatArrays
+ * \ingroup Tools
+ */
+class GD_CORE_API FlatArrays {
+ public:
+  FlatArrays() : doublesStride(0), integersStride(0), elementsCount(0){};
+  virtual ~FlatArrays(){};
+
+  /**
+   * \brief Remove all the elements and strings, and set the number of doubles
+   * and integers of each element.
+   */
+  void Reset(std::size_t doublesStride_, std::size_t integersStride_);
+
+  /**
+   * \brief Change the number of elements. New elements values are 0.
+   */
+  void Resize(std::size_t elementsCount_);
+
+  std::size_t GetElementsCount() const { return elementsCount; }
+  std::size_t GetDoublesStride() const { return doublesStride; }
+  std::size_t GetIntegersStride() const { return integersStride; }
+
+  /**
+   * \brief Return the doubles of the element at the specified index.
+   */
+  double* GetDoubles(std::size_t index) {
+    return doubles.data() + index * doublesStride;
+  }
+  const double* GetDoubles(std::size_t index) const {
+    return doubles.data() + index * doublesStride;
+  }
+
+  /**
+   * \brief Return the integers of the element at the specified index.
+   */
+  std::int32_t* GetIntegers(std::size_t index) {
+    return integers.data() + index * integersStride;
+  }
+  const std::int32_t* GetIntegers(std::size_t index) const {
+    return integers.data() + index * integersStride;
+  }
+
+  /** \name Strings table
+   */
+  ///@{
+  /**
+   * \brief Return the index of the string in the table, adding it if needed.
+   */
+  std::int32_t AddString(const gd::String& str);
+
+  /**
+   * \brief Return the string at the specified index in the table, or an empty
+   * string if the index is invalid.
+   */
+  const gd::String& GetString(std::int32_t index) const;
+
+  const std::vector<gd::String>& GetStrings() const { return strings; }
+  ///@}
+
+  /** \name Raw access
+   * Members functions used to view the arrays without copying them.
+   */
+  ///@{
+  double* GetDoublesData() { return doubles.data(); }
+  std::size_t GetDoublesCount() const { return doubles.size(); }
+  std::int32_t* GetIntegersData() { return integers.data(); }
+  std::size_t GetIntegersCount() const { return integers.size(); }
+  ///@}
+
+ private:
+  std::size_t doublesStride;
+  std::size_t integersStride;
+  std::size_t elementsCount;
+  std::vector<double> doubles;
+  std::vector<std::int32_t> integers;
+  std::vector<gd::String> strings;
+  std::unordered_map<gd::String, std::int32_t>
+      stringsIndices;  ///< The index of each string in the table.
+
+  static gd::String badString;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_FLATARRAYS_H
@@ -0,0 +1,127 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_INSERTIONORDEREDSET_H
+#define GDCORE_INSERTIONORDEREDSET_H
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <unordered_set>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A set of unique elements, iterated in the order they were first
+ * inserted.
+ *
+ * Elements are stored in a vector, and a hash set is used to know in constant
+ * time if an element is already inserted. This is useful for lists where the
+ * order matters but which can receive many duplicates, like the include files
+ * of an exported game.
+ *
+ * The members functions are named like the ones of the standard containers so
+ * that it can be used instead of a std::set.
+ *
+ * \ingroup Tools
+ */
+template <typename T>
+class InsertionOrderedSet {
+ public:
+  typedef typename std::vector<T>::const_iterator const_iterator;
+  typedef const_iterator iterator;
+  typedef T value_type;
+
+  InsertionOrderedSet(){};
+  InsertionOrderedSet(std::initializer_list<T> elements_) {
+    insert(elements_.begin(), elements_.end());
+  };
+
+  /**
+   * \brief Add the element at the end, unless it's already in the set.
+   * \return true if the element was added.
+   */
+  bool insert(const T& element) {
+    if (!elementsSet.insert(element).second) return false;
+
+    elements.push_back(element);
+    return true;
+  };
+
+  /**
+   * \brief Add the elements of a range, in order, skipping the ones already
+   * in the set.
+   */
+  template <class InputIterator>
+  void insert(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) insert(*first);
+  };
+
+  /**
+   * \brief Remove the element, if it's in the set.
+   * \return true if the element was removed.
+   * \note This is linear in the number of elements: use erase_if to remove
+   * several elements at once.
+   */
+  bool erase(const T& element) {
+    if (elementsSet.erase(element) == 0) return false;
+
+    elements.erase(std::find(elements.begin(), elements.end(), element));
+    return true;
+  };
+
+  /**
+   * \brief Remove all the elements for which \a predicate returns true,
+   * keeping the order of the others.
+   * \return The number of removed elements.
+   */
+  template <class Predicate>
+  std::size_t erase_if(Predicate predicate) {
+    // Elements left after the new end by std::remove_if are unspecified, so
+    // they are removed from the hash set while being tested.
+    auto newEnd = std::remove_if(
+        elements.begin(), elements.end(), [&](const T& element) {
+          if (!predicate(element)) return false;
+
+          elementsSet.erase(element);
+          return true;
+        });
+    std::size_t removedCount = elements.end() - newEnd;
+    elements.erase(newEnd, elements.end());
+    return removedCount;
+  };
+
+  void clear() {
+    elements.clear();
+    elementsSet.clear();
+  };
+
+  /**
+   * \brief Return 1 if the element is in the set, 0 otherwise.
+   */
+  std::size_t count(const T& element) const {
+    return elementsSet.count(element);
+  };
+
+  std::size_t size() const { return elements.size(); };
+  bool empty() const { return elements.empty(); };
+  const T& operator[](std::size_t index) const { return elements[index]; };
+
+  const_iterator begin() const { return elements.begin(); };
+  const_iterator end() const { return elements.end(); };
+
+  /**
+   * \brief Return the elements, in the order they were inserted.
+   */
+  const std::vector<T>& GetElements() const { return elements; };
+
+ private:
+  std::vector<T> elements;
+  std::unordered_set<T> elementsSet;  ///< The same elements, for fast lookups.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_INSERTIONORDEREDSET_H
@@ -0,0 +1,70 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/MappedFile.h"
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gd {
+
+MappedFile::MappedFile()
+    : data(nullptr), size(0), writable(false), nullTerminated(false) {}
+
+MappedFile::~MappedFile() { Close(); }
+
+#if !defined(WINDOWS) && !defined(EMSCRIPTEN)
+bool MappedFile::Open(const gd::String& path, bool writable_) {
+  Close();
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) return false;
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+
+  std::size_t fileSize = static_cast<std::size_t>(fileStat.st_size);
+  void* mapping =
+      mmap(nullptr,
+           fileSize,
+           writable_ ? PROT_READ | PROT_WRITE : PROT_READ,
+           writable_ ? MAP_PRIVATE : MAP_SHARED,
+           fd,
+           0);
+  close(fd);  // The mapping stays valid after the file is closed.
+  if (mapping == MAP_FAILED) return false;
+
+  data = static_cast<char*>(mapping);
+  size = fileSize;
+  writable = writable_;
+  long pageSize = sysconf(_SC_PAGESIZE);
+  nullTerminated = writable && pageSize > 0 && size % pageSize != 0;
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data) munmap(data, size);
+
+  data = nullptr;
+  size = 0;
+  writable = false;
+  nullTerminated = false;
+}
+#else
+bool MappedFile::Open(const gd::String& path, bool writable_) {
+  return false;
+}
+
+void MappedFile::Close() {}
+#endif
+
+}  // namespace gd
@@ -0,0 +1,84 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_MAPPEDFILE_H
+#define GDCORE_MAPPEDFILE_H
+#include <cstddef>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A file mapped in memory, to read it without copying it.
+ *
+ * Read-only mappings share the pages of the file with the other processes
+ * reading it. Writable mappings are private: changes are copied on write and
+ * never written to the file (useful to parse a file in-situ).
+ *
+ * \note Only supported on POSIX systems (not on Windows or when compiled
+ * with Emscripten): Open returns false otherwise.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API MappedFile {
+ public:
+  MappedFile();
+  ~MappedFile();
+
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+
+  /**
+   * \brief Map the file in memory, unmapping the previous one if any.
+   *
+   * \param path The path to the file.
+   * \param writable If true, the mapping is private and can be modified.
+   * \return true if the file was mapped. Empty files can't be mapped.
+   */
+  bool Open(const gd::String& path, bool writable = false);
+
+  /**
+   * \brief Unmap the file.
+   */
+  void Close();
+
+  bool IsOpen() const { return data != nullptr; }
+
+  /**
+   * \brief Return the content of the file (nullptr if it's not mapped).
+   */
+  const char* GetData() const { return data; }
+
+  /**
+   * \brief Return the content of the file, if it was mapped as writable
+   * (nullptr otherwise).
+   */
+  char* GetWritableData() { return writable ? data : nullptr; }
+
+  /**
+   * \brief Return the size of the file, in bytes.
+   */
+  std::size_t GetSize() const { return size; }
+
+  /**
+   * \brief Return true if the mapping is writable and has a (writable) null
+   * character after the content of the file.
+   *
+   * This is the case when the file size is not a multiple of the page size:
+   * the rest of the last page is filled with zeros.
+   */
+  bool IsNullTerminated() const { return nullTerminated; }
+
+ private:
+  char* data;
+  std::size_t size;
+  bool writable;
+  bool nullTerminated;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_MAPPEDFILE_H
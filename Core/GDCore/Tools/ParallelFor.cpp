@@ -0,0 +1,66 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelFor.h"
+
+#include <algorithm>
+#include <exception>
+#if !defined(EMSCRIPTEN)
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace gd {
+
+std::atomic<std::size_t> ParallelFor::maxThreadsCount(0);
+
+std::size_t ParallelFor::GetMaxThreadsCount() {
+#if defined(EMSCRIPTEN)
+  return 1;  // libGD.js is not compiled with threads support.
+#else
+  std::size_t count = maxThreadsCount;
+  if (count != 0) return count;
+
+  unsigned int hardwareThreads = std::thread::hardware_concurrency();
+  return hardwareThreads != 0 ? hardwareThreads : 1;
+#endif
+}
+
+void ParallelFor::Run(std::size_t count,
+                      const std::function<void(std::size_t)>& task) {
+  std::size_t threadsCount = std::min(GetMaxThreadsCount(), count);
+  if (threadsCount <= 1) {
+    for (std::size_t i = 0; i < count; ++i) task(i);
+    return;
+  }
+
+#if !defined(EMSCRIPTEN)
+  std::atomic<std::size_t> nextIndex(0);
+  std::exception_ptr firstException;
+  std::mutex exceptionMutex;
+
+  auto work = [&]() {
+    for (std::size_t i = nextIndex++; i < count; i = nextIndex++) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!firstException) firstException = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(threadsCount - 1);
+  for (std::size_t i = 1; i < threadsCount; ++i) threads.emplace_back(work);
+  work();  // The calling thread is doing its share of the tasks too.
+  for (auto& thread : threads) thread.join();
+
+  if (firstException) std::rethrow_exception(firstException);
+#endif
+}
+
+}  // namespace gd
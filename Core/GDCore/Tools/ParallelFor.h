@@ -0,0 +1,56 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PARALLELFOR_H
+#define GDCORE_PARALLELFOR_H
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+namespace gd {
+
+/**
+ * \brief Tool class to run independent tasks concurrently.
+ *
+ * Threads are only started for the duration of a call to Run, so nothing is
+ * left running when the library is unloaded. When threads are not available
+ * (for example when compiled with Emscripten), tasks are run sequentially.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ParallelFor {
+ public:
+  /**
+   * \brief Call \a task for each index in [0, count) and return once all the
+   * tasks are done.
+   *
+   * Tasks are run in an unspecified order, possibly from different threads:
+   * they must not modify data shared with other tasks. If tasks throw, the
+   * first exception is rethrown once all threads are finished.
+   */
+  static void Run(std::size_t count,
+                  const std::function<void(std::size_t)>& task);
+
+  /**
+   * \brief Return the maximum number of threads used by Run (including the
+   * calling thread).
+   */
+  static std::size_t GetMaxThreadsCount();
+
+  /**
+   * \brief Change the maximum number of threads used by Run. 1 disables
+   * threads, 0 uses the number of hardware threads (default).
+   */
+  static void SetMaxThreadsCount(std::size_t count) {
+    maxThreadsCount = count;
+  };
+
+ private:
+  static std::atomic<std::size_t> maxThreadsCount;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PARALLELFOR_H
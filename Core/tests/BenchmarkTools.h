@@ -0,0 +1,43 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef BENCHMARK_TOOLS
+#define BENCHMARK_TOOLS
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "GDCore/String.h"
+
+/**
+ * Run \a func \a runsCount times and print the average time spent, in
+ * microseconds.
+ */
+inline void DoBenchmark(const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+  std::vector<long long> timesInMicroseconds;
+
+  for (size_t i = 0; i < runsCount; i++) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+
+    timesInMicroseconds.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count());
+  }
+
+  std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+            << (float)std::accumulate(timesInMicroseconds.begin(),
+                                      timesInMicroseconds.end(),
+                                      0LL) /
+                   (float)runsCount
+            << " microseconds" << std::endl;
+}
+
+#endif
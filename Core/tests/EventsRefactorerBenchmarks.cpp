@@ -0,0 +1,127 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/ParallelFor.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Fill the events with \a eventsCount top-level events, each having
+ * \a subEventsCount sub-events with \a instructionsCount actions and
+ * \a instructionsCount conditions.
+ */
+void FillEvents(gd::EventsList &events,
+                std::size_t eventsCount,
+                std::size_t subEventsCount,
+                std::size_t instructionsCount) {
+  std::size_t instructionIndex = 0;
+  auto fillInstructions = [&](gd::InstructionsList &instructions) {
+    for (std::size_t i = 0; i < instructionsCount; ++i) {
+      gd::Instruction instruction;
+      instruction.SetType("MyExtension::DoSomething");
+      instruction.SetParametersCount(1);
+      instruction.SetParameter(
+          0,
+          gd::Expression(instructionIndex % 10000 == 0
+                             ? "MySearchedObject.GetNumber() + 1"
+                             : "MyObject.GetNumber() + 1"));
+      instructions.Insert(instruction);
+      instructionIndex++;
+    }
+  };
+
+  for (std::size_t e = 0; e < eventsCount; ++e) {
+    gd::StandardEvent event;
+    fillInstructions(event.GetConditions());
+    fillInstructions(event.GetActions());
+    for (std::size_t s = 0; s < subEventsCount; ++s) {
+      gd::StandardEvent subEvent;
+      fillInstructions(subEvent.GetConditions());
+      fillInstructions(subEvent.GetActions());
+      event.GetSubEvents().InsertEvent(subEvent);
+    }
+    events.InsertEvent(event);
+  }
+}
+}  // namespace
+
+TEST_CASE("EventsRefactorer - Benchmarks", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+
+  // 1000 events with 4 sub-events each, with 20 conditions and 20 actions:
+  // 200k instructions.
+  FillEvents(layout.GetEvents(), 1000, 4, 20);
+
+  auto search = [&]() {
+    return gd::EventsRefactorer::SearchInEvents(platform,
+                                                layout.GetEvents(),
+                                                "MySearchedObject",
+                                                false,
+                                                true,
+                                                true,
+                                                true,
+                                                false);
+  };
+
+  SECTION("Results are the same whatever the number of threads") {
+    gd::ParallelFor::SetMaxThreadsCount(1);
+    auto sequentialResults = search();
+    gd::ParallelFor::SetMaxThreadsCount(4);
+    auto parallelResults = search();
+    gd::ParallelFor::SetMaxThreadsCount(0);
+
+    REQUIRE(sequentialResults.size() == 20);
+    REQUIRE(parallelResults.size() == sequentialResults.size());
+    for (std::size_t i = 0; i < sequentialResults.size(); ++i) {
+      REQUIRE(parallelResults[i].eventsList ==
+              sequentialResults[i].eventsList);
+      REQUIRE(parallelResults[i].positionInList ==
+              sequentialResults[i].positionInList);
+    }
+  }
+
+  SECTION("Search in 200k instructions") {
+    gd::ParallelFor::SetMaxThreadsCount(1);
+    DoBenchmark("Search in 200k instructions (1 thread)", 5, [&]() {
+      REQUIRE(search().size() == 20);
+    });
+    gd::ParallelFor::SetMaxThreadsCount(0);
+    DoBenchmark("Search in 200k instructions (all threads)", 5, [&]() {
+      REQUIRE(search().size() == 20);
+    });
+  }
+
+  SECTION("Search in 200k instructions with an index") {
+    gd::EventsSearchIndex index(platform);
+    auto searchWithIndex = [&](const gd::String &searchedText) {
+      return index.Search(
+          layout.GetEvents(), searchedText, false, true, true, true, false);
+    };
+
+    DoBenchmark("Index 200k instructions", 1, [&]() {
+      REQUIRE(searchWithIndex("MySearchedObject").size() == 20);
+    });
+    DoBenchmark("Search in 200k instructions with an index", 5, [&]() {
+      REQUIRE(searchWithIndex("MySearchedObject").size() == 20);
+    });
+    DoBenchmark(
+        "Search in 200k instructions with an index, after an update", 5, [&]() {
+          index.UpdateEvent(layout.GetEvents().GetEvent(0));
+          REQUIRE(searchWithIndex("MySearchedObject").size() == 20);
+        });
+  }
+}
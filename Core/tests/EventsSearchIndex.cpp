@@ -0,0 +1,190 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsSearchIndex.h"
+
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/EventsRevision.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const gd::String &parameter) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, gd::Expression(parameter));
+  return instruction;
+}
+
+void FillEvents(gd::EventsList &events) {
+  gd::StandardEvent event;
+  event.GetConditions().Insert(
+      MakeInstruction("MyExtension::SomeCondition", "MyObject"));
+  event.GetActions().Insert(
+      MakeInstruction("MyExtension::DoSomething", "MyObject.GetNumber() + 1"));
+
+  gd::StandardEvent subEvent;
+  subEvent.GetActions().Insert(
+      MakeInstruction("MyExtension::DoSomething", "OtherObject.X(); 2"));
+  gd::Instruction actionWithSubInstructions =
+      MakeInstruction("MyExtension::DoSomething", "3");
+  actionWithSubInstructions.GetSubInstructions().Insert(
+      MakeInstruction("MyExtension::DoSomething", "ÉLÉPHANT"));
+  subEvent.GetActions().Insert(actionWithSubInstructions);
+  event.GetSubEvents().InsertEvent(subEvent);
+  events.InsertEvent(event);
+
+  gd::CommentEvent comment;
+  comment.SetComment("A comment about MyObject");
+  events.InsertEvent(comment);
+
+  gd::StandardEvent emptyEvent;
+  events.InsertEvent(emptyEvent);
+}
+
+bool AreSameResults(const std::vector<gd::EventsSearchResult> &results,
+                    const std::vector<gd::EventsSearchResult> &otherResults) {
+  if (results.size() != otherResults.size()) return false;
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    if (results[i].eventsList != otherResults[i].eventsList ||
+        results[i].positionInList != otherResults[i].positionInList ||
+        results[i].event.lock() != otherResults[i].event.lock())
+      return false;
+  }
+  return true;
+}
+}  // namespace
+
+TEST_CASE("EventsSearchIndex", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  gd::EventsList &events = layout.GetEvents();
+  FillEvents(events);
+
+  gd::EventsSearchIndex index(platform);
+  auto requireSameResultsAsRefactorer = [&](const gd::String &search) {
+    for (int flags = 0; flags < 32; ++flags) {
+      bool matchCase = flags & 1;
+      bool inConditions = flags & 2;
+      bool inActions = flags & 4;
+      bool inEventStrings = flags & 8;
+      bool inEventSentences = flags & 16;
+      INFO("Searching \"" << search << "\" with flags " << flags);
+      REQUIRE(AreSameResults(index.Search(events,
+                                          search,
+                                          matchCase,
+                                          inConditions,
+                                          inActions,
+                                          inEventStrings,
+                                          inEventSentences),
+                             gd::EventsRefactorer::SearchInEvents(
+                                 platform,
+                                 events,
+                                 search,
+                                 matchCase,
+                                 inConditions,
+                                 inActions,
+                                 inEventStrings,
+                                 inEventSentences)));
+    }
+  };
+
+  SECTION("Results are the same as EventsRefactorer::SearchInEvents") {
+    for (const gd::String &search : std::vector<gd::String>{"MyObject",
+                                                            "myobject",
+                                                            "MYOBJECT",
+                                                            "GetNumber() +",
+                                                            "X();",
+                                                            "please",
+                                                            "Do  something",
+                                                            "éléphant",
+                                                            "ÉLÉPHANT",
+                                                            "comment",
+                                                            "1",
+                                                            "ob",
+                                                            "",
+                                                            "Not found"}) {
+      requireSameResultsAsRefactorer(search);
+    }
+    REQUIRE(index.GetIndexedEventsCount() == 4);
+  }
+
+  SECTION("Changes in events are taken into account") {
+    REQUIRE(index.Search(events, "MyObject", false, true, true, true, false)
+                .size() == 3);
+
+    // Modified events and instructions are indexed again.
+    gd::BaseEvent &comment = events.GetEvent(1);
+    dynamic_cast<gd::CommentEvent &>(comment).SetComment("Nothing here");
+    requireSameResultsAsRefactorer("MyObject");
+    requireSameResultsAsRefactorer("Nothing");
+
+    gd::Instruction &subInstruction = events.GetEvent(0)
+                                          .GetSubEvents()
+                                          .GetEvent(0)
+                                          .GetAllActionsVectors()[0]
+                                          ->Get(1)
+                                          .GetSubInstructions()
+                                          .Get(0);
+    subInstruction.SetParameter(0, gd::Expression("Giraffe"));
+    requireSameResultsAsRefactorer("éléphant");
+    requireSameResultsAsRefactorer("giraffe");
+
+    events.GetEvent(0).GetAllConditionsVectors()[0]->Remove(0);
+    requireSameResultsAsRefactorer("MyObject");
+    events.GetEvent(0).GetAllConditionsVectors()[0]->Insert(
+        MakeInstruction("MyExtension::SomeCondition", "Giraffe"));
+    requireSameResultsAsRefactorer("giraffe");
+
+    // Added, moved and removed events are found at each search.
+    gd::CommentEvent newComment;
+    newComment.SetComment("Another comment about MyObject");
+    events.InsertEvent(newComment, 0);
+    requireSameResultsAsRefactorer("MyObject");
+    requireSameResultsAsRefactorer("comment");
+
+    events.MoveEventToAnotherEventsList(
+        events.GetEvent(0), events.GetEvent(1).GetSubEvents(), 0);
+    requireSameResultsAsRefactorer("MyObject");
+
+    events.RemoveEvent(1);
+    requireSameResultsAsRefactorer("MyObject");
+    REQUIRE(index.Search(events, "MyObject", false, true, true, true, false)
+                .size() == 2);
+
+    index.Clear();
+    REQUIRE(index.GetIndexedEventsCount() == 0);
+    requireSameResultsAsRefactorer("MyObject");
+  }
+
+  SECTION("Searches don't modify the revision of events") {
+    // The events found by a search are used by the next ones as long as no
+    // events are modified.
+    index.Search(events, "MyObject", false, true, true, true, true);
+    std::size_t revision = gd::EventsRevision::GetLast();
+    REQUIRE(index.Search(events, "MyObject", false, true, true, true, true)
+                .size() == 3);
+    REQUIRE(index.Search(events, "comment", false, true, true, true, true)
+                .size() == 1);
+    REQUIRE(gd::EventsRevision::GetLast() == revision);
+
+    events.GetEvent(0).GetAllActionsVectors()[0]->Get(0).SetParameter(
+        0, gd::Expression("Giraffe"));
+    REQUIRE(gd::EventsRevision::GetLast() != revision);
+    requireSameResultsAsRefactorer("giraffe");
+  }
+}
@@ -14,6 +14,8 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/FlatArrays.h"
 #include "GDCore/Tools/VersionWrapper.h"
 
 void AddNewInitialInstance(gd::InitialInstancesContainer &container,
@@ -219,10 +221,187 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
                           MakeInstance("object3", "layer2", 9)}) == true);
   }
 
+  SECTION("IterateOverInstancesWithZOrdering after changes") {
+    {
+      ZOrderCheckFunctor func("layer1");
+      container.IterateOverInstancesWithZOrdering(func, "layer1");
+      REQUIRE(func.IsOk() == true);
+    }
+
+    // Modify the instances after the Z order index was built for the layer.
+    auto &newInstance = container.InsertNewInitialInstance();
+    newInstance.SetLayer("layer1");
+    newInstance.SetZOrder(-5);
+    AddNewInitialInstance(container, "object4", "layer1", 11);
+    auto &movedInstance = container.InsertNewInitialInstance();
+    movedInstance.SetLayer("layer2");
+    movedInstance.SetZOrder(13);
+    movedInstance.SetLayer("layer1");
+    newInstance.SetZOrder(20);
+    container.RemoveInitialInstancesOfObject("object2");
+
+    std::vector<int> zOrders;
+    class ZOrdersFunctor : public gd::InitialInstanceFunctor {
+     public:
+      ZOrdersFunctor(std::vector<int> &zOrders_) : zOrders(zOrders_) {}
+      void operator()(gd::InitialInstance &instance) {
+        zOrders.push_back(instance.GetZOrder());
+      }
+
+     private:
+      std::vector<int> &zOrders;
+    } zOrdersFunctor(zOrders);
+    container.IterateOverInstancesWithZOrdering(zOrdersFunctor, "layer1");
+    REQUIRE(zOrders == std::vector<int>({10, 11, 13, 14, 20}));
+
+    // Copies have their own index.
+    gd::InitialInstancesContainer copiedContainer = container;
+    copiedContainer.MoveInstancesToLayer("layer1", "layer2");
+    zOrders.clear();
+    copiedContainer.IterateOverInstancesWithZOrdering(zOrdersFunctor,
+                                                      "layer2");
+    REQUIRE(zOrders == std::vector<int>({9, 10, 10, 11, 11, 13, 14, 20}));
+
+    zOrders.clear();
+    container.IterateOverInstancesWithZOrdering(zOrdersFunctor, "layer1");
+    REQUIRE(zOrders == std::vector<int>({10, 11, 13, 14, 20}));
+  }
+
+  SECTION("IterateOverInstancesWithZOrdering with a functor modifying them") {
+    // Each instance is visited once, even if the functor changes the Z order
+    // or the layer of the instances, and so the index.
+    class ModifyingFunctor : public gd::InitialInstanceFunctor {
+     public:
+      ModifyingFunctor(gd::InitialInstancesContainer &container_)
+          : container(container_) {}
+      void operator()(gd::InitialInstance &instance) {
+        zOrders.push_back(instance.GetZOrder());
+        instance.SetZOrder(instance.GetZOrder() + 100);
+        if (zOrders.size() == 2) instance.SetLayer("layer2");
+        if (zOrders.size() == 3)
+          container.MoveInstancesToLayer("layer2", "layer3");
+      }
+
+      std::vector<int> zOrders;
+
+     private:
+      gd::InitialInstancesContainer &container;
+    } modifyingFunctor(container);
+    container.IterateOverInstancesWithZOrdering(modifyingFunctor, "layer1");
+    REQUIRE(modifyingFunctor.zOrders == std::vector<int>({10, 10, 12, 14}));
+
+    modifyingFunctor.zOrders.clear();
+    container.IterateOverInstancesWithZOrdering(modifyingFunctor, "layer1");
+    REQUIRE(modifyingFunctor.zOrders == std::vector<int>({110, 112, 114}));
+  }
+
+  SECTION("Serialization") {
+    gd::SerializerElement element;
+    container.SerializeTo(element);
+
+    gd::InitialInstancesContainer unserializedContainer;
+    unserializedContainer.UnserializeFrom(element);
+    REQUIRE(unserializedContainer.GetInstancesCount() == 7);
+
+    AllInstancesFunctor func;
+    unserializedContainer.IterateOverInstances(func);
+    REQUIRE(func.Compare({MakeInstance("object1", "layer1", 10),
+                          MakeInstance("object1", "layer2", 10),
+                          MakeInstance("object1", "layer1", 14),
+                          MakeInstance("object2", "layer1", 12),
+                          MakeInstance("object2", "layer1", 10),
+                          MakeInstance("object3", "layer2", 11),
+                          MakeInstance("object3", "layer2", 9)}) == true);
+
+    ZOrderCheckFunctor zOrderFunc("layer2");
+    unserializedContainer.IterateOverInstancesWithZOrdering(zOrderFunc,
+                                                            "layer2");
+    REQUIRE(zOrderFunc.IsOk() == true);
+  }
+
   SECTION("SomeInstancesAreOnLayer") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer1") == true);
     REQUIRE(container.SomeInstancesAreOnLayer("layer2") == true);
     REQUIRE(container.SomeInstancesAreOnLayer("layer3") == false);
     REQUIRE(container.SomeInstancesAreOnLayer("layer5") == false);
   }
+
+  SECTION("ExportToFlatArrays and ImportFromFlatArrays") {
+    gd::FlatArrays arrays;
+    container.ExportToFlatArrays(arrays);
+    REQUIRE(arrays.GetElementsCount() == 7);
+    REQUIRE(arrays.GetStrings().size() == 5);
+
+    const std::int32_t *integers = arrays.GetIntegers(5);
+    REQUIRE(integers[gd::InitialInstancesContainer::InstanceZOrder] == 11);
+    REQUIRE(arrays.GetString(
+                integers[gd::InitialInstancesContainer::InstanceLayer]) ==
+            "layer2");
+    REQUIRE(arrays.GetString(
+                integers[gd::InitialInstancesContainer::InstanceObjectName]) ==
+            "object3");
+
+    // Move the last instance to another layer, change the size of the first
+    // one, and add an instance.
+    arrays.Resize(8);
+    double *doubles = arrays.GetDoubles(0);
+    doubles[gd::InitialInstancesContainer::InstanceX] = 42;
+    doubles[gd::InitialInstancesContainer::InstanceCustomWidth] = 100;
+    arrays.GetIntegers(0)[gd::InitialInstancesContainer::InstanceFlags] =
+        gd::InitialInstancesContainer::InstanceHasCustomSize;
+    arrays.GetIntegers(6)[gd::InitialInstancesContainer::InstanceLayer] =
+        arrays.GetIntegers(0)[gd::InitialInstancesContainer::InstanceLayer];
+    std::int32_t *newIntegers = arrays.GetIntegers(7);
+    newIntegers[gd::InitialInstancesContainer::InstanceLayer] =
+        arrays.AddString("layer2");
+    newIntegers[gd::InitialInstancesContainer::InstanceObjectName] =
+        arrays.AddString("object4");
+    newIntegers[gd::InitialInstancesContainer::InstanceZOrder] = 20;
+    newIntegers[gd::InitialInstancesContainer::InstanceFlags] =
+        gd::InitialInstancesContainer::InstanceLocked;
+
+    // Iterate with Z ordering first so that the Z order index is updated.
+    ZOrderCheckFunctor zOrderFunc("layer2");
+    container.IterateOverInstancesWithZOrdering(zOrderFunc, "layer2");
+    container.ImportFromFlatArrays(arrays);
+    REQUIRE(container.GetInstancesCount() == 8);
+
+    AllInstancesFunctor func;
+    container.IterateOverInstances(func);
+    REQUIRE(func.Compare({MakeInstance("object1", "layer1", 10),
+                          MakeInstance("object1", "layer2", 10),
+                          MakeInstance("object1", "layer1", 14),
+                          MakeInstance("object2", "layer1", 12),
+                          MakeInstance("object2", "layer1", 10),
+                          MakeInstance("object3", "layer2", 11),
+                          MakeInstance("object3", "layer1", 9),
+                          MakeInstance("object4", "layer2", 20)}) == true);
+
+    AllInstancesFunctor layer2Func;
+    container.IterateOverInstancesWithZOrdering(layer2Func, "layer2");
+    REQUIRE(layer2Func.Compare({MakeInstance("object1", "layer2", 10),
+                                MakeInstance("object3", "layer2", 11),
+                                MakeInstance("object4", "layer2", 20)}) ==
+            true);
+
+    gd::FlatArrays exportedArrays;
+    container.ExportToFlatArrays(exportedArrays);
+    doubles = exportedArrays.GetDoubles(0);
+    REQUIRE(doubles[gd::InitialInstancesContainer::InstanceX] == 42);
+    REQUIRE(doubles[gd::InitialInstancesContainer::InstanceCustomWidth] ==
+            100);
+    REQUIRE(exportedArrays.GetIntegers(
+                0)[gd::InitialInstancesContainer::InstanceFlags] ==
+            gd::InitialInstancesContainer::InstanceHasCustomSize);
+    REQUIRE(exportedArrays.GetIntegers(
+                7)[gd::InitialInstancesContainer::InstanceFlags] ==
+            gd::InitialInstancesContainer::InstanceLocked);
+
+    // Instances without element are removed.
+    arrays.Resize(2);
+    container.ImportFromFlatArrays(arrays);
+    REQUIRE(container.GetInstancesCount() == 2);
+    REQUIRE(container.SomeInstancesAreOnLayer("layer2") == true);
+    REQUIRE(container.HasInstancesOfObject("object3") == false);
+  }
 }
@@ -0,0 +1,101 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkTools.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/FlatArrays.h"
+#include "catch.hpp"
+
+namespace {
+class CountingFunctor : public gd::InitialInstanceFunctor {
+ public:
+  CountingFunctor() : count(0), zOrderSum(0) {}
+  void operator()(gd::InitialInstance &instance) {
+    count++;
+    zOrderSum += instance.GetZOrder();
+  }
+
+  size_t count;
+  long long zOrderSum;
+};
+}  // namespace
+
+TEST_CASE("InitialInstancesContainer - Benchmarks", "[common][instances]") {
+  const size_t instancesCount = 100000;
+  gd::InitialInstancesContainer container;
+  for (size_t i = 0; i < instancesCount; ++i) {
+    auto &instance = container.InsertNewInitialInstance();
+    instance.SetObjectName(i % 3 == 0 ? "MyObject" : "MyOtherObject");
+    instance.SetLayer(i % 2 == 0 ? "" : "Background");
+    instance.SetZOrder((i * 7919) % 1000);
+    instance.SetX(i);
+    instance.SetY(i * 2);
+  }
+
+  SECTION("Iterate over 100k instances") {
+    DoBenchmark("Iterate over 100k instances", 10, [&]() {
+      CountingFunctor func;
+      container.IterateOverInstances(func);
+      REQUIRE(func.count == instancesCount);
+    });
+  }
+
+  SECTION("Iterate over 100k instances with Z ordering") {
+    DoBenchmark("Iterate over 100k instances with Z ordering", 10, [&]() {
+      CountingFunctor func;
+      container.IterateOverInstancesWithZOrdering(func, "");
+      container.IterateOverInstancesWithZOrdering(func, "Background");
+      REQUIRE(func.count == instancesCount);
+    });
+  }
+
+  SECTION("Remove instances of 100k instances with Z ordering") {
+    CountingFunctor func;
+    container.IterateOverInstancesWithZOrdering(func, "");
+    container.IterateOverInstancesWithZOrdering(func, "Background");
+
+    DoBenchmark("Remove 33k instances of 100k instances with Z ordering",
+                1,
+                [&]() { container.RemoveInitialInstancesOfObject("MyObject"); });
+    REQUIRE(container.GetInstancesCount() == instancesCount * 2 / 3);
+
+    CountingFunctor otherFunc;
+    container.IterateOverInstancesWithZOrdering(otherFunc, "");
+    container.IterateOverInstancesWithZOrdering(otherFunc, "Background");
+    REQUIRE(otherFunc.count == instancesCount * 2 / 3);
+  }
+
+  SECTION("Serialize 100k instances") {
+    DoBenchmark("Serialize 100k instances", 3, [&]() {
+      gd::SerializerElement element;
+      container.SerializeTo(element);
+      REQUIRE(element.GetChildrenCount() == instancesCount);
+    });
+  }
+
+  SECTION("Unserialize 100k instances") {
+    gd::SerializerElement element;
+    container.SerializeTo(element);
+
+    DoBenchmark("Unserialize 100k instances", 3, [&]() {
+      gd::InitialInstancesContainer unserializedContainer;
+      unserializedContainer.UnserializeFrom(element);
+      REQUIRE(unserializedContainer.GetInstancesCount() == instancesCount);
+    });
+  }
+
+  SECTION("Export and import 100k instances with flat arrays") {
+    gd::FlatArrays arrays;
+    DoBenchmark("Export 100k instances to flat arrays", 10, [&]() {
+      container.ExportToFlatArrays(arrays);
+      REQUIRE(arrays.GetElementsCount() == instancesCount);
+    });
+    DoBenchmark("Import 100k instances from flat arrays", 10, [&]() {
+      container.ImportFromFlatArrays(arrays);
+      REQUIRE(container.GetInstancesCount() == instancesCount);
+    });
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/InsertionOrderedSet.h"
+
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("InsertionOrderedSet", "[common]") {
+  gd::InsertionOrderedSet<gd::String> set;
+
+  SECTION("Elements are unique and kept in insertion order") {
+    REQUIRE(set.empty());
+    REQUIRE(set.insert("b.js"));
+    REQUIRE(set.insert("a.js"));
+    REQUIRE_FALSE(set.insert("b.js"));
+    std::vector<gd::String> otherElements = {"c.js", "a.js", "d.js"};
+    set.insert(otherElements.begin(), otherElements.end());
+
+    REQUIRE(set.size() == 4);
+    REQUIRE(set.GetElements() ==
+            std::vector<gd::String>({"b.js", "a.js", "c.js", "d.js"}));
+    REQUIRE(set.count("c.js") == 1);
+    REQUIRE(set.count("e.js") == 0);
+  }
+
+  SECTION("Elements can be removed") {
+    set = {"a.js", "b.js", "c.js", "d.js", "b.js"};
+    REQUIRE(set.erase("b.js"));
+    REQUIRE_FALSE(set.erase("b.js"));
+    REQUIRE(set.erase_if([](const gd::String &element) {
+      return element == "a.js" || element == "d.js";
+    }) == 2);
+    REQUIRE(set.GetElements() == std::vector<gd::String>({"c.js"}));
+    REQUIRE(set.count("a.js") == 0);
+
+    // Removed elements can be added again, at the end.
+    REQUIRE(set.insert("a.js"));
+    REQUIRE(set.GetElements() == std::vector<gd::String>({"c.js", "a.js"}));
+
+    set.clear();
+    REQUIRE(set.empty());
+    REQUIRE(set.insert("c.js"));
+  }
+
+  SECTION("Elements are moved with the set") {
+    set = {"a.js", "b.js"};
+    const gd::String *elementsData = set.GetElements().data();
+
+    gd::InsertionOrderedSet<gd::String> movedSet(std::move(set));
+    REQUIRE(movedSet.GetElements().data() == elementsData);
+    set = std::move(movedSet);
+    REQUIRE(set.GetElements().data() == elementsData);
+    REQUIRE(set.count("b.js") == 1);
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "catch.hpp"
+
+TEST_CASE("InstructionMetadata", "[common][events]") {
+  SECTION("Editor information") {
+    gd::InstructionMetadata unknownMetadata;
+    REQUIRE(unknownMetadata.GetSentence() ==
+            "Unknown or unsupported instruction");
+    REQUIRE(unknownMetadata.GetFullName() == "");
+
+    gd::InstructionMetadata metadata("MyExtension::",
+                                     "DoSomething",
+                                     "Do something",
+                                     "Do something with an object",
+                                     "Do something with _PARAM0_",
+                                     "My group",
+                                     "icon.png",
+                                     "smallIcon.png");
+    metadata.AddParameter("object", "Object", "Sprite")
+        .SetParameterLongDescription("The object to use")
+        .AddCodeOnlyParameter("currentScene", "");
+    REQUIRE(metadata.GetFullName() == "Do something");
+    REQUIRE(metadata.GetDescription() == "Do something with an object");
+    REQUIRE(metadata.GetSentence() == "Do something with _PARAM0_");
+    REQUIRE(metadata.GetGroup() == "My group");
+    REQUIRE(metadata.GetIconFilename() == "icon.png");
+    REQUIRE(metadata.GetSmallIconFilename() == "smallIcon.png");
+    REQUIRE(metadata.GetParameter(0).GetDescription() == "Object");
+    REQUIRE(metadata.GetParameter(0).GetLongDescription() ==
+            "The object to use");
+    REQUIRE(metadata.GetParameter(0).GetExtraInfo() == "MyExtension::Sprite");
+    REQUIRE(metadata.GetParameter(1).GetDescription() == "");
+
+    // Copies can be modified without changing the original metadata.
+    gd::InstructionMetadata copiedMetadata = metadata;
+    copiedMetadata.SetGroup("Another group").SetHelpPath("/help");
+    copiedMetadata.GetParameter(0).SetDescription("Another object");
+    REQUIRE(copiedMetadata.GetGroup() == "Another group");
+    REQUIRE(copiedMetadata.GetHelpPath() == "/help");
+    REQUIRE(copiedMetadata.GetFullName() == "Do something");
+    REQUIRE(copiedMetadata.GetParameter(0).GetDescription() ==
+            "Another object");
+    REQUIRE(copiedMetadata.GetParameter(0).GetLongDescription() ==
+            "The object to use");
+    REQUIRE(metadata.GetGroup() == "My group");
+    REQUIRE(metadata.GetHelpPath() == "");
+    REQUIRE(metadata.GetParameter(0).GetDescription() == "Object");
+
+    gd::InstructionMetadata modifiedUnknownMetadata;
+    modifiedUnknownMetadata.SetGroup("My group");
+    REQUIRE(unknownMetadata.GetGroup() == "");
+    REQUIRE(gd::InstructionMetadata().GetGroup() == "");
+  }
+}
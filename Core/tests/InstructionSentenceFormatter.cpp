@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
+
+#include "BenchmarkTools.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "catch.hpp"
+
+namespace {
+gd::InstructionMetadata MakeMetadata(const gd::String &sentence,
+                                     std::size_t parametersCount) {
+  gd::InstructionMetadata metadata("MyExtension::",
+                                   "DoSomething",
+                                   "Do something",
+                                   "Do something with values",
+                                   sentence,
+                                   "My group",
+                                   "icon.png",
+                                   "smallIcon.png");
+  for (std::size_t i = 0; i < parametersCount; ++i)
+    metadata.AddParameter("expression", "Value");
+  return metadata;
+}
+}  // namespace
+
+TEST_CASE("InstructionSentenceFormatter", "[common][events]") {
+  gd::InstructionSentenceFormatter &formatter =
+      *gd::InstructionSentenceFormatter::Get();
+
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, gd::Expression("1 + 2"));
+  instruction.SetParameter(1, gd::Expression("MyObject"));
+  instruction.SetParameter(2, gd::Expression("\"Multi\nline\""));
+
+  SECTION("Formatted text") {
+    gd::InstructionMetadata metadata =
+        MakeMetadata("Set _PARAM1_ to\n_PARAM0_ (_PARAM2_)", 3);
+    auto formattedText = formatter.GetAsFormattedText(instruction, metadata);
+    REQUIRE(formattedText.size() == 7);
+    REQUIRE(formattedText[0].first == "Set ");
+    REQUIRE(formattedText[0].second.GetUserData() == gd::String::npos);
+    REQUIRE(formattedText[1].first == "MyObject");
+    REQUIRE(formattedText[1].second.GetUserData() == 1);
+    REQUIRE(formattedText[2].first == " to ");
+    REQUIRE(formattedText[3].first == "1 + 2");
+    REQUIRE(formattedText[3].second.GetUserData() == 0);
+    REQUIRE(formattedText[4].first == " (");
+    REQUIRE(formattedText[5].first == "\"Multi line\"");
+    REQUIRE(formattedText[5].second.GetUserData() == 2);
+    REQUIRE(formattedText[6].first == ")");
+
+    REQUIRE(formatter.GetFullText(instruction, metadata) ==
+            "Set MyObject to 1 + 2 (\"Multi line\")");
+  }
+
+  SECTION("Placeholders of parameters not in the metadata are kept") {
+    gd::InstructionMetadata metadata =
+        MakeMetadata("_PARAM0_ and _PARAM0_, _PARAM1_", 1);
+    REQUIRE(formatter.GetFullText(instruction, metadata) ==
+            "1 + 2 and 1 + 2, _PARAM1_");
+  }
+
+  SECTION("Changes of the metadata are taken into account") {
+    gd::InstructionMetadata metadata = MakeMetadata("Set _PARAM0_", 1);
+    REQUIRE(formatter.GetFullText(instruction, metadata) == "Set 1 + 2");
+
+    // Same address, other sentence and parameters.
+    metadata = MakeMetadata("Set _PARAM1_", 2);
+    REQUIRE(formatter.GetFullText(instruction, metadata) == "Set MyObject");
+
+    metadata = MakeMetadata("Set _PARAM2_", 3);
+    REQUIRE(formatter.GetFullText(instruction, metadata) ==
+            "Set \"Multi line\"");
+  }
+}
+
+TEST_CASE("InstructionSentenceFormatter - Benchmarks", "[common][events]") {
+  gd::InstructionSentenceFormatter &formatter =
+      *gd::InstructionSentenceFormatter::Get();
+  gd::InstructionMetadata metadata = MakeMetadata(
+      "Change the _PARAM3_ of _PARAM0_: _PARAM1_ _PARAM2_ (layer: _PARAM4_)",
+      5);
+
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(5);
+  instruction.SetParameter(0, gd::Expression("MyObject"));
+  instruction.SetParameter(1, gd::Expression("+"));
+  instruction.SetParameter(2, gd::Expression("MyObject.Variable(Speed) * 2"));
+  instruction.SetParameter(3, gd::Expression("position"));
+  instruction.SetParameter(4, gd::Expression("\"Background\""));
+
+  DoBenchmark("Format 100k instructions sentences", 3, [&]() {
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+      length += formatter.GetFullText(instruction, metadata).size();
+    REQUIRE(length == 100000 * 85);
+  });
+}
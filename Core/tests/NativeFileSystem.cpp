@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/NativeFileSystem.h"
+
+#if !defined(WINDOWS)
+#include <sys/stat.h>
+#include <utime.h>
+#endif
+
+#include "GDCore/Tools/MappedFile.h"
+#include "catch.hpp"
+
+TEST_CASE("NativeFileSystem", "[common]") {
+  gd::NativeFileSystem fs;
+
+  SECTION("Paths") {
+    REQUIRE(gd::NativeFileSystem::NormalizePath("/a/./b//c/../d/") == "/a/b/d");
+    REQUIRE(gd::NativeFileSystem::NormalizePath("a\\b/../../../c") == "../c");
+    REQUIRE(gd::NativeFileSystem::NormalizePath("/../a") == "/a");
+    REQUIRE(gd::NativeFileSystem::NormalizePath("C:\\a\\..\\b") == "C:/b");
+    REQUIRE(gd::NativeFileSystem::NormalizePath("a/..") == ".");
+
+    REQUIRE(fs.FileNameFrom("/a/b/c.png") == "c.png");
+    REQUIRE(fs.FileNameFrom("c.png") == "c.png");
+    REQUIRE(fs.DirNameFrom("/a/b/c.png") == "/a/b");
+    REQUIRE(fs.DirNameFrom("/c.png") == "/");
+    REQUIRE(fs.DirNameFrom("c.png") == ".");
+
+    REQUIRE(fs.IsAbsolute("/a"));
+    REQUIRE(fs.IsAbsolute("C:/a"));
+    REQUIRE(fs.IsAbsolute("https://example.com/a.png"));
+    REQUIRE(!fs.IsAbsolute("a/b"));
+
+    gd::String filename = "../c/d.png";
+    REQUIRE(fs.MakeAbsolute(filename, "/a/b"));
+    REQUIRE(filename == "/a/c/d.png");
+    filename = "/e/f.png";
+    REQUIRE(fs.MakeAbsolute(filename, "/a/b"));
+    REQUIRE(filename == "/e/f.png");
+
+    REQUIRE(fs.MakeRelative(filename, "/e"));
+    REQUIRE(filename == "f.png");
+    filename = "/a/c/d.png";
+    REQUIRE(fs.MakeRelative(filename, "/a/b/"));
+    REQUIRE(filename == "../c/d.png");
+
+    filename = "https://example.com/a.png";
+    REQUIRE(fs.MakeAbsolute(filename, "/a/b"));
+    REQUIRE(fs.MakeRelative(filename, "/a/b"));
+    REQUIRE(filename == "https://example.com/a.png");
+  }
+
+#if !defined(WINDOWS)
+  SECTION("Files") {
+    const gd::String dir = fs.GetTempDir() + "/GDNativeFileSystemTest";
+    fs.ClearDir(dir);
+    REQUIRE(fs.DirExists(dir));
+
+    // Directories are created when files are written.
+    REQUIRE(fs.WriteToFile(dir + "/sub/dir/file.txt", "Hello wörld"));
+    REQUIRE(fs.DirExists(dir + "/sub/dir"));
+    REQUIRE(fs.FileExists(dir + "/sub/dir/file.txt"));
+    REQUIRE(!fs.FileExists(dir + "/sub/dir"));
+    REQUIRE(fs.ReadFile(dir + "/sub/dir/file.txt") == "Hello wörld");
+
+    auto mappedFile = fs.MapFile(dir + "/sub/dir/file.txt", false);
+    REQUIRE(mappedFile != nullptr);
+    REQUIRE(gd::String::FromUTF8(std::string(mappedFile->GetData(),
+                                             mappedFile->GetSize())) ==
+            "Hello wörld");
+    REQUIRE(fs.MapFile(dir + "/missing.txt", false) == nullptr);
+
+    REQUIRE(fs.CopyFile(dir + "/sub/dir/file.txt", dir + "/copy/file.TXT"));
+    REQUIRE(fs.ReadFile(dir + "/copy/file.TXT") == "Hello wörld");
+    REQUIRE(fs.IsFileCopyUpToDate(dir + "/sub/dir/file.txt",
+                                  dir + "/copy/file.TXT"));
+    REQUIRE(!fs.IsFileCopyUpToDate(dir + "/sub/dir/file.txt",
+                                   dir + "/copy/missing.txt"));
+
+    // A different file of the same size is not up to date, even if newer.
+    REQUIRE(fs.WriteToFile(dir + "/copy/file.TXT", "Hello wörlD"));
+    struct stat fileStat;
+    REQUIRE(stat((dir + "/sub/dir/file.txt").c_str(), &fileStat) == 0);
+    struct utimbuf times;
+    times.actime = fileStat.st_atime;
+    times.modtime = fileStat.st_mtime + 10;
+    REQUIRE(utime((dir + "/copy/file.TXT").c_str(), &times) == 0);
+    REQUIRE(!fs.IsFileCopyUpToDate(dir + "/sub/dir/file.txt",
+                                   dir + "/copy/file.TXT"));
+    REQUIRE(fs.CopyFile(dir + "/sub/dir/file.txt", dir + "/copy/file.TXT"));
+    REQUIRE(fs.IsFileCopyUpToDate(dir + "/sub/dir/file.txt",
+                                  dir + "/copy/file.TXT"));
+    REQUIRE(!fs.CopyFile(dir + "/missing.txt", dir + "/copy/missing.txt"));
+
+    REQUIRE(fs.LinkFile(dir + "/sub/dir/file.txt", dir + "/copy/link.txt"));
+    REQUIRE(fs.ReadFile(dir + "/copy/link.txt") == "Hello wörld");
+    REQUIRE(fs.WriteToFile(dir + "/copy/other.png", ""));
+
+    std::vector<gd::String> files = fs.ReadDir(dir + "/copy", ".txt");
+    REQUIRE(files.size() == 2);
+    REQUIRE(files[0] == dir + "/copy/file.TXT");
+    REQUIRE(files[1] == dir + "/copy/link.txt");
+    REQUIRE(fs.ReadDir(dir + "/copy").size() == 3);
+
+    REQUIRE(fs.ClearDir(dir));
+    REQUIRE(fs.DirExists(dir));
+    REQUIRE(fs.ReadDir(dir).empty());
+
+    REQUIRE(fs.WriteToFile(dir + "/sub/file.txt", ""));
+    REQUIRE(fs.RemoveDir(dir));
+    REQUIRE(!fs.DirExists(dir));
+    REQUIRE(fs.RemoveDir(dir));
+  }
+#endif
+}
@@ -0,0 +1,165 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <memory>
+#include <string>
+
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+void FillLayout(gd::Project &project,
+                gd::Layout &layout,
+                std::size_t instancesCount) {
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    auto &instance = layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MyObject");
+    instance.SetX(i);
+    instance.SetY(i * 2);
+  }
+
+  gd::StandardEvent event;
+  gd::Instruction action;
+  action.SetType("MyExtension::DoSomething");
+  action.SetParametersCount(1);
+  action.SetParameter(0, gd::Expression("MyObject.GetNumber() + 1"));
+  event.GetActions().Insert(action);
+  layout.GetEvents().InsertEvent(event);
+}
+
+void SetupProject(gd::Project &project,
+                  std::size_t layoutsCount,
+                  std::size_t instancesCount) {
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    FillLayout(project,
+               project.InsertNewLayout("Layout" + gd::String::From(i), i),
+               instancesCount);
+  }
+  project.InsertNewExternalEvents("MyExternalEvents", 0)
+      .SetAssociatedLayout("Layout0");
+  project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+}
+
+gd::String ToJSON(const gd::Project &project) {
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+}  // namespace
+
+TEST_CASE("Project binary serialization", "[common][project]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupProject(project, 3, 10);
+
+  auto data = std::make_shared<std::string>();
+  project.SerializeToBinary(*data);
+
+  // Binary projects must be loaded like JSON ones (the platforms are not
+  // registered, so they won't be found when loading).
+  gd::Project projectFromJSON;
+  projectFromJSON.UnserializeFrom(gd::Serializer::FromJSON(ToJSON(project)));
+
+  SECTION("Round trip") {
+    gd::Project loadedProject;
+    REQUIRE(loadedProject.UnserializeFromBinary(data));
+    REQUIRE(loadedProject.GetLazyLayoutsCount() == 0);
+    REQUIRE(loadedProject.GetLayoutsCount() == 3);
+    REQUIRE(loadedProject.GetExternalEventsCount() == 1);
+    REQUIRE(loadedProject.GetEventsFunctionsExtensionsCount() == 1);
+    REQUIRE(ToJSON(loadedProject) == ToJSON(projectFromJSON));
+  }
+
+  SECTION("Lazy loading of layouts") {
+    gd::Project loadedProject;
+    REQUIRE(loadedProject.UnserializeFromBinary(data, true));
+    REQUIRE(loadedProject.GetLayoutsCount() == 3);
+    REQUIRE(loadedProject.GetLazyLayoutsCount() == 3);
+    REQUIRE(loadedProject.HasLayoutNamed("Layout1"));
+    REQUIRE(loadedProject.GetLayoutPosition("Layout2") == 2);
+    REQUIRE(loadedProject.GetExternalEventsCount() == 1);
+
+    const gd::Layout &layout = loadedProject.GetLayout("Layout1");
+    REQUIRE(loadedProject.GetLazyLayoutsCount() == 2);
+    REQUIRE(layout.GetInitialInstances().GetInstancesCount() == 10);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+
+    gd::Project copiedProject = loadedProject;
+    REQUIRE(copiedProject.GetLazyLayoutsCount() == 2);
+
+    loadedProject.RemoveLayout("Layout2");
+    REQUIRE(loadedProject.GetLazyLayoutsCount() == 1);
+
+    REQUIRE(ToJSON(copiedProject) == ToJSON(projectFromJSON));
+    REQUIRE(copiedProject.GetLazyLayoutsCount() == 0);
+  }
+
+  SECTION("Invalid data") {
+    gd::Project loadedProject;
+    REQUIRE(loadedProject.UnserializeFromBinary(
+                std::make_shared<std::string>("{}")) == false);
+
+    auto truncatedData =
+        std::make_shared<std::string>(data->substr(0, data->size() / 2));
+    REQUIRE(loadedProject.UnserializeFromBinary(truncatedData) == false);
+  }
+}
+
+TEST_CASE("Project binary serialization - Benchmarks", "[common][project]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupProject(project, 20, 2000);
+
+  gd::String json = ToJSON(project);
+  auto data = std::make_shared<std::string>();
+  project.SerializeToBinary(*data);
+  std::cout << "Project with 20 layouts of 2k instances: " << json.Raw().size()
+            << " bytes in JSON, " << data->size() << " bytes in binary."
+            << std::endl;
+
+  DoBenchmark("Save project with 20 layouts to JSON", 3, [&]() {
+    REQUIRE(ToJSON(project).Raw().size() == json.Raw().size());
+  });
+  DoBenchmark("Save project with 20 layouts to binary", 3, [&]() {
+    std::string output;
+    project.SerializeToBinary(output);
+    REQUIRE(output.size() == data->size());
+  });
+  DoBenchmark("Load project with 20 layouts from JSON", 3, [&]() {
+    gd::Project loadedProject;
+    loadedProject.UnserializeFrom(gd::Serializer::FromJSON(json));
+    REQUIRE(loadedProject.GetLayoutsCount() == 20);
+  });
+  DoBenchmark("Load project with 20 layouts from binary", 3, [&]() {
+    gd::Project loadedProject;
+    loadedProject.UnserializeFromBinary(data);
+    REQUIRE(loadedProject.GetLayoutsCount() == 20);
+  });
+  DoBenchmark(
+      "Load project with 20 layouts from binary, lazily, and open one layout",
+      3,
+      [&]() {
+        gd::Project loadedProject;
+        loadedProject.UnserializeFromBinary(data, true);
+        REQUIRE(loadedProject.GetLayout("Layout3")
+                    .GetInitialInstances()
+                    .GetInstancesCount() == 2000);
+      });
+}
@@ -0,0 +1,212 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkTools.h"
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+void FillInstances(gd::InitialInstancesContainer &instances,
+                   std::size_t instancesCount) {
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    auto &instance = instances.InsertNewInitialInstance();
+    instance.SetObjectName("MyObject");
+    instance.SetX(i);
+  }
+}
+
+void SetupProject(gd::Project &project,
+                  std::size_t layoutsCount,
+                  std::size_t instancesCount,
+                  std::size_t eventsCount) {
+  for (std::size_t i = 0; i < layoutsCount; ++i) {
+    gd::Layout &layout =
+        project.InsertNewLayout("Layout" + gd::String::From(i), i);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    FillInstances(layout.GetInitialInstances(), instancesCount);
+
+    gd::StandardEvent event;
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomething");
+    action.SetParametersCount(1);
+    action.SetParameter(0, gd::Expression("MyObject.GetNumber() + 1"));
+    event.GetActions().Insert(action);
+    for (std::size_t j = 0; j < eventsCount; ++j)
+      layout.GetEvents().InsertEvent(event);
+  }
+  FillInstances(
+      project.InsertNewExternalLayout("MyExternalLayout", 0)
+          .GetInitialInstances(),
+      instancesCount);
+}
+
+/**
+ * \brief A worker renaming the images, if a new name is given.
+ */
+class ImageRenamingWorker : public gd::ArbitraryResourceWorker {
+ public:
+  ImageRenamingWorker(const gd::String &newImageName_)
+      : newImageName(newImageName_){};
+  virtual ~ImageRenamingWorker(){};
+
+  virtual void ExposeFile(gd::String &file){};
+  virtual void ExposeImage(gd::String &imageName) {
+    if (!newImageName.empty()) imageName = newImageName;
+  };
+
+  gd::String newImageName;
+};
+
+gd::String ToJSON(const gd::Project &project) {
+  gd::SerializerElement element;
+  project.SerializeTo(element);
+  return gd::Serializer::ToJSON(element);
+}
+}  // namespace
+
+TEST_CASE("Project copy-on-write", "[common][project]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupProject(project, 2, 10, 3);
+  gd::String json = ToJSON(project);
+
+  SECTION("Copy is identical to the original project") {
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+    REQUIRE(ToJSON(copiedProject) == json);
+
+    // Copies of a copy-on-write project are independent of the original one.
+    gd::Project copyOfCopiedProject = copiedProject;
+    REQUIRE(ToJSON(copyOfCopiedProject) == json);
+  }
+
+  SECTION("Contents are shared until modified") {
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+
+    const gd::Project &constCopiedProject = copiedProject;
+    REQUIRE(&constCopiedProject.GetLayout(0).GetInitialInstances() ==
+            &project.GetLayout(0).GetInitialInstances());
+    REQUIRE(&constCopiedProject.GetLayout(0).GetEvents() ==
+            &project.GetLayout(0).GetEvents());
+    REQUIRE(&constCopiedProject.GetExternalLayout(0).GetInitialInstances() ==
+            &project.GetExternalLayout(0).GetInitialInstances());
+
+    copiedProject.GetLayout(0).GetInitialInstances().InsertNewInitialInstance();
+    copiedProject.GetLayout(1).GetEvents().RemoveEvent(0);
+    copiedProject.GetExternalLayout(0).GetInitialInstances().Clear();
+    REQUIRE(&constCopiedProject.GetLayout(0).GetInitialInstances() !=
+            &project.GetLayout(0).GetInitialInstances());
+    REQUIRE(&constCopiedProject.GetLayout(0).GetEvents() ==
+            &project.GetLayout(0).GetEvents());
+
+    REQUIRE(copiedProject.GetLayout(0)
+                .GetInitialInstances()
+                .GetInstancesCount() == 11);
+    REQUIRE(copiedProject.GetLayout(1).GetEvents().GetEventsCount() == 2);
+    REQUIRE(copiedProject.GetExternalLayout(0)
+                .GetInitialInstances()
+                .GetInstancesCount() == 0);
+    REQUIRE(ToJSON(project) == json);
+  }
+
+  SECTION("Exposing resources only copies the events it changes") {
+    gd::StandardEvent event;
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomethingWithResources");
+    action.SetParametersCount(3);
+    action.SetParameter(1, gd::Expression("MyImage"));
+    event.GetActions().Insert(action);
+    gd::StandardEvent parentEvent;
+    parentEvent.GetSubEvents().InsertEvent(event);
+    project.GetLayout(1).GetEvents().InsertEvent(parentEvent);
+    json = ToJSON(project);
+
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+    const gd::Project &constCopiedProject = copiedProject;
+    ImageRenamingWorker worker("");
+    copiedProject.ExposeResources(worker);
+    REQUIRE(&constCopiedProject.GetLayout(0).GetEvents() ==
+            &project.GetLayout(0).GetEvents());
+    REQUIRE(&constCopiedProject.GetLayout(1).GetEvents() ==
+            &project.GetLayout(1).GetEvents());
+
+    ImageRenamingWorker renamingWorker("MyRenamedImage");
+    copiedProject.ExposeResources(renamingWorker);
+    REQUIRE(&constCopiedProject.GetLayout(0).GetEvents() ==
+            &project.GetLayout(0).GetEvents());
+    REQUIRE(&constCopiedProject.GetLayout(1).GetEvents() !=
+            &project.GetLayout(1).GetEvents());
+    const gd::Instruction &renamedAction =
+        dynamic_cast<gd::StandardEvent &>(
+            copiedProject.GetLayout(1).GetEvents().GetEvent(3))
+            .GetSubEvents()
+            .GetEvent(0)
+            .GetAllActionsVectors()[0]
+            ->Get(0);
+    REQUIRE(renamedAction.GetParameter(1).GetPlainString() ==
+            "MyRenamedImage");
+    REQUIRE(ToJSON(project) == json);
+  }
+
+  SECTION("Stripping a copy doesn't change the original project") {
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+    gd::ProjectStripper::StripProjectForExport(copiedProject);
+
+    REQUIRE(copiedProject.GetLayout(0).GetEvents().GetEventsCount() == 0);
+    REQUIRE(project.GetLayout(0).GetEvents().GetEventsCount() == 3);
+    REQUIRE(ToJSON(project) == json);
+  }
+
+  SECTION("Unserializing a copy doesn't change the original project") {
+    gd::Project otherProject;
+    SetupProjectWithDummyPlatform(otherProject, platform);
+    SetupProject(otherProject, 2, 5, 1);
+    gd::SerializerElement otherLayoutElement;
+    otherProject.GetLayout(0).SerializeTo(otherLayoutElement);
+
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+    copiedProject.GetLayout(0).UnserializeFrom(copiedProject,
+                                               otherLayoutElement);
+    REQUIRE(copiedProject.GetLayout(0)
+                .GetInitialInstances()
+                .GetInstancesCount() == 5);
+    REQUIRE(copiedProject.GetLayout(0).GetEvents().GetEventsCount() == 1);
+    REQUIRE(ToJSON(project) == json);
+  }
+}
+
+TEST_CASE("Project copy-on-write - Benchmarks", "[common][project]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupProject(project, 20, 2000, 200);
+
+  DoBenchmark("Copy project with 20 layouts", 3, [&]() {
+    gd::Project copiedProject = project;
+    REQUIRE(copiedProject.GetLayoutsCount() == 20);
+  });
+  DoBenchmark("Copy project with 20 layouts, copy-on-write", 3, [&]() {
+    gd::Project copiedProject;
+    copiedProject.CopyOnWriteFrom(project);
+    REQUIRE(copiedProject.GetLayoutsCount() == 20);
+  });
+}
@@ -0,0 +1,141 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectFileReader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Tools/MappedFile.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A file system reading files from the disk, mapping them in memory
+ * if asked to.
+ */
+class LocalFileSystem : public gd::AbstractFileSystem {
+ public:
+  LocalFileSystem(bool mapFiles_) : mapFiles(mapFiles_){};
+  virtual ~LocalFileSystem(){};
+
+  void MkDir(const gd::String& path) override{};
+  bool DirExists(const gd::String& path) override { return true; };
+  bool FileExists(const gd::String& path) override { return true; };
+  gd::String FileNameFrom(const gd::String& file) override { return file; };
+  gd::String DirNameFrom(const gd::String& file) override { return ""; };
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    return false;
+  };
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    return false;
+  };
+  bool IsAbsolute(const gd::String& filename) override { return false; }
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override {
+    return false;
+  }
+  bool ClearDir(const gd::String& directory) override { return true; }
+  bool WriteToFile(const gd::String& file,
+                   const gd::String& content) override {
+    std::ofstream stream(file.c_str(), std::ios::binary);
+    stream << content.Raw();
+    return stream.good();
+  }
+  gd::String ReadFile(const gd::String& file) override {
+    readFilesCount++;
+    std::ifstream stream(file.c_str(), std::ios::binary);
+    std::stringstream content;
+    content << stream.rdbuf();
+    gd::String str;
+    str.Raw() = content.str();
+    return str;
+  }
+  std::shared_ptr<gd::MappedFile> MapFile(const gd::String& file,
+                                          bool writable) override {
+    if (!mapFiles) return nullptr;
+
+    auto mappedFile = std::make_shared<gd::MappedFile>();
+    if (!mappedFile->Open(file, writable)) return nullptr;
+
+    mappedFilesCount++;
+    return mappedFile;
+  }
+  gd::String GetTempDir() override { return ""; }
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override {
+    return std::vector<gd::String>();
+  }
+
+  bool mapFiles;
+  std::size_t readFilesCount = 0;
+  std::size_t mappedFilesCount = 0;
+};
+}  // namespace
+
+TEST_CASE("ProjectFileReader", "[common]") {
+  const gd::String json =
+      "{\"name\":\"My project\",\"escaped\":\"a \\\"quoted\\\" string\","
+      "\"numbers\":[1,2.5,-3]}";
+  const gd::String jsonFile = "ProjectFileReaderTest.json";
+
+  SECTION("JSON files") {
+    for (bool mapFiles : {false, true}) {
+      for (bool inSitu : {false, true}) {
+        LocalFileSystem fs(mapFiles);
+        fs.WriteToFile(jsonFile, json);
+
+        gd::SerializerElement element =
+            gd::ProjectFileReader::ReadJSON(fs, jsonFile, inSitu);
+        REQUIRE(gd::Serializer::ToJSON(element) == json);
+        REQUIRE(fs.mappedFilesCount == (mapFiles ? 1 : 0));
+        REQUIRE(fs.readFilesCount == (mapFiles ? 0 : 1));
+
+        // The file is not modified by in-situ parsing.
+        REQUIRE(fs.ReadFile(jsonFile) == json);
+      }
+    }
+    std::remove(jsonFile.c_str());
+  }
+
+  SECTION("Binary project files") {
+    const gd::String binaryFile = "ProjectFileReaderTest.gdp";
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.InsertNewLayout("Layout1", 0);
+    project.InsertNewLayout("Layout2", 1);
+
+    std::string data;
+    project.SerializeToBinary(data);
+    {
+      std::ofstream stream(binaryFile.c_str(), std::ios::binary);
+      stream << data;
+    }
+
+    for (bool mapFiles : {false, true}) {
+      LocalFileSystem fs(mapFiles);
+      gd::Project loadedProject;
+      REQUIRE(gd::ProjectFileReader::ReadBinaryProject(
+          fs, binaryFile, loadedProject, true));
+      REQUIRE(fs.mappedFilesCount == (mapFiles ? 1 : 0));
+      REQUIRE(loadedProject.GetLazyLayoutsCount() == 2);
+      REQUIRE(loadedProject.GetLayout("Layout2").GetName() == "Layout2");
+      REQUIRE(loadedProject.GetLazyLayoutsCount() == 1);
+    }
+    std::remove(binaryFile.c_str());
+  }
+}
@@ -0,0 +1,174 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/ParallelFor.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A file system using "/" separated paths, recording the copied and
+ * linked files.
+ */
+class RecordingFileSystem : public gd::AbstractFileSystem {
+ public:
+  RecordingFileSystem() : linksSupported(false), concurrentCopies(false){};
+  virtual ~RecordingFileSystem(){};
+
+  void MkDir(const gd::String& path) override { directories.insert(path); };
+  bool DirExists(const gd::String& path) override {
+    return directories.find(path) != directories.end();
+  };
+  bool FileExists(const gd::String& path) override { return true; };
+  gd::String FileNameFrom(const gd::String& file) override {
+    return file.substr(file.rfind("/") + 1);
+  };
+  gd::String DirNameFrom(const gd::String& file) override {
+    size_t lastSeparator = file.rfind("/");
+    return lastSeparator != gd::String::npos ? file.substr(0, lastSeparator)
+                                             : "";
+  };
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  };
+  bool IsAbsolute(const gd::String& filename) override {
+    return !filename.empty() && filename[0] == '/';
+  }
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    copiedFiles[destination] = file;
+    return true;
+  }
+  bool IsFileCopyUpToDate(const gd::String& file,
+                          const gd::String& destination) override {
+    return upToDateFiles.find(destination) != upToDateFiles.end();
+  }
+  bool LinkFile(const gd::String& file,
+                const gd::String& destination) override {
+    if (!linksSupported) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    linkedFiles[destination] = file;
+    return true;
+  }
+  bool SupportsConcurrentCopies() override { return concurrentCopies; }
+  bool ClearDir(const gd::String& directory) override { return true; }
+  bool WriteToFile(const gd::String& file,
+                   const gd::String& content) override {
+    return true;
+  }
+  gd::String ReadFile(const gd::String& file) override { return ""; }
+  gd::String GetTempDir() override { return "/tmp"; }
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override {
+    return std::vector<gd::String>();
+  }
+
+  std::set<gd::String> directories;
+  std::set<gd::String> upToDateFiles;
+  std::map<gd::String, gd::String> copiedFiles;  ///< Destination to source
+  std::map<gd::String, gd::String> linkedFiles;  ///< Destination to source
+  bool linksSupported;
+  bool concurrentCopies;
+
+ private:
+  std::mutex mutex;
+};
+
+void SetupProjectWithResources(gd::Project& project) {
+  project.SetProjectFile("/my/project/game.json");
+  auto& resourcesManager = project.GetResourcesManager();
+  resourcesManager.AddResource("Image1", "image1.png", "image");
+  resourcesManager.AddResource("Image2", "assets/image2.png", "image");
+  resourcesManager.AddResource("Audio1", "/absolute/audio1.mp3", "audio");
+}
+}  // namespace
+
+TEST_CASE("ProjectResourcesCopier", "[common][resources]") {
+  gd::Project project;
+  SetupProjectWithResources(project);
+  RecordingFileSystem fs;
+
+  SECTION("Copy resources without changing the original project") {
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true);
+
+    REQUIRE(fs.copiedFiles.size() == 3);
+    REQUIRE(fs.copiedFiles["/export/image1.png"] == "/my/project/image1.png");
+    REQUIRE(fs.copiedFiles["/export/assets/image2.png"] ==
+            "/my/project/assets/image2.png");
+    REQUIRE(fs.copiedFiles["/export/audio1.mp3"] == "/absolute/audio1.mp3");
+    REQUIRE(fs.directories.count("/export/assets") == 1);
+
+    auto& resourcesManager = project.GetResourcesManager();
+    REQUIRE(resourcesManager.GetResource("Image2").GetFile() ==
+            "assets/image2.png");
+    REQUIRE(resourcesManager.GetResource("Audio1").GetFile() ==
+            "/absolute/audio1.mp3");
+  }
+
+  SECTION("Copy resources and update the original project") {
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", true, false, true);
+
+    REQUIRE(fs.copiedFiles.size() == 3);
+    auto& resourcesManager = project.GetResourcesManager();
+    REQUIRE(resourcesManager.GetResource("Image2").GetFile() ==
+            "assets/image2.png");
+    REQUIRE(resourcesManager.GetResource("Audio1").GetFile() == "audio1.mp3");
+  }
+
+  SECTION("Skip files already up to date") {
+    fs.upToDateFiles.insert("/export/image1.png");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true);
+
+    REQUIRE(fs.copiedFiles.size() == 2);
+    REQUIRE(fs.copiedFiles.count("/export/image1.png") == 0);
+  }
+
+  SECTION("Link files if asked and supported") {
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true, true);
+    REQUIRE(fs.copiedFiles.size() == 3);
+    REQUIRE(fs.linkedFiles.size() == 0);
+
+    fs.copiedFiles.clear();
+    fs.linksSupported = true;
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, true, true);
+    REQUIRE(fs.copiedFiles.size() == 0);
+    REQUIRE(fs.linkedFiles.size() == 3);
+    REQUIRE(fs.linkedFiles["/export/image1.png"] == "/my/project/image1.png");
+  }
+
+  SECTION("Copy files concurrently") {
+    fs.concurrentCopies = true;
+    gd::ParallelFor::SetMaxThreadsCount(4);
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, false, false);
+    gd::ParallelFor::SetMaxThreadsCount(0);
+
+    REQUIRE(fs.copiedFiles.size() == 3);
+    REQUIRE(fs.copiedFiles["/export/image2.png"] ==
+            "/my/project/assets/image2.png");
+  }
+}
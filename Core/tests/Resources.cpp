@@ -8,6 +8,7 @@
  */
 #include <string>
 
+#include "BenchmarkTools.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Serialization/Serializer.h"
@@ -33,3 +34,111 @@ TEST_CASE("Resources", "[common][resources]") {
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
 }
+
+TEST_CASE("ResourcesManager", "[common][resources]") {
+  gd::ResourcesManager resourcesManager;
+  resourcesManager.AddResource("MyImage", "image.png", "image");
+  resourcesManager.AddResource("MyAudio", "audio.mp3", "audio");
+  resourcesManager.AddResource("MyOtherImage", "image.png", "image");
+
+  SECTION("Lookups") {
+    REQUIRE(resourcesManager.HasResource("MyImage"));
+    REQUIRE(resourcesManager.HasResource("MyOtherImage"));
+    REQUIRE(!resourcesManager.HasResource("MyUnknownResource"));
+    REQUIRE(resourcesManager.GetResourcePosition("MyAudio") == 1);
+    REQUIRE(resourcesManager.GetResource("MyAudio").GetKind() == "audio");
+    REQUIRE(resourcesManager.GetResourceSPtr("MyUnknownResource") ==
+            std::shared_ptr<gd::Resource>());
+    REQUIRE(resourcesManager.GetResourceNameWithFile("image.png") == "MyImage");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("audio.mp3") == "MyAudio");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("unknown.png") == "");
+    REQUIRE(resourcesManager.FindFilesNotInResources(
+                {"image.png", "unknown.png"}) ==
+            std::vector<gd::String>{"unknown.png"});
+  }
+
+  SECTION("Lookups after changes") {
+    resourcesManager.RenameResource("MyImage", "MyRenamedImage");
+    REQUIRE(!resourcesManager.HasResource("MyImage"));
+    REQUIRE(resourcesManager.GetResourcePosition("MyRenamedImage") == 0);
+
+    // Resources changed directly are found too.
+    resourcesManager.GetResource("MyAudio").SetName("MyMusic");
+    REQUIRE(!resourcesManager.HasResource("MyAudio"));
+    REQUIRE(resourcesManager.HasResource("MyMusic"));
+    resourcesManager.GetResource("MyMusic").SetFile("music.mp3");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("music.mp3") == "MyMusic");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("audio.mp3") == "");
+
+    resourcesManager.MoveResource(0, 2);
+    REQUIRE(resourcesManager.GetResourcePosition("MyRenamedImage") == 2);
+    REQUIRE(resourcesManager.GetResourceNameWithFile("image.png") ==
+            "MyOtherImage");
+
+    resourcesManager.RemoveResource("MyOtherImage");
+    REQUIRE(!resourcesManager.HasResource("MyOtherImage"));
+    REQUIRE(resourcesManager.GetResourcePosition("MyRenamedImage") == 1);
+    REQUIRE(resourcesManager.GetResourceNameWithFile("image.png") ==
+            "MyRenamedImage");
+
+    REQUIRE(resourcesManager.AddResource("MyImage", "new-image.png", "image"));
+    REQUIRE(!resourcesManager.AddResource("MyImage", "image.png", "image"));
+    REQUIRE(resourcesManager.GetResourcePosition("MyImage") == 2);
+    REQUIRE(resourcesManager.GetResourceNameWithFile("new-image.png") ==
+            "MyImage");
+  }
+
+  SECTION("Copies and removed resources are independent") {
+    gd::ResourcesManager copiedManager = resourcesManager;
+    copiedManager.GetResource("MyImage").SetName("MyCopiedImage");
+    REQUIRE(copiedManager.HasResource("MyCopiedImage"));
+    REQUIRE(!resourcesManager.HasResource("MyCopiedImage"));
+    REQUIRE(resourcesManager.HasResource("MyImage"));
+
+    auto removedResource = resourcesManager.GetResourceSPtr("MyAudio");
+    resourcesManager.RemoveResource("MyAudio");
+    removedResource->SetName("MyOtherImage");
+    REQUIRE(resourcesManager.GetResourcePosition("MyOtherImage") == 1);
+  }
+
+  SECTION("Serialization") {
+    gd::SerializerElement element;
+    resourcesManager.SerializeTo(element);
+
+    gd::ResourcesManager unserializedManager;
+    unserializedManager.UnserializeFrom(element);
+    REQUIRE(unserializedManager.GetResourcePosition("MyOtherImage") == 2);
+    REQUIRE(unserializedManager.GetResourceNameWithFile("audio.mp3") ==
+            "MyAudio");
+  }
+}
+
+TEST_CASE("ResourcesManager - Benchmarks", "[common][resources]") {
+  const std::size_t resourcesCount = 20000;
+  gd::ResourcesManager resourcesManager;
+  std::vector<gd::String> names;
+  std::vector<gd::String> files;
+  for (std::size_t i = 0; i < resourcesCount; ++i) {
+    names.push_back("Resource" + gd::String::From(i));
+    files.push_back("assets/resource" + gd::String::From(i) + ".png");
+    resourcesManager.AddResource(names.back(), files.back(), "image");
+  }
+
+  SECTION("Lookups in 20k resources") {
+    DoBenchmark("Get 20k resources by name", 10, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto &name : names) {
+        if (resourcesManager.GetResource(name).GetName() == name) foundCount++;
+      }
+      REQUIRE(foundCount == resourcesCount);
+    });
+    DoBenchmark("Get 20k resource names by file", 10, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < resourcesCount; ++i) {
+        if (resourcesManager.GetResourceNameWithFile(files[i]) == names[i])
+          foundCount++;
+      }
+      REQUIRE(foundCount == resourcesCount);
+    });
+  }
+}
@@ -38,4 +38,15 @@ TEST_CASE("SceneNameMangler", "[common]") {
     REQUIRE(gd::SceneNameMangler::Get()->GetMangledSceneName(
                 u8"汉语") == u8"_27721_35821");
   }
+
+  SECTION("Singleton") {
+    gd::SceneNameMangler* mangler = gd::SceneNameMangler::Get();
+    REQUIRE(gd::SceneNameMangler::Get() == mangler);
+
+    // Destroying the singleton only clears the memoized names.
+    gd::SceneNameMangler::DestroySingleton();
+    REQUIRE(gd::SceneNameMangler::Get() == mangler);
+    REQUIRE(mangler->GetMangledSceneName(u8"Nouvelle scène") ==
+            u8"Nouvelle_32sc_232ne");
+  }
 }
@@ -7,6 +7,7 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerBinaryBuffer.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -21,6 +22,58 @@
 
 using namespace gd;
 
+TEST_CASE("SerializerValue", "[common]") {
+  SECTION("Types and raw values") {
+    SerializerValue value;
+    REQUIRE(value.GetType() == SerializerValue::Unknown);
+
+    value.SetString("Hello world, with a string too long to be inlined");
+    REQUIRE(value.IsString());
+    REQUIRE(value.GetRawString() ==
+            "Hello world, with a string too long to be inlined");
+
+    value.SetInt(42);
+    REQUIRE(value.GetType() == SerializerValue::Int);
+    REQUIRE(value.GetRawInt() == 42);
+    REQUIRE(value.GetRawString() == "");
+    REQUIRE(value.GetString() == "42");
+
+    value.SetDouble(4.5);
+    REQUIRE(value.IsDouble());
+    REQUIRE(value.GetRawDouble() == 4.5);
+    REQUIRE(value.GetInt() == 4);
+
+    value.SetBool(true);
+    REQUIRE(value.IsBoolean());
+    REQUIRE(value.GetRawBool() == true);
+    REQUIRE(value.GetDouble() == 1);
+
+    value.Set("false");
+    REQUIRE(value.GetType() == SerializerValue::Unknown);
+    REQUIRE(value.GetBool() == false);
+    REQUIRE(value.GetString() == "false");
+  }
+
+  SECTION("Copying and moving") {
+    SerializerValue stringValue(gd::String("Some long enough string value"));
+    SerializerValue copiedValue(stringValue);
+    SerializerValue assignedValue(12);
+    assignedValue = stringValue;
+    REQUIRE(copiedValue.GetRawString() == "Some long enough string value");
+    REQUIRE(assignedValue.GetRawString() == "Some long enough string value");
+
+    assignedValue = SerializerValue(3.5);
+    REQUIRE(assignedValue.GetRawDouble() == 3.5);
+
+    SerializerValue movedValue(std::move(copiedValue));
+    REQUIRE(movedValue.GetRawString() == "Some long enough string value");
+    assignedValue = std::move(movedValue);
+    REQUIRE(assignedValue.IsString());
+    REQUIRE(assignedValue.GetRawString() == "Some long enough string value");
+    REQUIRE(stringValue.GetRawString() == "Some long enough string value");
+  }
+}
+
 TEST_CASE("SerializerElement", "[common]") {
   SECTION("Basics and copying") {
     SerializerElement element;
@@ -47,6 +100,87 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(copiedElement.GetStringAttribute("attr1") == "attr123 modified");
   }
 
+  SECTION("Moving") {
+    SerializerElement element;
+    element.AddChild("child1").SetStringValue("value123");
+    element.SetStringAttribute("attr1", "attr123");
+    const SerializerElement* child1 = &element.GetChild("child1");
+
+    SerializerElement movedElement = std::move(element);
+    REQUIRE(&movedElement.GetChild("child1") == child1);
+    REQUIRE(movedElement.GetChild("child1").GetStringValue() == "value123");
+    REQUIRE(movedElement.GetStringAttribute("attr1") == "attr123");
+    REQUIRE(element.GetAllChildren().size() == 0);
+
+    SerializerElement assignedElement;
+    assignedElement.AddChild("child2");
+    assignedElement = std::move(movedElement);
+    REQUIRE(&assignedElement.GetChild("child1") == child1);
+    REQUIRE(assignedElement.HasChild("child2") == false);
+  }
+
+  SECTION("Copy-on-write") {
+    SerializerElement element;
+    element.EnableCopyOnWrite();
+    element.AddChild("child1").AddChild("grandChild").SetStringValue("abc");
+    element.AddChild("child2").SetDoubleValue(45.6);
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.IsCopyOnWriteEnabled());
+    REQUIRE(copiedElement.GetAllChildren()[0].second ==
+            element.GetAllChildren()[0].second);
+
+    // Reading a child does not copy it.
+    const SerializerElement &constCopiedElement = copiedElement;
+    REQUIRE(constCopiedElement.GetChild("child1")
+                .GetChild("grandChild")
+                .GetStringValue() == "abc");
+    REQUIRE(constCopiedElement.GetChild("child2").GetDoubleValue() == 45.6);
+    REQUIRE(copiedElement.GetAllChildren()[0].second ==
+            element.GetAllChildren()[0].second);
+    REQUIRE(copiedElement.GetAllChildren()[1].second ==
+            element.GetAllChildren()[1].second);
+
+    // Accessing a child to modify it gives a copy of it, sharing its own
+    // children.
+    copiedElement.GetChild("child1").SetStringValue("child1 value");
+    REQUIRE(copiedElement.GetAllChildren()[0].second !=
+            element.GetAllChildren()[0].second);
+    REQUIRE(copiedElement.GetAllChildren()[1].second ==
+            element.GetAllChildren()[1].second);
+    REQUIRE(copiedElement.GetChild("child1")
+                .GetAllChildren()[0]
+                .second == element.GetChild("child1").GetAllChildren()[0].second);
+
+    copiedElement.GetChild("child1").GetChild("grandChild").SetStringValue(
+        "def");
+    element.GetChild("child2").SetDoubleValue(7.8);
+    REQUIRE(element.GetChild("child1").GetChild("grandChild").GetStringValue() ==
+            "abc");
+    REQUIRE(copiedElement.GetChild("child1")
+                .GetChild("grandChild")
+                .GetStringValue() == "def");
+    REQUIRE(copiedElement.GetChild("child1").GetStringValue() ==
+            "child1 value");
+    REQUIRE(element.GetChild("child2").GetDoubleValue() == 7.8);
+    REQUIRE(copiedElement.GetChild("child2").GetDoubleValue() == 45.6);
+
+    // Copying an element without copy-on-write copies the children, even
+    // into an element with copy-on-write enabled, and leaves the copied
+    // element unchanged.
+    SerializerElement otherElement;
+    otherElement.AddChild("child").SetStringValue("value");
+    SerializerElement otherCopy;
+    otherCopy.EnableCopyOnWrite();
+    otherCopy = otherElement;
+    REQUIRE_FALSE(otherElement.IsCopyOnWriteEnabled());
+    REQUIRE(otherCopy.IsCopyOnWriteEnabled());
+    REQUIRE(otherCopy.GetAllChildren()[0].second !=
+            otherElement.GetAllChildren()[0].second);
+    otherElement.GetChild("child").SetStringValue("modified");
+    REQUIRE(otherCopy.GetChild("child").GetStringValue() == "value");
+  }
+
   SECTION("Accessing already existing children, in objects") {
     SerializerElement element;
     element.AddChild("child1").SetStringValue("value123");
@@ -110,6 +244,76 @@ TEST_CASE("Serializer", "[common]") {
 
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == originalJSON);
+
+    // Invalid JSON gives an empty element.
+    SerializerElement invalidElement = Serializer::FromJSON("{\"ok\":tru}");
+    REQUIRE(invalidElement.GetAllChildren().empty());
+    REQUIRE(invalidElement.GetValue().GetString().empty());
+  }
+
+  SECTION("Binary round trip") {
+    gd::String originalJSON =
+        "{\"ok\":true,\"hello\":\"wörld\",\"int\":-42,\"double\":1.5,"
+        "\"array\":[1,\"two\",{\"three\":3},[]],\"empty\":{}}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+    element.SetAttribute("attribute", "value");
+
+    std::string binary;
+    Serializer::ToBinary(element, binary);
+    SerializerElement binaryElement;
+    REQUIRE(Serializer::FromBinary(binary.data(), binary.size(), binaryElement));
+    REQUIRE(binaryElement.GetChild("int").GetValue().IsInt());
+    REQUIRE(binaryElement.GetStringAttribute("attribute") == "value");
+    REQUIRE(Serializer::ToJSON(binaryElement) == Serializer::ToJSON(element));
+
+    SerializerElement truncatedElement;
+    REQUIRE(Serializer::FromBinary(
+                binary.data(), binary.size() - 1, truncatedElement) == false);
+  }
+
+  SECTION("Binary data with too deeply nested elements") {
+    SerializerElement shallowElement;
+    SerializerElement* child = &shallowElement;
+    for (std::size_t i = 0; i < 1000; ++i) child = &child->AddChild("child");
+
+    std::string binary;
+    Serializer::ToBinary(shallowElement, binary);
+    SerializerElement shallowBinaryElement;
+    REQUIRE(Serializer::FromBinary(
+        binary.data(), binary.size(), shallowBinaryElement));
+
+    SerializerElement deepElement;
+    child = &deepElement;
+    for (std::size_t i = 0; i < 2000; ++i) child = &child->AddChild("child");
+
+    binary.clear();
+    Serializer::ToBinary(deepElement, binary);
+    SerializerElement deepBinaryElement;
+    REQUIRE(Serializer::FromBinary(
+                binary.data(), binary.size(), deepBinaryElement) == false);
+  }
+
+  SECTION("Binary buffer") {
+    SerializerElement element =
+        Serializer::FromJSON("{\"hello\":\"world\",\"array\":[1,2.5,true]}");
+
+    gd::SerializerBinaryBuffer buffer;
+    buffer.WriteElement(element);
+    std::string binary;
+    Serializer::ToBinary(element, binary);
+    REQUIRE(std::string(buffer.GetData(), buffer.GetSize()) == binary);
+
+    // Data written directly in the buffer can be read.
+    gd::SerializerBinaryBuffer otherBuffer;
+    otherBuffer.Resize(binary.size());
+    std::copy(binary.begin(), binary.end(), otherBuffer.GetData());
+    SerializerElement bufferElement;
+    REQUIRE(otherBuffer.ReadElement(bufferElement));
+    REQUIRE(Serializer::ToJSON(bufferElement) == Serializer::ToJSON(element));
+
+    otherBuffer.Resize(binary.size() - 1);
+    SerializerElement truncatedElement;
+    REQUIRE(otherBuffer.ReadElement(truncatedElement) == false);
   }
 
   SECTION("Quotes and special characters") {
@@ -14,6 +14,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Tools/FlatArrays.h"
 
 TEST_CASE("VariablesContainer", "[common][variables]") {
   SECTION("Copy and assignment") {
@@ -49,4 +50,60 @@ TEST_CASE("VariablesContainer", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(container3.Get("Variable2").GetValue() == 44);
   }
+
+  SECTION("ExportToFlatArrays and ImportFromFlatArrays") {
+    gd::VariablesContainer container;
+    container.InsertNew("Number").SetValue(42);
+    container.InsertNew("String").SetString("Hello World");
+    container.InsertNew("Boolean").SetBool(true);
+    gd::Variable &structure = container.InsertNew("Structure");
+    structure.GetChild("Child").SetValue(1);
+
+    gd::FlatArrays arrays;
+    container.ExportToFlatArrays(arrays);
+    REQUIRE(arrays.GetElementsCount() == 4);
+    REQUIRE(arrays.GetDoubles(0)[gd::VariablesContainer::VariableValue] ==
+            42);
+    REQUIRE(arrays.GetDoubles(2)[gd::VariablesContainer::VariableValue] == 1);
+    REQUIRE(arrays.GetString(arrays.GetIntegers(
+                1)[gd::VariablesContainer::VariableString]) == "Hello World");
+    REQUIRE(arrays.GetIntegers(3)[gd::VariablesContainer::VariableType] ==
+            gd::Variable::Structure);
+    REQUIRE(arrays.GetIntegers(3)[gd::VariablesContainer::VariableString] ==
+            -1);
+
+    // Swap the first two variables, change a value and remove the boolean.
+    gd::FlatArrays changedArrays;
+    changedArrays.Reset(gd::VariablesContainer::VariableDoublesCount,
+                        gd::VariablesContainer::VariableIntegersCount);
+    changedArrays.Resize(3);
+    for (std::size_t i : {0, 1, 2}) {
+      std::size_t exportedIndex = i == 0 ? 1 : (i == 1 ? 0 : 3);
+      changedArrays.GetDoubles(i)[gd::VariablesContainer::VariableValue] =
+          arrays.GetDoubles(exportedIndex)[gd::VariablesContainer::VariableValue];
+      const std::int32_t *integers = arrays.GetIntegers(exportedIndex);
+      std::int32_t *changedIntegers = changedArrays.GetIntegers(i);
+      changedIntegers[gd::VariablesContainer::VariableName] =
+          changedArrays.AddString(
+              arrays.GetString(integers[gd::VariablesContainer::VariableName]));
+      changedIntegers[gd::VariablesContainer::VariableType] =
+          integers[gd::VariablesContainer::VariableType];
+      changedIntegers[gd::VariablesContainer::VariableString] =
+          changedArrays.AddString(arrays.GetString(
+              integers[gd::VariablesContainer::VariableString]));
+    }
+    changedArrays.GetDoubles(1)[gd::VariablesContainer::VariableValue] = 43;
+
+    container.ImportFromFlatArrays(changedArrays);
+    REQUIRE(container.Count() == 3);
+    REQUIRE(container.GetNameAt(0) == "String");
+    REQUIRE(container.Get(0).GetString() == "Hello World");
+    REQUIRE(container.GetNameAt(1) == "Number");
+    REQUIRE(container.Get(1).GetValue() == 43);
+    REQUIRE(container.Has("Boolean") == false);
+
+    // Existing variables are kept, with their children.
+    REQUIRE(&container.Get("Structure") == &structure);
+    REQUIRE(structure.GetChild("Child").GetValue() == 1);
+  }
 }
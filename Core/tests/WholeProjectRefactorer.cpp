@@ -18,6 +18,7 @@
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h"
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
@@ -27,6 +28,7 @@
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Variable.h"
+#include "GDCore/Tools/ParallelFor.h"
 #include "catch.hpp"
 
 namespace {
@@ -64,6 +66,36 @@ const gd::String &GetEventFirstActionType(gd::BaseEvent &event) {
   return actions.Get(0).GetType();
 }
 
+/**
+ * \brief A worker listing the types of the instructions, with the name of the
+ * objects container they are used in.
+ */
+class InstructionsTypesLister
+    : public gd::ClonableArbitraryEventsWorkerWithContext {
+ public:
+  std::vector<gd::String> types;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    types.push_back(
+        gd::String::From(GetObjectsContainer().GetObjectsCount()) + ":" +
+        instruction.GetType());
+    return false;
+  }
+
+  std::unique_ptr<gd::ClonableArbitraryEventsWorkerWithContext> Clone()
+      const override {
+    return std::unique_ptr<gd::ClonableArbitraryEventsWorkerWithContext>(
+        new InstructionsTypesLister());
+  }
+
+  void Reduce(gd::ClonableArbitraryEventsWorkerWithContext &clone) override {
+    auto &cloneTypes = static_cast<InstructionsTypesLister &>(clone).types;
+    types.insert(types.end(), cloneTypes.begin(), cloneTypes.end());
+  }
+};
+
 gd::EventsFunctionsExtension &SetupProjectWithEventsFunctionExtension(
     gd::Project &project) {
   auto &eventsExtension =
@@ -696,6 +728,37 @@ TEST_CASE("WholeProjectRefactorer", "[common]") {
                     .GetEvent(0)) ==
             "1 + MyEventsExtension::MyRenamedFunctionExpression(123, 456)");
   }
+  SECTION("(Free) events function renamed (with spaces around namespace)") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &eventsExtension = SetupProjectWithEventsFunctionExtension(project);
+
+    // Expressions not containing the function name are not parsed, so check
+    // that the name is still found when written with spaces.
+    auto &action = EnsureStandardEvent(
+                       project.GetExternalEvents("ExternalEventsWithFreeFunctions")
+                           .GetEvents()
+                           .GetEvent(0))
+                       .GetActions()
+                       .Get(0);
+    action.SetParameter(
+        0,
+        gd::Expression(
+            "1 + MyEventsExtension :: MyEventsFunctionExpression(123, 456)"));
+
+    gd::WholeProjectRefactorer::RenameEventsFunction(
+        project,
+        eventsExtension,
+        "MyEventsFunctionExpression",
+        "MyRenamedFunctionExpression");
+
+    REQUIRE(GetEventFirstActionFirstParameterString(
+                project.GetExternalEvents("ExternalEventsWithFreeFunctions")
+                    .GetEvents()
+                    .GetEvent(0)) ==
+            "1 + MyEventsExtension::MyRenamedFunctionExpression(123, 456)");
+  }
   SECTION("(Free) events function parameter moved") {
     gd::Project project;
     gd::Platform platform;
@@ -1445,3 +1508,36 @@ TEST_CASE("WholeProjectRefactorer (FindDependentBehaviorNames failing cases)",
     }
   }
 }
+
+TEST_CASE("WholeProjectRefactorer (ExposeProjectEventsInParallel)",
+          "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &eventsExtension = SetupProjectWithEventsFunctionExtension(project);
+
+  // Add events in an events function too.
+  {
+    gd::StandardEvent event;
+    gd::Instruction instruction;
+    instruction.SetType("MyExtension::DoSomething");
+    event.GetActions().Insert(instruction);
+    eventsExtension.GetEventsFunction("MyEventsFunction")
+        .GetEvents()
+        .InsertEvent(event);
+  }
+
+  InstructionsTypesLister sequentialWorker;
+  gd::WholeProjectRefactorer::ExposeProjectEvents(project, sequentialWorker);
+  REQUIRE(sequentialWorker.types.size() > 10);
+
+  // Results are the same, in the same order, whatever the number of threads.
+  for (std::size_t threadsCount : {1, 4}) {
+    gd::ParallelFor::SetMaxThreadsCount(threadsCount);
+    InstructionsTypesLister parallelWorker;
+    gd::WholeProjectRefactorer::ExposeProjectEventsInParallel(project,
+                                                              parallelWorker);
+    REQUIRE(parallelWorker.types == sequentialWorker.types);
+  }
+  gd::ParallelFor::SetMaxThreadsCount(0);
+}
@@ -48,6 +48,8 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   // Preprocessing then code generation can make changes to the events, so we
   // need to do the work on a copy of the events.
   gd::EventsList generatedEvents = events;
+  if (codeGenerator.GenerateEventsProfilingCode())
+    codeGenerator.AddEventsToProfilingTable(generatedEvents, {});
   codeGenerator.PreprocessEventList(generatedEvents);
   gd::String wholeEventsCode =
       codeGenerator.GenerateEventsListCode(generatedEvents, context);
@@ -69,14 +71,19 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
       codeGenerator.GenerateAllConditionsBooleanDeclarations();
 
   gd::String output =
-      codeGenerator.GetCodeNamespace() + " = {};\n" + globalDeclarations +
-      globalObjectLists + "\n" + globalConditionsBooleans + "\n\n" +
+      globalDeclarations + globalObjectLists + "\n" +
+      globalConditionsBooleans + "\n\n" +
       codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
       fullyQualifiedFunctionName + " = function(" + functionArgumentsCode +
       ") {\n" + functionPreEventsCode + "\n" + globalObjectListsReset + "\n" +
       wholeEventsCode + "\n" + functionReturnCode + "\n" + "}\n";
 
-  return output;
+  // The namespace is accessed with a shorter alias in compact code.
+  if (codeGenerator.GenerateCompactCode())
+    return codeGenerator.GetCodeNamespace() + " = {};\n(function($ns) {\n" +
+           output + "})(" + codeGenerator.GetCodeNamespace() + ");\n";
+
+  return codeGenerator.GetCodeNamespace() + " = {};\n" + output;
 }
 
 gd::String EventsCodeGenerator::GenerateLayoutCode(
@@ -84,10 +91,14 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     const gd::Layout& scene,
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    bool compactCode,
+    gd::SerializerElement* eventsProfilingTable) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetGenerateCompactCode(compactCode);
+  codeGenerator.SetGenerateEventsProfilingCode(eventsProfilingTable != nullptr);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       project,
@@ -100,6 +111,8 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
 
   includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
                       codeGenerator.GetIncludeFiles().end());
+  if (eventsProfilingTable)
+    *eventsProfilingTable = codeGenerator.GetEventsProfilingTable();
   return output;
 }
 
@@ -437,6 +450,10 @@ EventsCodeGenerator::GenerateAllObjectsDeclarationsAndResets(
        &globalObjectListsReset](const gd::Object& object) {
         // Generate declarations for the objects lists
         for (unsigned int j = 1; j <= maxDepthLevelReached; ++j) {
+          if (compactCode &&
+              usedObjectsLists.count(std::make_pair(object.GetName(), j)) == 0)
+            continue;
+
           globalObjectLists += GetCodeNamespaceAccessor() +
                                ManObjListName(object.GetName()) +
                                gd::String::From(j) + "= [];\n";
@@ -767,8 +784,11 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
 
 gd::String EventsCodeGenerator::GetObjectListName(
     const gd::String& name, const gd::EventsCodeGenerationContext& context) {
+  unsigned int depth = context.GetLastDepthObjectListWasNeeded(name);
+  if (compactCode) usedObjectsLists.insert(std::make_pair(name, depth));
+
   return GetCodeNamespaceAccessor() + ManObjListName(name) +
-         gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
+         gd::String::From(depth);
 }
 
 gd::String EventsCodeGenerator::GenerateGetBehaviorNameCode(
@@ -866,6 +886,13 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   gd::String code =
       gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
 
+  auto subEventsIt = subEventsIds.find(&events);
+  if (subEventsIt != subEventsIds.end()) {
+    gd::String section = "subEvents:" + gd::String::From(subEventsIt->second);
+    code = GenerateProfilerSectionBegin(section) + code +
+           GenerateProfilerSectionEnd(section);
+  }
+
   gd::String parametersCode = HasProjectAndLayout()
                                   ? "runtimeScene"
                                   : "runtimeScene, eventsFunctionContext";
@@ -892,11 +919,32 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
 gd::String EventsCodeGenerator::GenerateConditionsListCode(
     gd::InstructionsList& conditions,
     gd::EventsCodeGenerationContext& context) {
+  std::vector<gd::String> conditionsCodes;
+  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+    gd::String conditionCode =
+        GenerateConditionCode(conditions[cId],
+                              "condition" + gd::String::From(cId) + "IsTrue",
+                              context);
+    conditionsCodes.push_back(
+        conditions[cId].GetType().empty() ? "" : conditionCode);
+  }
+
   gd::String outputCode;
+  for (std::size_t i = 0; i < conditions.size(); ++i) {
+    // *Optimization*: a condition setting its boolean whatever its result
+    // does not need it to be reset, if the boolean is only read after the
+    // condition is evaluated. This is not the case of the last boolean, read
+    // after the list even if a previous condition is false, nor of the
+    // booleans of lists inside conditions (like "And"), read by the condition.
+    gd::String booleanName = "condition" + gd::String::From(i) + "IsTrue";
+    if (compactCode && context.GetCurrentConditionDepth() == 0 &&
+        (i == 0 || i + 1 < conditions.size()) &&
+        conditionsCodes[i].find(GenerateBooleanFullName(booleanName, context) +
+                                ".val = ") == 0)
+      continue;
 
-  for (std::size_t i = 0; i < conditions.size(); ++i)
-    outputCode += GenerateBooleanInitializationToFalse(
-        "condition" + gd::String::From(i) + "IsTrue", context);
+    outputCode += GenerateBooleanInitializationToFalse(booleanName, context);
+  }
 
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     if (cId != 0)
@@ -906,13 +954,9 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
               "condition" + gd::String::From(cId - 1) + "IsTrue", context) +
           ".val ) {\n";
 
-    gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
-                              "condition" + gd::String::From(cId) + "IsTrue",
-                              context);
     if (!conditions[cId].GetType().empty()) {
       outputCode += "{\n";
-      outputCode += conditionCode;
+      outputCode += conditionsCodes[cId];
       outputCode += "}";
     }
   }
@@ -1122,7 +1166,7 @@ gd::String EventsCodeGenerator::GenerateBooleanFullName(
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
     const gd::String& section) {
-  if (GenerateCodeForRuntime()) return "";
+  if (GenerateCodeForRuntime() && !eventsProfiling) return "";
 
   return "if (runtimeScene.getProfiler()) { runtimeScene.getProfiler().begin(" +
          ConvertToStringExplicit(section) + "); }";
@@ -1130,21 +1174,68 @@ gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionEnd(
     const gd::String& section) {
-  if (GenerateCodeForRuntime()) return "";
+  if (GenerateCodeForRuntime() && !eventsProfiling) return "";
 
   return "if (runtimeScene.getProfiler()) { runtimeScene.getProfiler().end(" +
          ConvertToStringExplicit(section) + "); }";
 }
 
+gd::String EventsCodeGenerator::GenerateProfilerEventBegin(
+    const gd::BaseEvent& event) {
+  auto it = topLevelEventsIds.find(&event);
+  if (it == topLevelEventsIds.end()) return "";
+
+  return GenerateProfilerSectionBegin("event:" + gd::String::From(it->second));
+}
+
+gd::String EventsCodeGenerator::GenerateProfilerEventEnd(
+    const gd::BaseEvent& event) {
+  auto it = topLevelEventsIds.find(&event);
+  if (it == topLevelEventsIds.end()) return "";
+
+  return GenerateProfilerSectionEnd("event:" + gd::String::From(it->second));
+}
+
+void EventsCodeGenerator::AddEventsToProfilingTable(
+    gd::EventsList& events, const std::vector<std::size_t>& parentPath) {
+  eventsProfilingTable.ConsiderAsArrayOf("event");
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    std::size_t id = profiledEvents.size();
+    profiledEvents.push_back(events.GetEventSmartPtr(i));
+    if (parentPath.empty()) topLevelEventsIds[&events[i]] = id;
+
+    std::vector<std::size_t> path = parentPath;
+    path.push_back(i);
+
+    gd::SerializerElement& eventElement =
+        eventsProfilingTable.AddChild("event");
+    eventElement.SetIntAttribute("id", id);
+    eventElement.SetStringAttribute("type", events[i].GetType());
+    gd::SerializerElement& pathElement = eventElement.AddChild("path");
+    pathElement.ConsiderAsArrayOf("index");
+    for (std::size_t index : path)
+      pathElement.AddChild("index").SetIntValue(index);
+
+    if (events[i].CanHaveSubEvents()) {
+      subEventsIds[&events[i].GetSubEvents()] = id;
+      AddEventsToProfilingTable(events[i].GetSubEvents(), path);
+    }
+  }
+}
+
 EventsCodeGenerator::EventsCodeGenerator(gd::Project& project,
                                          const gd::Layout& layout)
-    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()) {}
+    : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()),
+      compactCode(false),
+      eventsProfiling(false) {}
 
 EventsCodeGenerator::EventsCodeGenerator(
     gd::ObjectsContainer& globalObjectsAndGroups,
     const gd::ObjectsContainer& objectsAndGroups)
     : gd::EventsCodeGenerator(
-          JsPlatform::Get(), globalObjectsAndGroups, objectsAndGroups) {}
+          JsPlatform::Get(), globalObjectsAndGroups, objectsAndGroups),
+      compactCode(false),
+      eventsProfiling(false) {}
 
 EventsCodeGenerator::~EventsCodeGenerator() {}
 
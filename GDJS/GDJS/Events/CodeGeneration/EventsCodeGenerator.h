@@ -5,13 +5,17 @@
  */
 #ifndef EVENTSCODEGENERATOR_H
 #define EVENTSCODEGENERATOR_H
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Serialization/SerializerElement.h"
 namespace gd {
 class ObjectsContainer;
 class EventsFunction;
@@ -41,14 +45,22 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param compactCode Set this to true to generate smaller code (see
+   * SetGenerateCompactCode).
+   * \param eventsProfilingTable If not null, the code notifies the profiler of
+   * the time spent in events and this is filled with the events that are
+   * profiled (see SetGenerateEventsProfilingCode).
    *
    * \return JavaScript code
    */
-  static gd::String GenerateLayoutCode(gd::Project& project,
-                                       const gd::Layout& scene,
-                                       const gd::String& codeNamespace,
-                                       std::set<gd::String>& includeFiles,
-                                       bool compilationForRuntime = false);
+  static gd::String GenerateLayoutCode(
+      gd::Project& project,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime = false,
+      bool compactCode = false,
+      gd::SerializerElement* eventsProfilingTable = nullptr);
 
   /**
    * Generate JavaScript for executing events of an events based function.
@@ -148,10 +160,11 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * objects/values/functions, with the extra "dot" at the end to be used to
    * access to a property/member.
    *
-   * Example: "gdjs.something."
+   * Example: "gdjs.something.", or "$ns." when generating compact code (the
+   * code is then wrapped in a function taking the namespace as "$ns").
    */
   virtual gd::String GetCodeNamespaceAccessor() {
-    return GetCodeNamespace() + ".";
+    return compactCode ? "$ns." : GetCodeNamespace() + ".";
   };
 
   /**
@@ -172,6 +185,56 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
     codeNamespace = codeNamespace_;
   };
 
+  /**
+   * \brief Return true if the generated code is made as small as possible.
+   */
+  bool GenerateCompactCode() const { return compactCode; };
+
+  /**
+   * \brief Set if the generated code must be made as small as possible, for
+   * exported games:
+   * - The namespace is accessed with a short local alias.
+   * - The booleans of conditions which are always set are not reset.
+   * - Only the lists of objects used by the events are declared and reset.
+   */
+  void SetGenerateCompactCode(bool compactCode_) {
+    compactCode = compactCode_;
+  };
+
+  /**
+   * \brief Return true if the generated code notifies the profiler of the time
+   * spent in each event.
+   */
+  bool GenerateEventsProfilingCode() const { return eventsProfiling; };
+
+  /**
+   * \brief Set if the generated code must notify the profiler of the time
+   * spent in events, even when generating code for runtime.
+   *
+   * Each event is given an identifier, which is its index when walking the
+   * events (and their sub events) in order. The profiler sections are named
+   * "event:ID" for the events of the top level of the list, and "subEvents:ID"
+   * for the function running the sub events of the event ID.
+   *
+   * \see GetEventsProfilingTable
+   */
+  void SetGenerateEventsProfilingCode(bool eventsProfiling_) {
+    eventsProfiling = eventsProfiling_;
+  };
+
+  /**
+   * \brief Return the table of the events that are profiled, filled when the
+   * code is generated.
+   *
+   * It's an array of the events with their identifier ("id"), their path in
+   * the events sheet ("path", the index of the event and of its parents) and
+   * their type, so that the time spent in the profiler sections can be shown on
+   * the events.
+   */
+  const gd::SerializerElement& GetEventsProfilingTable() const {
+    return eventsProfilingTable;
+  };
+
  protected:
   virtual gd::String GenerateParameterCodes(
       const gd::String& parameter,
@@ -283,6 +346,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   virtual gd::String GenerateProfilerSectionBegin(const gd::String& section);
   virtual gd::String GenerateProfilerSectionEnd(const gd::String& section);
+  virtual gd::String GenerateProfilerEventBegin(const gd::BaseEvent& event);
+  virtual gd::String GenerateProfilerEventEnd(const gd::BaseEvent& event);
 
  private:
   static gd::String GenerateEventsListCompleteFunctionCode(
@@ -312,6 +377,16 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   std::pair<gd::String, gd::String> GenerateAllObjectsDeclarationsAndResets(
       unsigned int maxDepthLevelReached);
 
+  /**
+   * \brief Give an identifier to the events to be profiled, and add them to
+   * the table of the profiled events.
+   *
+   * This must be called before preprocessing the events, so that the paths of
+   * the events are the ones of the events sheet.
+   */
+  void AddEventsToProfilingTable(gd::EventsList& events,
+                                 const std::vector<std::size_t>& parentPath);
+
   /**
    * \brief Generate the list of parameters of a function.
    *
@@ -360,6 +435,21 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
+  bool compactCode;  ///< Is the generated code made as small as possible?
+  std::set<std::pair<gd::String, unsigned int>>
+      usedObjectsLists;  ///< The name and depth of the lists of objects used by
+                         ///< the generated code.
+  bool eventsProfiling;  ///< Is the code to profile events generated?
+  gd::SerializerElement eventsProfilingTable;  ///< The profiled events.
+  std::map<const gd::BaseEvent*, std::size_t>
+      topLevelEventsIds;  ///< The identifier of the profiled top level events.
+  std::map<const gd::EventsList*, std::size_t>
+      subEventsIds;  ///< The identifier of the event owning each sub events
+                     ///< list.
+  std::vector<std::shared_ptr<gd::BaseEvent>>
+      profiledEvents;  ///< Keep the profiled events alive, so that the address
+                       ///< of an event removed by preprocessing is not reused.
+
 private:
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
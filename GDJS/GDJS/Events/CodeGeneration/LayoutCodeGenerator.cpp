@@ -11,13 +11,21 @@ namespace gdjs {
 gd::String LayoutCodeGenerator::GenerateLayoutCompleteCode(
     const gd::Layout& layout,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    bool compactCode,
+    gd::SerializerElement* eventsProfilingTable) {
   gd::String sceneMangledName =
       gd::SceneNameMangler::Get()->GetMangledSceneName(layout.GetName());
   gd::String codeNamespace = "gdjs." + sceneMangledName + "Code";
 
-  gd::String layoutCode = EventsCodeGenerator::GenerateLayoutCode(
-      project, layout, codeNamespace, includeFiles, compilationForRuntime);
+  gd::String layoutCode =
+      EventsCodeGenerator::GenerateLayoutCode(project,
+                                              layout,
+                                              codeNamespace,
+                                              includeFiles,
+                                              compilationForRuntime,
+                                              compactCode,
+                                              eventsProfilingTable);
 
   // Export the symbols to avoid them being stripped by the Closure Compiler:
   gd::String exportCode =
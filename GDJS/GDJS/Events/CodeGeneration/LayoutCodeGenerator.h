@@ -10,6 +10,9 @@
 #include <string>
 #include <vector>
 #include "GDCore/Project/Layout.h"
+namespace gd {
+class SerializerElement;
+}
 
 namespace gdjs {
 
@@ -27,11 +30,17 @@ class LayoutCodeGenerator {
 
   /**
    * \brief Generate the complete code for the events of the specified scene.
+   *
+   * \see gdjs::EventsCodeGenerator::SetGenerateCompactCode for \a compactCode.
+   * \see gdjs::EventsCodeGenerator::GenerateLayoutCode for \a
+   * eventsProfilingTable.
    */
   gd::String GenerateLayoutCompleteCode(
       const gd::Layout& layout,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime);
+      bool compilationForRuntime,
+      bool compactCode = false,
+      gd::SerializerElement* eventsProfilingTable = nullptr);
 
  private:
   gd::Project& project;
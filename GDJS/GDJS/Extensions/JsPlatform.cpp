@@ -4,7 +4,11 @@
  * reserved. This project is released under the MIT License.
  */
 #include "GDJS/Extensions/JsPlatform.h"
+#include <algorithm>
+#include <map>
 #include "GDCore/CommonTools.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/ExtensionsLoader.h"
@@ -63,114 +67,190 @@ void JsPlatform::ReloadBuiltinExtensions() {
   // Adding built-in extensions.
   std::cout << "* Loading builtin extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
+  AddBuiltinExtension<BaseObjectExtension>("BuiltinObject", "");
+  AddBuiltinExtension<SpriteExtension>("Sprite", "");
+  AddBuiltinExtension<CommonInstructionsExtension>(
+      "BuiltinCommonInstructions", "BuiltinCommonInstructions::");
+  AddBuiltinExtension<CommonConversionsExtension>("BuiltinCommonConversions",
+                                                  "");
+  AddBuiltinExtension<VariablesExtension>("BuiltinVariables", "");
+  AddBuiltinExtension<MouseExtension>("BuiltinMouse", "");
+  AddBuiltinExtension<KeyboardExtension>("BuiltinKeyboard", "");
+  AddBuiltinExtension<SceneExtension>("BuiltinScene", "");
+  AddBuiltinExtension<TimeExtension>("BuiltinTime", "");
+  AddBuiltinExtension<MathematicalToolsExtension>("BuiltinMathematicalTools",
+                                                  "");
+  AddBuiltinExtension<CameraExtension>("BuiltinCamera", "");
+  AddBuiltinExtension<AudioExtension>("BuiltinAudio", "");
+  AddBuiltinExtension<FileExtension>("BuiltinFile", "");
+  AddBuiltinExtension<NetworkExtension>("BuiltinNetwork", "");
+  AddBuiltinExtension<WindowExtension>("BuiltinWindow", "");
+  AddBuiltinExtension<StringInstructionsExtension>("BuiltinStringInstructions",
+                                                   "");
+  AddBuiltinExtension<AdvancedExtension>("BuiltinAdvanced", "");
+  AddBuiltinExtension<ExternalLayoutsExtension>("BuiltinExternalLayouts",
+                                                "BuiltinExternalLayouts::");
   std::cout << "done." << std::endl;
 
 #if defined(EMSCRIPTEN)  // When compiling with emscripten, hardcode extensions
                          // to load.
   std::cout << "* Loading other extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  AddBuiltinExtension("PlatformBehavior",
+                      "PlatformBehavior::",
+                      CreateGDJSPlatformBehaviorExtension);
+  AddBuiltinExtension("DestroyOutsideBehavior",
+                      "DestroyOutsideBehavior::",
+                      CreateGDJSDestroyOutsideBehaviorExtension);
+  AddBuiltinExtension("TiledSpriteObject",
+                      "TiledSpriteObject::",
+                      CreateGDJSTiledSpriteObjectExtension);
+  AddBuiltinExtension("DraggableBehavior",
+                      "DraggableBehavior::",
+                      CreateGDJSDraggableBehaviorExtension);
+  AddBuiltinExtension("TopDownMovementBehavior",
+                      "TopDownMovementBehavior::",
+                      CreateGDJSTopDownMovementBehaviorExtension);
+  AddBuiltinExtension(
+      "TextObject", "TextObject::", CreateGDJSTextObjectExtension);
+  AddBuiltinExtension("ParticleSystem",
+                      "ParticleSystem::",
+                      CreateGDJSParticleSystemExtension);
+  AddBuiltinExtension("PanelSpriteObject",
+                      "PanelSpriteObject::",
+                      CreateGDJSPanelSpriteObjectExtension);
+  AddBuiltinExtension(
+      "AnchorBehavior", "AnchorBehavior::", CreateGDJSAnchorBehaviorExtension);
+  AddBuiltinExtension("PrimitiveDrawing",
+                      "PrimitiveDrawing::",
+                      CreateGDJSPrimitiveDrawingExtension);
+  AddBuiltinExtension("TextEntryObject",
+                      "TextEntryObject::",
+                      CreateGDJSTextEntryObjectExtension);
+  AddBuiltinExtension("Inventory", "Inventory::", CreateGDJSInventoryExtension);
+  AddBuiltinExtension(
+      "LinkedObjects", "LinkedObjects::", CreateGDJSLinkedObjectsExtension);
+  AddBuiltinExtension(
+      "SystemInfo", "SystemInfo::", CreateGDJSSystemInfoExtension);
+  AddBuiltinExtension("Shopify", "Shopify::", CreateGDJSShopifyExtension);
+  AddBuiltinExtension("PathfindingBehavior",
+                      "PathfindingBehavior::",
+                      CreateGDJSPathfindingBehaviorExtension);
+  AddBuiltinExtension("PhysicsBehavior",
+                      "PhysicsBehavior::",
+                      CreateGDJSPhysicsBehaviorExtension);
 #endif
   std::cout << "done." << std::endl;
 };
 
+void JsPlatform::AddBuiltinExtension(
+    const gd::String &name,
+    const gd::String &typesPrefix,
+    std::function<gd::PlatformExtension *()> createExtension) {
+  auto declareExtension = [createExtension]() {
+    std::shared_ptr<gd::PlatformExtension> extension(createExtension());
+    AddEventsToolsIncludeFiles(*extension);
+    return extension;
+  };
+
+  if (lazyExtensionsDeclaration)
+    AddLazyExtension(name, typesPrefix, declareExtension);
+  else
+    AddExtension(declareExtension());
+}
+
+const std::vector<gd::String> &JsPlatform::GetEventsToolsIncludeFiles() {
+  static const std::vector<gd::String> eventsToolsIncludeFiles = {
+      "events-tools/commontools.js",
+      "events-tools/variabletools.js",
+      "events-tools/runtimescenetools.js",
+      "events-tools/inputtools.js",
+      "events-tools/objecttools.js",
+      "events-tools/cameratools.js",
+      "events-tools/soundtools.js",
+      "events-tools/storagetools.js",
+      "events-tools/stringtools.js",
+      "events-tools/windowtools.js",
+      "events-tools/networktools.js"};
+
+  return eventsToolsIncludeFiles;
+}
+
+gd::String JsPlatform::GetEventsToolsIncludeFile(
+    const gd::String &functionName) {
+  // Functions are named gdjs.evtTools.<namespace>.<function> and the
+  // namespace is defined in events-tools/<lowercased namespace>tools.js.
+  static const gd::String prefix = "gdjs.evtTools.";
+  if (functionName.find(prefix) != 0) return "";
+
+  std::size_t namespaceEnd = functionName.find(".", prefix.size());
+  if (namespaceEnd == gd::String::npos) return "";
+
+  gd::String includeFile =
+      "events-tools/" +
+      functionName.substr(prefix.size(), namespaceEnd - prefix.size())
+          .LowerCase() +
+      "tools.js";
+  const auto &eventsToolsIncludeFiles = GetEventsToolsIncludeFiles();
+  return std::find(eventsToolsIncludeFiles.begin(),
+                   eventsToolsIncludeFiles.end(),
+                   includeFile) != eventsToolsIncludeFiles.end()
+             ? includeFile
+             : "";
+}
+
+void JsPlatform::AddEventsToolsIncludeFiles(gd::PlatformExtension &extension) {
+  auto addToInstructions =
+      [](std::map<gd::String, gd::InstructionMetadata> &instructions) {
+        for (auto &it : instructions) {
+          auto &codeExtraInformation = it.second.codeExtraInformation;
+          for (const gd::String &functionName :
+               {codeExtraInformation.functionCallName,
+                codeExtraInformation.optionalAssociatedInstruction}) {
+            gd::String includeFile = GetEventsToolsIncludeFile(functionName);
+            if (!includeFile.empty())
+              codeExtraInformation.AddIncludeFile(includeFile);
+          }
+        }
+      };
+  auto addToExpressions =
+      [](std::map<gd::String, gd::ExpressionMetadata> &expressions) {
+        for (auto &it : expressions) {
+          auto &codeExtraInformation = it.second.codeExtraInformation;
+          gd::String includeFile =
+              GetEventsToolsIncludeFile(codeExtraInformation.functionCallName);
+          if (!includeFile.empty())
+            codeExtraInformation.AddIncludeFile(includeFile);
+        }
+      };
+
+  addToInstructions(extension.GetAllActions());
+  addToInstructions(extension.GetAllConditions());
+  addToExpressions(extension.GetAllExpressions());
+  addToExpressions(extension.GetAllStrExpressions());
+  for (const gd::String &objectType : extension.GetExtensionObjectsTypes()) {
+    addToInstructions(extension.GetAllActionsForObject(objectType));
+    addToInstructions(extension.GetAllConditionsForObject(objectType));
+    addToExpressions(extension.GetAllExpressionsForObject(objectType));
+    addToExpressions(extension.GetAllStrExpressionsForObject(objectType));
+  }
+  for (const gd::String &behaviorType : extension.GetBehaviorsTypes()) {
+    addToInstructions(extension.GetAllActionsForBehavior(behaviorType));
+    addToInstructions(extension.GetAllConditionsForBehavior(behaviorType));
+    addToExpressions(extension.GetAllExpressionsForBehavior(behaviorType));
+    addToExpressions(extension.GetAllStrExpressionsForBehavior(behaviorType));
+  }
+}
+
 void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
   AddExtension(std::shared_ptr<gd::PlatformExtension>(
       new gd::PlatformExtension(extension)));
 }
 
-JsPlatform::JsPlatform() : gd::Platform() { ReloadBuiltinExtensions(); }
+JsPlatform::JsPlatform(bool lazyExtensionsDeclaration_)
+    : gd::Platform(), lazyExtensionsDeclaration(lazyExtensionsDeclaration_) {
+  ReloadBuiltinExtensions();
+}
 
 JsPlatform &JsPlatform::Get() {
   if (!singleton) singleton = new JsPlatform;
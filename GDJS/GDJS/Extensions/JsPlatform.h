@@ -5,6 +5,8 @@
  */
 #ifndef JSPLATFORM_H
 #define JSPLATFORM_H
+#include <functional>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
@@ -46,6 +48,20 @@ class GD_API JsPlatform : public gd::Platform {
 
   void AddNewExtension(const gd::PlatformExtension& extension);
 
+  /**
+   * \brief Return the files of the runtime defining the functions used by
+   * events (gdjs.evtTools.*), in the order they must be included.
+   */
+  static const std::vector<gd::String>& GetEventsToolsIncludeFiles();
+
+  /**
+   * \brief Return the file of the runtime defining the events tools function
+   * called \a functionName (for example "events-tools/soundtools.js" for
+   * "gdjs.evtTools.sound.playSound"), or an empty string if the function is
+   * not an events tools function.
+   */
+  static gd::String GetEventsToolsIncludeFile(const gd::String& functionName);
+
   /**
    * \brief (Re)load platform built-in extensions.
    * \note Can be useful if, for example, the user changed the language
@@ -65,10 +81,42 @@ class GD_API JsPlatform : public gd::Platform {
    **/
   static void DestroySingleton();
 
-  JsPlatform();
+  /**
+   * \brief Create the platform and its built-in extensions.
+   *
+   * \param lazyExtensionsDeclaration If true, built-in extensions are only
+   * registered with their name and namespace, and are declared the first time
+   * something is asked to them (see gd::Platform::AddLazyExtension). Useful
+   * for tools that are only using a few extensions and must start quickly.
+   */
+  JsPlatform(bool lazyExtensionsDeclaration = false);
   virtual ~JsPlatform(){};
 
  private:
+  /**
+   * \brief Add a built-in extension, declared now or lazily according to
+   * lazyExtensionsDeclaration.
+   */
+  void AddBuiltinExtension(
+      const gd::String& name,
+      const gd::String& typesPrefix,
+      std::function<gd::PlatformExtension*()> createExtension);
+
+  template <class T>
+  void AddBuiltinExtension(const gd::String& name,
+                           const gd::String& typesPrefix) {
+    AddBuiltinExtension(
+        name, typesPrefix, []() -> gd::PlatformExtension* { return new T; });
+  }
+
+  /**
+   * \brief Add to the instructions and expressions of the extension the
+   * events tools file defining the function they call, so that it's only
+   * included in the game when they are used.
+   */
+  static void AddEventsToolsIncludeFiles(gd::PlatformExtension& extension);
+
+  bool lazyExtensionsDeclaration;
 
   static JsPlatform* singleton;
 };
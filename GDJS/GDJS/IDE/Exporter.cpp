@@ -42,7 +42,9 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  return helper.ExportProjectForPixiPreview(options);
+  bool exported = helper.ExportProjectForPixiPreview(options);
+  lastPhasesDurations = helper.GetPhasesDurations();
+  return exported;
 }
 
 bool Exporter::ExportWholePixiProject(
@@ -50,7 +52,8 @@ bool Exporter::ExportWholePixiProject(
     gd::String exportDir,
     std::map<gd::String, bool> &exportOptions) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  gd::Project exportedProject = project;
+  gd::Project exportedProject;
+  exportedProject.CopyOnWriteFrom(project);
 
   auto usedExtensions = gd::UsedExtensionsFinder::ScanProject(project);
 
@@ -64,9 +67,11 @@ bool Exporter::ExportWholePixiProject(
     if (exportForFacebookInstantGames)
       exportedProject.GetLoadingScreen().ShowGDevelopSplash(false);
 
+    double previousTime = helper.GetTimeNow();
+
     // Prepare the export directory
     fs.MkDir(exportDir);
-    std::vector<gd::String> includesFiles;
+    gd::InsertionOrderedSet<gd::String> includesFiles;
 
     // Export the resources (before generating events as some resources
     // filenames may be updated)
@@ -79,11 +84,14 @@ bool Exporter::ExportWholePixiProject(
         fs, exportedProject.GetResourcesManager(), exportDir);
     // end of compatibility code
 
+    previousTime = helper.LogTimeSpent("Resource export", previousTime);
+
     // Export engine libraries
     helper.AddLibsInclude(
         /*pixiRenderers=*/true,
         /*includeWebsocketDebuggerClient=*/false,
         /*includeWindowMessageDebuggerClient=*/false,
+        /*onlyUsedEventsTools=*/exportOptions["onlyUsedEventsTools"],
         exportedProject.GetLoadingScreen().GetGDevelopLogoStyle(),
         includesFiles);
 
@@ -94,9 +102,17 @@ bool Exporter::ExportWholePixiProject(
     // to the engine)
     helper.ExportEffectIncludes(exportedProject, includesFiles);
 
+    previousTime = helper.LogTimeSpent("Include files export", previousTime);
+
     // Export events
-    if (!helper.ExportEventsCode(
-            exportedProject, codeOutputDir, includesFiles, false)) {
+    if (!helper.ExportEventsCode(exportedProject,
+                                 codeOutputDir,
+                                 includesFiles,
+                                 false,
+                                 exportOptions["compactEventsCode"],
+                                 exportOptions["eventsProfiling"]
+                                     ? exportDir + "/events-profiling.json"
+                                     : "")) {
       gd::LogError(_("Error during exporting! Unable to export events:\n") +
                    lastError);
       return false;
@@ -111,17 +127,50 @@ bool Exporter::ExportWholePixiProject(
       return false;
     }
 
+    previousTime = helper.LogTimeSpent("Events code export", previousTime);
+
     // Strip the project (*after* generating events as the events may use
     // stripped things like objects groups...)...
     gd::ProjectStripper::StripProjectForExport(exportedProject);
 
-    //...and export it
-    gd::SerializerElement noRuntimeGameOptions;
-    helper.ExportProjectData(
-        fs, exportedProject, codeOutputDir + "/data.js", noRuntimeGameOptions);
-    includesFiles.push_back(codeOutputDir + "/data.js");
+    previousTime = helper.LogTimeSpent("Data stripping", previousTime);
 
-    helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
+    // Optionally, let the game load the events code of each layout when it's
+    // first used.
+    gd::SerializerElement runtimeGameOptions;
+    gd::InsertionOrderedSet<gd::String> codeChunksFiles;
+    if (exportOptions["lazilyLoadedLayoutsCode"])
+      codeChunksFiles = helper.ExtractLayoutsCodeChunks(
+          exportedProject, includesFiles, runtimeGameOptions);
+
+    //...and export it
+    if (exportOptions["splitProjectData"])
+      helper.ExportSplitProjectData(fs,
+                                    exportedProject,
+                                    codeOutputDir + "/data.js",
+                                    exportDir,
+                                    runtimeGameOptions);
+    else
+      helper.ExportProjectData(fs,
+                               exportedProject,
+                               codeOutputDir + "/data.js",
+                               runtimeGameOptions);
+    includesFiles.insert(codeOutputDir + "/data.js");
+
+    previousTime = helper.LogTimeSpent("Project data export", previousTime);
+
+    helper.ExportIncludesAndLibs(codeChunksFiles, exportDir, false);
+    if (exportOptions["bundleIncludes"]) {
+      if (!helper.ExportIncludesBundle(includesFiles, exportDir, "bundle.js")) {
+        gd::LogError(_("Error during export:\n") + helper.GetLastError());
+        return false;
+      }
+
+      includesFiles.clear();
+      includesFiles.insert("bundle.js");
+    } else {
+      helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
+    }
 
     gd::String source = gdjsRoot + "/Runtime/index.html";
     if (exportForCordova)
@@ -129,44 +178,47 @@ bool Exporter::ExportWholePixiProject(
     else if (exportForFacebookInstantGames)
       source = gdjsRoot + "/Runtime/FacebookInstantGames/index.html";
 
+    // The options are declared with the project data.
     if (!helper.ExportPixiIndexFile(exportedProject,
                                     source,
                                     exportDir,
                                     includesFiles,
                                     /*nonRuntimeScriptsCacheBurst=*/0,
-                                    "")) {
+                                    runtimeGameOptions.GetAllChildren().empty()
+                                        ? ""
+                                        : "gdjs.runtimeGameOptions")) {
       gd::LogError(_("Error during export:\n") + lastError);
       return false;
     }
 
+    previousTime = helper.LogTimeSpent("Include and libs export", previousTime);
     return true;
   };
 
+  bool exported = false;
   if (exportOptions["exportForCordova"]) {
     fs.MkDir(exportDir);
     fs.MkDir(exportDir + "/www");
 
-    if (!exportProject(exportDir + "/www")) return false;
-
-    if (!helper.ExportCordovaFiles(exportedProject, exportDir, usedExtensions))
-      return false;
+    exported = exportProject(exportDir + "/www") &&
+               helper.ExportCordovaFiles(
+                   exportedProject, exportDir, usedExtensions);
   } else if (exportOptions["exportForElectron"]) {
     fs.MkDir(exportDir);
 
-    if (!exportProject(exportDir + "/app")) return false;
-
-    if (!helper.ExportElectronFiles(exportedProject, exportDir, usedExtensions))
-      return false;
+    exported = exportProject(exportDir + "/app") &&
+               helper.ExportElectronFiles(
+                   exportedProject, exportDir, usedExtensions);
   } else if (exportOptions["exportForFacebookInstantGames"]) {
-    if (!exportProject(exportDir)) return false;
-
-    if (!helper.ExportFacebookInstantGamesFiles(exportedProject, exportDir))
-      return false;
+    exported = exportProject(exportDir) &&
+               helper.ExportFacebookInstantGamesFiles(exportedProject,
+                                                      exportDir);
   } else {
-    if (!exportProject(exportDir)) return false;
+    exported = exportProject(exportDir);
   }
 
-  return true;
+  lastPhasesDurations = helper.GetPhasesDurations();
+  return exported;
 }
 
 }  // namespace gdjs
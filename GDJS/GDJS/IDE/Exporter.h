@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -44,6 +45,24 @@ class Exporter {
    * \brief Export the specified project, using Pixi.js.
    *
    * Called by ShowProjectExportDialog if the user clicked on Ok.
+   *
+   * \param exportOptions "exportForCordova", "exportForElectron" and
+   * "exportForFacebookInstantGames" choose the target of the export.
+   * "splitProjectData" stores the data of each layout in its own file, loaded
+   * lazily by the game (see ExporterHelper::ExportSplitProjectData).
+   * "onlyUsedEventsTools" only includes the events tools of the runtime that
+   * are used by the events of the game.
+   * "bundleIncludes" concatenates the scripts of the game in a single file
+   * (see ExporterHelper::ExportIncludesBundle), and "lazilyLoadedLayoutsCode"
+   * keeps the events code of each layout in its own file, evaluated when the
+   * layout is first used (see ExporterHelper::ExtractLayoutsCodeChunks). These
+   * files are still all fetched while the game is loading, so this only saves
+   * the time to evaluate the code of the layouts not used yet.
+   * "compactEventsCode" generates smaller events code (see
+   * gdjs::EventsCodeGenerator::SetGenerateCompactCode). "eventsProfiling"
+   * generates the code measuring the time spent in events, and writes the
+   * table of the profiled events in "events-profiling.json" (see
+   * ExporterHelper::ExportEventsCode).
    */
   bool ExportWholePixiProject(gd::Project& project,
                               gd::String exportDir,
@@ -54,6 +73,15 @@ class Exporter {
    */
   const gd::String& GetLastError() const { return lastError; };
 
+  /**
+   * \brief Return the name and the duration (in milliseconds) of the phases
+   * of the last export.
+   */
+  const std::vector<std::pair<gd::String, double>>& GetLastPhasesDurations()
+      const {
+    return lastPhasesDurations;
+  };
+
   /**
    * \brief Change the directory where code files are generated.
    *
@@ -67,6 +95,8 @@ class Exporter {
   gd::AbstractFileSystem&
       fs;  ///< The abstract file system to be used for exportation.
   gd::String lastError;  ///< The last error that occurred.
+  std::vector<std::pair<gd::String, double>>
+      lastPhasesDurations;  ///< The durations of the phases of the last export.
   gd::String
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
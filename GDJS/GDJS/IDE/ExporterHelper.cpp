@@ -9,6 +9,8 @@
 #include <emscripten.h>
 #endif
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <sstream>
@@ -24,6 +26,7 @@
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/ExportedDependencyResolver.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/ProjectFileReader.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/ExternalEvents.h"
@@ -36,48 +39,138 @@
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/ParallelFor.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
 
 namespace {
-double GetTimeNow() {
+const gd::String exportManifestFilename = "gdjs-export-manifest.json";
+
+/**
+ * \brief Hash a file content to be stored in the export manifest.
+ *
+ * The manifest is kept between runs (and versions) of the IDE so the hash
+ * must be stable: FNV-1a is used rather than std::hash.
+ */
+gd::String HashFileContent(const gd::String &content) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : content.Raw()) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return gd::String::From(hash) + "-" +
+         gd::String::From(content.Raw().size());
+}
+
+gd::String GenerateProjectDataScript(
+    const gd::SerializerElement &rootElement,
+    const gd::SerializerElement &runtimeGameOptions) {
+  return "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
+         "gdjs.runtimeGameOptions = " +
+         gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+}
+
+}  // namespace
+
+namespace gdjs {
+
+double ExporterHelper::GetTimeNow() {
 #if defined(EMSCRIPTEN)
   double currentTime = emscripten_get_now();
   return currentTime;
 #else
-  return 0;
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
 #endif
 }
-double GetTimeSpent(double previousTime) { return GetTimeNow() - previousTime; }
-double LogTimeSpent(const gd::String &name, double previousTime) {
-  gd::LogStatus(name + " took " + gd::String::From(GetTimeSpent(previousTime)) +
-                "ms");
+
+double ExporterHelper::LogTimeSpent(const gd::String &name,
+                                    double previousTime) {
+  double timeSpent = GetTimeNow() - previousTime;
+  phasesDurations.push_back(std::make_pair(name, timeSpent));
+  gd::LogStatus(name + " took " + gd::String::From(timeSpent) + "ms");
   std::cout << std::endl;
   return GetTimeNow();
 }
-}  // namespace
 
-namespace gdjs {
+/**
+ * \brief Add to \a includeFiles the events tools files defining the
+ * gdjs.evtTools functions called by the code.
+ */
+static void AddEventsToolsCalledByCode(const gd::String &code,
+                                       std::set<gd::String> &includeFiles) {
+  const std::string &rawCode = code.Raw();
+  static const std::string prefix = "gdjs.evtTools.";
+  for (std::size_t position = rawCode.find(prefix);
+       position != std::string::npos;
+       position = rawCode.find(prefix, position + prefix.size())) {
+    std::size_t end = rawCode.find_first_not_of(
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_$.",
+        position);
+    gd::String includeFile = JsPlatform::GetEventsToolsIncludeFile(
+        gd::String::FromUTF8(rawCode.substr(position, end - position)));
+    if (!includeFile.empty()) includeFiles.insert(includeFile);
+  }
+}
+
+/**
+ * \brief Add to \a includeFiles the events tools files called by the code of
+ * the include files that are not part of the runtime (like the code generated
+ * for events functions extensions), or all of them if this code can't be
+ * read. The files already in \a scannedIncludes are skipped.
+ */
+static void AddEventsToolsCalledByIncludes(
+    gd::AbstractFileSystem &fs,
+    std::set<gd::String> &scannedIncludes,
+    std::set<gd::String> &includeFiles) {
+  std::vector<gd::String> generatedIncludes;
+  for (const gd::String &includeFile : includeFiles) {
+    if (fs.IsAbsolute(includeFile) &&
+        scannedIncludes.insert(includeFile).second)
+      generatedIncludes.push_back(includeFile);
+  }
 
-static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
-  if (std::find(container.begin(), container.end(), str) == container.end())
-    container.push_back(str);
+  for (const gd::String &includeFile : generatedIncludes) {
+    if (fs.FileExists(includeFile)) {
+      AddEventsToolsCalledByCode(fs.ReadFile(includeFile), includeFiles);
+    } else {
+      for (const gd::String &eventsToolsFile :
+           JsPlatform::GetEventsToolsIncludeFiles())
+        includeFiles.insert(eventsToolsFile);
+    }
+  }
 }
 
 ExporterHelper::ExporterHelper(gd::AbstractFileSystem &fileSystem,
                                gd::String gdjsRoot_,
                                gd::String codeOutputDir_)
-    : fs(fileSystem), gdjsRoot(gdjsRoot_), codeOutputDir(codeOutputDir_){};
+    : fs(fileSystem),
+      gdjsRoot(gdjsRoot_),
+      codeOutputDir(codeOutputDir_),
+      incrementalExport(false){};
 
 bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   double previousTime = GetTimeNow();
   fs.MkDir(options.exportPath);
-  fs.ClearDir(options.exportPath);
-  std::vector<gd::String> includesFiles;
+  incrementalExport = options.incrementalExport;
+  if (incrementalExport) {
+    LoadExportManifest(options.exportPath);
+    // Until the export succeeds, the exported files may not match the
+    // manifest anymore.
+    fs.WriteToFile(options.exportPath + "/" + exportManifestFilename, "");
+  } else {
+    fs.ClearDir(options.exportPath);
+    exportedFilesHashes.clear();
+  }
+  gd::InsertionOrderedSet<gd::String> includesFiles;
 
-  gd::Project exportedProject = options.project;
+  // Layouts contents are shared with the original project as only a few parts
+  // of the project are modified by the export.
+  gd::Project exportedProject;
+  exportedProject.CopyOnWriteFrom(options.project);
 
   if (!options.fullLoadingScreen) {
     // Most of the time, we skip the logo and minimum duration so that
@@ -105,6 +198,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                  !options.websocketDebuggerServerAddress.empty(),
                  /*includeWindowMessageDebuggerClient=*/
                  options.useWindowMessageDebuggerClient,
+                 /*onlyUsedEventsTools=*/false,
                  exportedProject.GetLoadingScreen().GetGDevelopLogoStyle(),
                  includesFiles);
 
@@ -170,9 +264,10 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   }
 
   // Export the project
-  ExportProjectData(
-      fs, exportedProject, codeOutputDir + "/data.js", runtimeGameOptions);
-  includesFiles.push_back(codeOutputDir + "/data.js");
+  fs.MkDir(codeOutputDir);
+  WriteFileIfChanged(codeOutputDir + "/data.js",
+                     GenerateProjectData(exportedProject, runtimeGameOptions));
+  includesFiles.insert(codeOutputDir + "/data.js");
 
   previousTime = LogTimeSpent("Project data export", previousTime);
 
@@ -189,6 +284,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     return false;
 
   previousTime = LogTimeSpent("Include and libs export", previousTime);
+  SaveExportManifest(options.exportPath);
   return true;
 }
 
@@ -199,15 +295,73 @@ gd::String ExporterHelper::ExportProjectData(
     const gd::SerializerElement &runtimeGameOptions) {
   fs.MkDir(fs.DirNameFrom(filename));
 
+  gd::String output = GenerateProjectData(project, runtimeGameOptions);
+  if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
+
+  return "";
+}
+
+gd::String ExporterHelper::GenerateProjectData(
+    const gd::Project &project,
+    const gd::SerializerElement &runtimeGameOptions) {
   // Save the project to JSON
   gd::SerializerElement rootElement;
   project.SerializeTo(rootElement);
-  gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  return GenerateProjectDataScript(rootElement, runtimeGameOptions);
+}
 
-  if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
+gd::String ExporterHelper::ExportSplitProjectData(
+    gd::AbstractFileSystem &fs,
+    const gd::Project &project,
+    gd::String filename,
+    gd::String exportDir,
+    const gd::SerializerElement &runtimeGameOptions) {
+  fs.MkDir(fs.DirNameFrom(filename));
+  fs.MkDir(exportDir + "/data");
+
+  gd::SerializerElement rootElement;
+  project.SerializeTo(rootElement);
+
+  // Find the layouts and external layouts to be stored in their own file.
+  std::vector<gd::SerializerElement *> chunkElements;
+  std::vector<gd::String> chunkFiles;
+  auto addChunks = [&](const gd::String &arrayName,
+                       const gd::String &childName,
+                       const gd::String &filePrefix) {
+    gd::SerializerElement &arrayElement = rootElement.GetChild(arrayName);
+    arrayElement.ConsiderAsArrayOf(childName);
+    for (std::size_t i = 0; i < arrayElement.GetChildrenCount(); ++i) {
+      chunkElements.push_back(&arrayElement.GetChild(i));
+      chunkFiles.push_back("data/" + filePrefix + gd::String::From(i) +
+                           ".json");
+    }
+  };
+  addChunks("layouts", "layout", "layout");
+  addChunks("externalLayouts", "externalLayout", "external-layout");
+
+  // Chunks are independent from each other, so they can be converted to JSON
+  // concurrently.
+  std::vector<gd::String> chunks(chunkElements.size());
+  gd::ParallelFor::Run(chunkElements.size(), [&](std::size_t i) {
+    chunks[i] = gd::Serializer::ToJSON(*chunkElements[i]);
+  });
+
+  for (std::size_t i = 0; i < chunkElements.size(); ++i) {
+    gd::String chunkFilename = exportDir + "/" + chunkFiles[i];
+    if (!fs.WriteToFile(chunkFilename, chunks[i]))
+      return "Unable to write " + chunkFilename;
+
+    gd::SerializerElement &chunkElement = *chunkElements[i];
+    gd::String name = chunkElement.GetStringAttribute("name");
+    chunkElement = gd::SerializerElement();
+    chunkElement.SetAttribute("name", name);
+    chunkElement.SetAttribute("dataChunk", chunkFiles[i]);
+  }
+
+  if (!fs.WriteToFile(filename,
+                      GenerateProjectDataScript(rootElement,
+                                                runtimeGameOptions)))
+    return "Unable to write " + filename;
 
   return "";
 }
@@ -216,7 +370,7 @@ bool ExporterHelper::ExportPixiIndexFile(
     const gd::Project &project,
     gd::String source,
     gd::String exportDir,
-    const std::vector<gd::String> &includesFiles,
+    const gd::InsertionOrderedSet<gd::String> &includesFiles,
     unsigned int nonRuntimeScriptsCacheBurst,
     gd::String additionalSpec) {
   gd::String str = fs.ReadFile(source);
@@ -230,7 +384,7 @@ bool ExporterHelper::ExportPixiIndexFile(
     return false;
 
   // Write the index.html file
-  if (!fs.WriteToFile(exportDir + "/index.html", str)) {
+  if (!WriteFileIfChanged(exportDir + "/index.html", str)) {
     lastError = "Unable to write index file.";
     return false;
   }
@@ -491,7 +645,7 @@ bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
 bool ExporterHelper::CompleteIndexFile(
     gd::String &str,
     gd::String exportDir,
-    const std::vector<gd::String> &includesFiles,
+    const gd::InsertionOrderedSet<gd::String> &includesFiles,
     unsigned int nonRuntimeScriptsCacheBurst,
     gd::String additionalSpec) {
   if (additionalSpec.empty()) additionalSpec = "{}";
@@ -523,152 +677,175 @@ bool ExporterHelper::CompleteIndexFile(
   return true;
 }
 
-void ExporterHelper::AddLibsInclude(bool pixiRenderers,
-                                    bool includeWebsocketDebuggerClient,
-                                    bool includeWindowMessageDebuggerClient,
-                                    gd::String gdevelopLogoStyle,
-                                    std::vector<gd::String> &includesFiles) {
+void ExporterHelper::AddLibsInclude(
+    bool pixiRenderers,
+    bool includeWebsocketDebuggerClient,
+    bool includeWindowMessageDebuggerClient,
+    bool onlyUsedEventsTools,
+    gd::String gdevelopLogoStyle,
+    gd::InsertionOrderedSet<gd::String> &includesFiles) {
   // First, do not forget common includes (they must be included before events
   // generated code files).
-  InsertUnique(includesFiles, "libs/jshashtable.js");
-  InsertUnique(includesFiles, "logger.js");
-  InsertUnique(includesFiles, "gd.js");
-  InsertUnique(includesFiles, "libs/rbush.js");
-  InsertUnique(includesFiles, "inputmanager.js");
-  InsertUnique(includesFiles, "jsonmanager.js");
-  InsertUnique(includesFiles, "timemanager.js");
-  InsertUnique(includesFiles, "runtimeobject.js");
-  InsertUnique(includesFiles, "profiler.js");
-  InsertUnique(includesFiles, "runtimescene.js");
-  InsertUnique(includesFiles, "scenestack.js");
-  InsertUnique(includesFiles, "polygon.js");
-  InsertUnique(includesFiles, "force.js");
-  InsertUnique(includesFiles, "layer.js");
-  InsertUnique(includesFiles, "timer.js");
-  InsertUnique(includesFiles, "runtimegame.js");
-  InsertUnique(includesFiles, "variable.js");
-  InsertUnique(includesFiles, "variablescontainer.js");
-  InsertUnique(includesFiles, "oncetriggers.js");
-  InsertUnique(includesFiles, "runtimebehavior.js");
-  InsertUnique(includesFiles, "spriteruntimeobject.js");
-
-  // Common includes for events only.
-  InsertUnique(includesFiles, "events-tools/commontools.js");
-  InsertUnique(includesFiles, "events-tools/variabletools.js");
-  InsertUnique(includesFiles, "events-tools/runtimescenetools.js");
-  InsertUnique(includesFiles, "events-tools/inputtools.js");
-  InsertUnique(includesFiles, "events-tools/objecttools.js");
-  InsertUnique(includesFiles, "events-tools/cameratools.js");
-  InsertUnique(includesFiles, "events-tools/soundtools.js");
-  InsertUnique(includesFiles, "events-tools/storagetools.js");
-  InsertUnique(includesFiles, "events-tools/stringtools.js");
-  InsertUnique(includesFiles, "events-tools/windowtools.js");
-  InsertUnique(includesFiles, "events-tools/networktools.js");
+  includesFiles.insert("libs/jshashtable.js");
+  includesFiles.insert("logger.js");
+  includesFiles.insert("gd.js");
+  includesFiles.insert("libs/rbush.js");
+  includesFiles.insert("inputmanager.js");
+  includesFiles.insert("jsonmanager.js");
+  includesFiles.insert("timemanager.js");
+  includesFiles.insert("runtimeobject.js");
+  includesFiles.insert("profiler.js");
+  includesFiles.insert("runtimescene.js");
+  includesFiles.insert("scenestack.js");
+  includesFiles.insert("polygon.js");
+  includesFiles.insert("force.js");
+  includesFiles.insert("layer.js");
+  includesFiles.insert("timer.js");
+  includesFiles.insert("runtimegame.js");
+  includesFiles.insert("variable.js");
+  includesFiles.insert("variablescontainer.js");
+  includesFiles.insert("oncetriggers.js");
+  includesFiles.insert("runtimebehavior.js");
+  includesFiles.insert("spriteruntimeobject.js");
+
+  // Common includes for events only. Common and object tools are also used
+  // by the runtime and the extensions, so they are always included.
+  if (onlyUsedEventsTools) {
+    includesFiles.insert("events-tools/commontools.js");
+    includesFiles.insert("events-tools/objecttools.js");
+  } else {
+    for (const gd::String &includeFile :
+         JsPlatform::GetEventsToolsIncludeFiles())
+      includesFiles.insert(includeFile);
+  }
 
   if (gdevelopLogoStyle == "dark") {
-    InsertUnique(includesFiles, "splash/gd-logo-dark.js");
+    includesFiles.insert("splash/gd-logo-dark.js");
   } else if (gdevelopLogoStyle == "dark-colored") {
-    InsertUnique(includesFiles, "splash/gd-logo-dark-colored.js");
+    includesFiles.insert("splash/gd-logo-dark-colored.js");
   } else if (gdevelopLogoStyle == "light-colored") {
-    InsertUnique(includesFiles, "splash/gd-logo-light-colored.js");
+    includesFiles.insert("splash/gd-logo-light-colored.js");
   } else {
-    InsertUnique(includesFiles, "splash/gd-logo-light.js");
+    includesFiles.insert("splash/gd-logo-light.js");
   }
 
   if (includeWebsocketDebuggerClient || includeWindowMessageDebuggerClient) {
-    InsertUnique(includesFiles, "debugger-client/hot-reloader.js");
-    InsertUnique(includesFiles, "debugger-client/abstract-debugger-client.js");
+    includesFiles.insert("debugger-client/hot-reloader.js");
+    includesFiles.insert("debugger-client/abstract-debugger-client.js");
   }
   if (includeWebsocketDebuggerClient) {
-    InsertUnique(includesFiles, "debugger-client/websocket-debugger-client.js");
+    includesFiles.insert("debugger-client/websocket-debugger-client.js");
   }
   if (includeWindowMessageDebuggerClient) {
-    InsertUnique(includesFiles,
-                 "debugger-client/window-message-debugger-client.js");
+    includesFiles.insert("debugger-client/window-message-debugger-client.js");
   }
 
   if (pixiRenderers) {
-    InsertUnique(includesFiles, "pixi-renderers/pixi.js");
-    InsertUnique(includesFiles, "pixi-renderers/pixi-filters-tools.js");
-    InsertUnique(includesFiles, "pixi-renderers/runtimegame-pixi-renderer.js");
-    InsertUnique(includesFiles, "pixi-renderers/runtimescene-pixi-renderer.js");
-    InsertUnique(includesFiles, "pixi-renderers/layer-pixi-renderer.js");
-    InsertUnique(includesFiles, "pixi-renderers/pixi-image-manager.js");
-    InsertUnique(includesFiles, "pixi-renderers/pixi-bitmapfont-manager.js");
-    InsertUnique(includesFiles,
-                 "pixi-renderers/spriteruntimeobject-pixi-renderer.js");
-    InsertUnique(includesFiles,
-                 "pixi-renderers/loadingscreen-pixi-renderer.js");
-    InsertUnique(includesFiles, "pixi-renderers/pixi-effects-manager.js");
-    InsertUnique(includesFiles, "howler-sound-manager/howler.min.js");
-    InsertUnique(includesFiles, "howler-sound-manager/howler-sound-manager.js");
-    InsertUnique(includesFiles,
-                 "fontfaceobserver-font-manager/fontfaceobserver.js");
-    InsertUnique(
-        includesFiles,
+    includesFiles.insert("pixi-renderers/pixi.js");
+    includesFiles.insert("pixi-renderers/pixi-filters-tools.js");
+    includesFiles.insert("pixi-renderers/runtimegame-pixi-renderer.js");
+    includesFiles.insert("pixi-renderers/runtimescene-pixi-renderer.js");
+    includesFiles.insert("pixi-renderers/layer-pixi-renderer.js");
+    includesFiles.insert("pixi-renderers/pixi-image-manager.js");
+    includesFiles.insert("pixi-renderers/pixi-bitmapfont-manager.js");
+    includesFiles.insert("pixi-renderers/spriteruntimeobject-pixi-renderer.js");
+    includesFiles.insert("pixi-renderers/loadingscreen-pixi-renderer.js");
+    includesFiles.insert("pixi-renderers/pixi-effects-manager.js");
+    includesFiles.insert("howler-sound-manager/howler.min.js");
+    includesFiles.insert("howler-sound-manager/howler-sound-manager.js");
+    includesFiles.insert("fontfaceobserver-font-manager/fontfaceobserver.js");
+    includesFiles.insert(
         "fontfaceobserver-font-manager/fontfaceobserver-font-manager.js");
   }
 }
 
-void ExporterHelper::RemoveIncludes(bool pixiRenderers,
-                                    std::vector<gd::String> &includesFiles) {
+void ExporterHelper::RemoveIncludes(
+    bool pixiRenderers, gd::InsertionOrderedSet<gd::String> &includesFiles) {
   if (pixiRenderers) {
-    for (size_t i = 0; i < includesFiles.size();) {
-      const gd::String &includeFile = includesFiles[i];
-      if (includeFile.find("pixi-renderer") != gd::String::npos ||
-          includeFile.find("pixi-filter") != gd::String::npos)
-        includesFiles.erase(includesFiles.begin() + i);
-      else
-        ++i;
-    }
+    includesFiles.erase_if([](const gd::String &includeFile) {
+      return includeFile.find("pixi-renderer") != gd::String::npos ||
+             includeFile.find("pixi-filter") != gd::String::npos;
+    });
   }
 }
 
 bool ExporterHelper::ExportEffectIncludes(
-    gd::Project &project, std::vector<gd::String> &includesFiles) {
+    gd::Project &project, gd::InsertionOrderedSet<gd::String> &includesFiles) {
   std::set<gd::String> effectIncludes;
 
   gd::EffectsCodeGenerator::GenerateEffectsIncludeFiles(
       project.GetCurrentPlatform(), project, effectIncludes);
 
-  for (auto &include : effectIncludes) InsertUnique(includesFiles, include);
+  includesFiles.insert(effectIncludes.begin(), effectIncludes.end());
 
   return true;
 }
 
-bool ExporterHelper::ExportEventsCode(gd::Project &project,
-                                      gd::String outputDir,
-                                      std::vector<gd::String> &includesFiles,
-                                      bool exportForPreview) {
+bool ExporterHelper::ExportEventsCode(
+    gd::Project &project,
+    gd::String outputDir,
+    gd::InsertionOrderedSet<gd::String> &includesFiles,
+    bool exportForPreview,
+    bool compactCode,
+    const gd::String &eventsProfilingFile) {
   fs.MkDir(outputDir);
 
+  gd::SerializerElement eventsProfilingElement;
+  auto &layoutsElement = eventsProfilingElement.AddChild("layouts");
+  layoutsElement.ConsiderAsArrayOf("layout");
+
+  std::set<gd::String> scannedIncludes;
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     std::set<gd::String> eventsIncludes;
     gd::Layout &layout = project.GetLayout(i);
-    LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
-    // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
-      for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+    gd::SerializerElement eventsProfilingTable;
+    LayoutCodeGenerator layoutCodeGenerator(project);
+    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
+        layout,
+        eventsIncludes,
+        !exportForPreview,
+        compactCode,
+        eventsProfilingFile.empty() ? nullptr : &eventsProfilingTable);
+    if (!eventsProfilingFile.empty()) {
+      auto &layoutElement = layoutsElement.AddChild("layout");
+      layoutElement.SetStringAttribute("name", layout.GetName());
+      layoutElement.SetStringAttribute("codeFile",
+                                       fs.FileNameFrom(filename));
+      layoutElement.AddChild("events") = eventsProfilingTable;
+    }
+
+    // JavaScript code events can call events tools that no instruction uses,
+    // and so can the code of events functions extensions.
+    AddEventsToolsCalledByCode(eventsOutput, eventsIncludes);
+    AddEventsToolsCalledByIncludes(fs, scannedIncludes, eventsIncludes);
 
-      InsertUnique(includesFiles, filename);
+    // Export the code
+    if (WriteFileIfChanged(filename, eventsOutput)) {
+      includesFiles.insert(eventsIncludes.begin(), eventsIncludes.end());
+      includesFiles.insert(filename);
     } else {
       lastError = _("Unable to write ") + filename;
       return false;
     }
   }
 
+  if (!eventsProfilingFile.empty() &&
+      !fs.WriteToFile(eventsProfilingFile,
+                      gd::Serializer::ToJSON(eventsProfilingElement))) {
+    lastError = _("Unable to write ") + eventsProfilingFile;
+    return false;
+  }
+
   return true;
 }
 
 bool ExporterHelper::ExportExternalSourceFiles(
     gd::Project &project,
     gd::String outputDir,
-    std::vector<gd::String> &includesFiles) {
+    gd::InsertionOrderedSet<gd::String> &includesFiles) {
   const auto &allFiles = project.GetAllSourceFiles();
   for (std::size_t i = 0; i < allFiles.size(); ++i) {
     if (!allFiles[i]) continue;
@@ -679,10 +856,10 @@ bool ExporterHelper::ExportExternalSourceFiles(
     gd::String filename = file.GetFileName();
     fs.MakeAbsolute(filename, fs.DirNameFrom(project.GetProjectFile()));
     gd::String outFilename = "ext-code" + gd::String::From(i) + ".js";
-    if (!fs.CopyFile(filename, outputDir + outFilename))
+    if (!CopyFileIfChanged(filename, outputDir + outFilename))
       gd::LogWarning(_("Could not copy external file") + filename);
 
-    InsertUnique(includesFiles, outputDir + outFilename);
+    includesFiles.insert(outputDir + outFilename);
   }
 
   return true;
@@ -728,7 +905,7 @@ gd::String ExporterHelper::GetExportedIncludeFilename(
 }
 
 bool ExporterHelper::ExportIncludesAndLibs(
-    const std::vector<gd::String> &includesFiles,
+    const gd::InsertionOrderedSet<gd::String> &includesFiles,
     gd::String exportDir,
     bool exportSourceMaps) {
   for (auto &include : includesFiles) {
@@ -741,12 +918,12 @@ bool ExporterHelper::ExportIncludesAndLibs(
         gd::String path = fs.DirNameFrom(exportDir + "/" + include);
         if (!fs.DirExists(path)) fs.MkDir(path);
 
-        fs.CopyFile(source, exportDir + "/" + include);
+        CopyFileIfChanged(source, exportDir + "/" + include);
 
         gd::String sourceMap = source + ".map";
         // Copy source map if present
         if (exportSourceMaps && fs.FileExists(sourceMap)) {
-          fs.CopyFile(sourceMap, exportDir + "/" + include + ".map");
+          CopyFileIfChanged(sourceMap, exportDir + "/" + include + ".map");
         }
       } else {
         std::cout << "Could not find GDJS include file " << include
@@ -756,7 +933,8 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // Note: all the code generated from events are generated in another
       // folder and fall in this case:
       if (fs.FileExists(include)) {
-        fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
+        CopyFileIfChanged(include,
+                          exportDir + "/" + fs.FileNameFrom(include));
       } else {
         std::cout << "Could not find include file " << include << std::endl;
       }
@@ -766,12 +944,122 @@ bool ExporterHelper::ExportIncludesAndLibs(
   return true;
 }
 
+gd::InsertionOrderedSet<gd::String> ExporterHelper::ExtractLayoutsCodeChunks(
+    const gd::Project &project,
+    gd::InsertionOrderedSet<gd::String> &includesFiles,
+    gd::SerializerElement &runtimeGameOptions) {
+  gd::InsertionOrderedSet<gd::String> codeChunksFiles;
+  gd::SerializerElement &codeChunksElement =
+      runtimeGameOptions.AddChild("codeChunks");
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    // See ExportEventsCode for the name of the files.
+    gd::String codeFile =
+        codeOutputDir + "/" + "code" + gd::String::From(i) + ".js";
+    if (!includesFiles.count(codeFile)) continue;
+
+    codeChunksFiles.insert(codeFile);
+    codeChunksElement.AddChild(project.GetLayout(i).GetName())
+        .SetStringValue(GetExportedIncludeFilename(codeFile));
+  }
+
+  // Remove all the chunks at once to keep this linear in the number of files.
+  includesFiles.erase_if([&codeChunksFiles](const gd::String &includeFile) {
+    return codeChunksFiles.count(includeFile) != 0;
+  });
+
+  return codeChunksFiles;
+}
+
+bool ExporterHelper::ExportIncludesBundle(
+    const gd::InsertionOrderedSet<gd::String> &includesFiles,
+    gd::String exportDir,
+    const gd::String &bundleFilename) {
+  static const std::string sourceMappingUrlComment = "//# sourceMappingURL=";
+
+  std::string bundle;
+  std::size_t linesCount = 0;
+  gd::SerializerElement sourceMap;
+  sourceMap.SetAttribute("version", 3);
+  sourceMap.SetAttribute("file", fs.FileNameFrom(bundleFilename));
+  gd::SerializerElement &sectionsElement = sourceMap.AddChild("sections");
+  sectionsElement.ConsiderAsArray();
+
+  for (auto &include : includesFiles) {
+    gd::String source =
+        fs.IsAbsolute(include) ? include : gdjsRoot + "/Runtime/" + include;
+    if (!fs.FileExists(source)) {
+      std::cout << "Could not find include file " << include << std::endl;
+      continue;
+    }
+
+    // The source map of the bundle replaces the ones of the files.
+    std::string content = fs.ReadFile(source).Raw();
+    std::size_t commentPosition = content.rfind(sourceMappingUrlComment);
+    if (commentPosition != std::string::npos &&
+        (commentPosition == 0 || content[commentPosition - 1] == '\n'))
+      content.erase(commentPosition,
+                    content.find('\n', commentPosition) - commentPosition);
+
+    gd::String sourceMapFile = source + ".map";
+    gd::String sourceMapContent =
+        fs.FileExists(sourceMapFile) ? fs.ReadFile(sourceMapFile) : "";
+    if (!sourceMapContent.empty()) {
+      gd::SerializerElement fileSourceMap =
+          gd::Serializer::FromJSON(sourceMapContent);
+
+      // Sources are relative to the directory of the file source map, which
+      // is not the one of the bundle source map for files in subdirectories.
+      gd::String includeDirectory =
+          fs.IsAbsolute(include) ? "" : fs.DirNameFrom(include);
+      if (includeDirectory == include) includeDirectory = "";
+      gd::String sourceRoot = fileSourceMap.GetStringAttribute("sourceRoot");
+      if (!includeDirectory.empty() && !fs.IsAbsolute(sourceRoot) &&
+          sourceRoot.find("://") == gd::String::npos) {
+        (fileSourceMap.HasChild("sourceRoot")
+             ? fileSourceMap.GetChild("sourceRoot")
+             : fileSourceMap.AddChild("sourceRoot"))
+            .SetStringValue(includeDirectory + "/" + sourceRoot);
+      }
+
+      gd::SerializerElement &sectionElement = sectionsElement.AddChild("");
+      gd::SerializerElement &offsetElement = sectionElement.AddChild("offset");
+      offsetElement.SetAttribute("line", (int)linesCount);
+      offsetElement.SetAttribute("column", 0);
+      sectionElement.AddChild("map") = fileSourceMap;
+    }
+
+    bundle += content;
+    if (!content.empty() && content.back() != '\n') bundle += '\n';
+    linesCount += std::count(content.begin(), content.end(), '\n') +
+                  (!content.empty() && content.back() != '\n' ? 1 : 0);
+  }
+
+  gd::String bundleFile = exportDir + "/" + bundleFilename;
+  gd::String path = fs.DirNameFrom(bundleFile);
+  if (!fs.DirExists(path)) fs.MkDir(path);
+
+  if (sectionsElement.GetChildrenCount() > 0) {
+    bundle += sourceMappingUrlComment +
+              fs.FileNameFrom(bundleFilename).Raw() + ".map\n";
+    if (!WriteFileIfChanged(bundleFile + ".map",
+                            gd::Serializer::ToJSON(sourceMap))) {
+      lastError = _("Unable to write ") + bundleFile + ".map";
+      return false;
+    }
+  }
+
+  if (!WriteFileIfChanged(bundleFile, gd::String::FromUTF8(bundle))) {
+    lastError = _("Unable to write ") + bundleFile;
+    return false;
+  }
+
+  return true;
+}
+
 void ExporterHelper::ExportObjectAndBehaviorsIncludes(
-    gd::Project &project, std::vector<gd::String> &includesFiles) {
+    gd::Project &project, gd::InsertionOrderedSet<gd::String> &includesFiles) {
   auto addIncludeFiles = [&](const std::vector<gd::String> &newIncludeFiles) {
-    for (const auto &includeFile : newIncludeFiles) {
-      InsertUnique(includesFiles, includeFile);
-    }
+    includesFiles.insert(newIncludeFiles.begin(), newIncludeFiles.end());
   };
 
   auto addObjectIncludeFiles = [&](const gd::Object &object) {
@@ -812,6 +1100,74 @@ void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
       project, fs, exportDir, true, false, false);
 }
 
+bool ExporterHelper::WriteFileIfChanged(const gd::String &filename,
+                                        const gd::String &content) {
+  gd::String hash = HashFileContent(content);
+  auto exportedFileHash = exportedFilesHashes.find(filename);
+  if (incrementalExport && exportedFileHash != exportedFilesHashes.end() &&
+      exportedFileHash->second == hash && fs.FileExists(filename))
+    return true;
+
+  if (!fs.WriteToFile(filename, content)) {
+    exportedFilesHashes.erase(filename);
+    return false;
+  }
+
+  exportedFilesHashes[filename] = hash;
+  return true;
+}
+
+bool ExporterHelper::CopyFileIfChanged(const gd::String &file,
+                                       const gd::String &destination) {
+  auto fileHash = exportedFilesHashes.find(file);
+  if (incrementalExport) {
+    if (fileHash != exportedFilesHashes.end()) {
+      // The file was written by the export: compare its content hash with
+      // the one of the destination.
+      auto destinationHash = exportedFilesHashes.find(destination);
+      if (destinationHash != exportedFilesHashes.end() &&
+          destinationHash->second == fileHash->second &&
+          fs.FileExists(destination))
+        return true;
+    } else if (fs.IsFileCopyUpToDate(file, destination)) {
+      return true;
+    }
+  }
+
+  if (!fs.CopyFile(file, destination)) {
+    exportedFilesHashes.erase(destination);
+    return false;
+  }
+
+  if (fileHash != exportedFilesHashes.end())
+    exportedFilesHashes[destination] = fileHash->second;
+  else
+    exportedFilesHashes.erase(destination);
+  return true;
+}
+
+void ExporterHelper::LoadExportManifest(const gd::String &exportDir) {
+  exportedFilesHashes.clear();
+
+  gd::String manifestFile = exportDir + "/" + exportManifestFilename;
+  if (!fs.FileExists(manifestFile)) return;
+
+  gd::SerializerElement manifestElement =
+      gd::ProjectFileReader::ReadJSON(fs, manifestFile, true);
+  for (const auto &child : manifestElement.GetChild("files").GetAllChildren())
+    exportedFilesHashes[child.first] = child.second->GetStringValue();
+}
+
+bool ExporterHelper::SaveExportManifest(const gd::String &exportDir) {
+  gd::SerializerElement manifestElement;
+  gd::SerializerElement &filesElement = manifestElement.AddChild("files");
+  for (const auto &it : exportedFilesHashes)
+    filesElement.AddChild(it.first).SetStringValue(it.second);
+
+  return fs.WriteToFile(exportDir + "/" + exportManifestFilename,
+                        gd::Serializer::ToJSON(manifestElement));
+}
+
 void ExporterHelper::AddDeprecatedFontFilesToFontResources(
     gd::AbstractFileSystem &fs,
     gd::ResourcesManager &resourcesManager,
@@ -8,9 +8,11 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/InsertionOrderedSet.h"
 namespace gd {
 class Project;
 class Layout;
@@ -37,7 +39,8 @@ struct PreviewExportOptions {
         useWindowMessageDebuggerClient(false),
         projectDataOnlyExport(false),
         fullLoadingScreen(false),
-        nonRuntimeScriptsCacheBurst(0){};
+        nonRuntimeScriptsCacheBurst(0),
+        incrementalExport(false){};
 
   /**
    * \brief Set the address of the debugger server that the game should reach
@@ -115,6 +118,19 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the export should be incremental (false by default): the
+   * export directory is not cleared and files that were exported with the same
+   * content by the previous export are not written again.
+   *
+   * \note Files of the previous export that are no longer used (for example,
+   * the code of a deleted layout) are kept in the export directory.
+   */
+  PreviewExportOptions &SetIncrementalExport(bool enable) {
+    incrementalExport = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String websocketDebuggerServerAddress;
@@ -126,6 +142,7 @@ struct PreviewExportOptions {
   bool projectDataOnlyExport;
   bool fullLoadingScreen;
   unsigned int nonRuntimeScriptsCacheBurst;
+  bool incrementalExport;
 };
 
 /**
@@ -144,6 +161,27 @@ class ExporterHelper {
    */
   const gd::String &GetLastError() const { return lastError; };
 
+  /**
+   * \brief Return the name and the duration (in milliseconds) of the phases
+   * of the exports done with this helper, in the order they were done.
+   */
+  const std::vector<std::pair<gd::String, double>> &GetPhasesDurations()
+      const {
+    return phasesDurations;
+  };
+
+  /**
+   * \brief Return the current time, in milliseconds.
+   */
+  static double GetTimeNow();
+
+  /**
+   * \brief Log and store the time spent in a phase of an export.
+   *
+   * \return The current time, to be passed when the next phase is done.
+   */
+  double LogTimeSpent(const gd::String &name, double previousTime);
+
   /**
    * \brief Export a project to JSON
    *
@@ -160,6 +198,40 @@ class ExporterHelper {
       gd::String filename,
       const gd::SerializerElement &runtimeGameOptions);
 
+  /**
+   * \brief Export a project to JSON like ExportProjectData, but store the
+   * data of each layout and external layout in its own JSON file, in the
+   * "data" directory of the exported game.
+   *
+   * Only the names of the layouts and external layouts are kept in the
+   * project data, along with the file storing the rest of their data
+   * ("dataChunk"). The game fetches these files while loading the assets and
+   * parses each of them when the layout is first used.
+   *
+   * \param fs The abstract file system to use to write the files
+   * \param project The project to be exported.
+   * \param filename The filename where export the project
+   * \param exportDir The directory where the game is exported.
+   * \param runtimeGameOptions The content of the extra configuration to store
+   * in gdjs.runtimeGameOptions
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
+   */
+  static gd::String ExportSplitProjectData(
+      gd::AbstractFileSystem &fs,
+      const gd::Project &project,
+      gd::String filename,
+      gd::String exportDir,
+      const gd::SerializerElement &runtimeGameOptions);
+
+  /**
+   * \brief Return the content of the file storing the project data, as
+   * written by ExportProjectData.
+   */
+  static gd::String GenerateProjectData(
+      const gd::Project &project,
+      const gd::SerializerElement &runtimeGameOptions);
+
   /**
    * \brief Copy all the resources of the project to to the export directory,
    * updating the resources filenames.
@@ -176,32 +248,73 @@ class ExporterHelper {
 
   /**
    * \brief Add libraries files to the list of includes.
+   *
+   * \param onlyUsedEventsTools If true, only the events tools used by the
+   * runtime itself are added. The other ones are added by ExportEventsCode
+   * when the events, or the code of the events functions extensions they
+   * use, call them.
    */
   void AddLibsInclude(bool pixiRenderers,
                       bool includeWebsocketDebuggerClient,
                       bool includeWindowMessageDebuggerClient,
+                      bool onlyUsedEventsTools,
                       gd::String gdevelopLogoStyle,
-                      std::vector<gd::String> &includesFiles);
+                      gd::InsertionOrderedSet<gd::String> &includesFiles);
 
   /**
    * \brief Remove include files that are Pixi renderers.
    */
   void RemoveIncludes(bool pixiRenderers,
-                      std::vector<gd::String> &includesFiles);
+                      gd::InsertionOrderedSet<gd::String> &includesFiles);
 
   /**
    * \brief Copy all the specified files to the
    * export directory. Relative files are copied from "<GDJS root>/Runtime"
    * directory.
    *
-   * \param includesFiles A vector with filenames to be copied.
+   * \param includesFiles The filenames to be copied.
    * \param exportDir The directory where the files must be copied.
    * \param exportSourceMaps Should the source maps be copied? Should be true on
    * previews only.
    */
-  bool ExportIncludesAndLibs(const std::vector<gd::String> &includesFiles,
-                             gd::String exportDir,
-                             bool exportSourceMaps);
+  bool ExportIncludesAndLibs(
+      const gd::InsertionOrderedSet<gd::String> &includesFiles,
+      gd::String exportDir,
+      bool exportSourceMaps);
+
+  /**
+   * \brief Remove the events code files of the layouts from the includes, and
+   * declare them in the options of the game ("codeChunks") instead: the game
+   * fetches all of them while loading the assets, and evaluates each of them
+   * only when its layout is first used.
+   *
+   * \return The events code files of the layouts, still to be exported with
+   * ExportIncludesAndLibs.
+   */
+  gd::InsertionOrderedSet<gd::String> ExtractLayoutsCodeChunks(
+      const gd::Project &project,
+      gd::InsertionOrderedSet<gd::String> &includesFiles,
+      gd::SerializerElement &runtimeGameOptions);
+
+  /**
+   * \brief Concatenate the specified files, in the order they must be
+   * included, into a single bundle file in the export directory, so that the
+   * game fetches one script instead of one for each file.
+   *
+   * The source maps of the files (".map" files next to them) are merged into
+   * an index source map of the bundle ("<bundle>.map"), with a section for
+   * each file.
+   *
+   * \param includesFiles The files to bundle. Relative files are read from the
+   * "<GDJS root>/Runtime" directory.
+   * \param exportDir The directory where the bundle must be written.
+   * \param bundleFilename The filename of the bundle, relative to the export
+   * directory.
+   */
+  bool ExportIncludesBundle(
+      const gd::InsertionOrderedSet<gd::String> &includesFiles,
+      gd::String exportDir,
+      const gd::String &bundleFilename);
 
   /**
    * \brief Generate the events JS code, and save them to the export directory.
@@ -209,26 +322,38 @@ class ExporterHelper {
    * Files are named "codeX.js", X being the number of the layout in the
    * project. \param project The project with resources to be exported. \param
    * outputDir The directory where the events code must be generated. \param
-   * includesFiles A reference to a vector that will be filled with JS files to
+   * includesFiles A reference to a set that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   *
+   * The include files of the instructions and expressions used by the events
+   * are added, as well as the events tools called by JavaScript code events.
+   *
+   * \param compactCode If true, the code is made smaller (see
+   * gdjs::EventsCodeGenerator::SetGenerateCompactCode).
+   * \param eventsProfilingFile If not empty, the code notifies the profiler of
+   * the time spent in events (see
+   * gdjs::EventsCodeGenerator::SetGenerateEventsProfilingCode), and the table
+   * of the profiled events of each layout is written in this JSON file.
    */
   bool ExportEventsCode(gd::Project &project,
                         gd::String outputDir,
-                        std::vector<gd::String> &includesFiles,
-                        bool exportForPreview);
+                        gd::InsertionOrderedSet<gd::String> &includesFiles,
+                        bool exportForPreview,
+                        bool compactCode = false,
+                        const gd::String &eventsProfilingFile = "");
 
   /**
    * \brief Add the project effects include files.
    */
   bool ExportEffectIncludes(gd::Project &project,
-                            std::vector<gd::String> &includesFiles);
+                            gd::InsertionOrderedSet<gd::String> &includesFiles);
 
   /**
    * \brief Add the include files for all the objects of the project
    * and their behaviors.
    */
-  void ExportObjectAndBehaviorsIncludes(gd::Project &project,
-                                        std::vector<gd::String> &includesFiles);
+  void ExportObjectAndBehaviorsIncludes(
+      gd::Project &project, gd::InsertionOrderedSet<gd::String> &includesFiles);
 
   /**
    * \brief Copy the external source files used by the game into the export
@@ -237,13 +362,14 @@ class ExporterHelper {
    * Files are named "ext-codeX.js", X being the index of the external source
    * file in the project. \param project The project with resources to be
    * exported. \param outputDir The directory where the events code must be
-   * generated. \param includesFiles A reference to a vector that will be filled
+   * generated. \param includesFiles A reference to a set that will be filled
    * with JS files to be exported along with the project. (including
    * "ext-codeX.js" files).
    */
-  bool ExportExternalSourceFiles(gd::Project &project,
-                                 gd::String outputDir,
-                                 std::vector<gd::String> &includesFiles);
+  bool ExportExternalSourceFiles(
+      gd::Project &project,
+      gd::String outputDir,
+      gd::InsertionOrderedSet<gd::String> &includesFiles);
 
   /**
    * \brief Generate the standard index file and save it to the export
@@ -262,12 +388,13 @@ class ExporterHelper {
    * \param additionalSpec JSON string that will be passed to the
    * gdjs.RuntimeGame object.
    */
-  bool ExportPixiIndexFile(const gd::Project &project,
-                           gd::String source,
-                           gd::String exportDir,
-                           const std::vector<gd::String> &includesFiles,
-                           unsigned int nonRuntimeScriptsCacheBurst,
-                           gd::String additionalSpec = "");
+  bool ExportPixiIndexFile(
+      const gd::Project &project,
+      gd::String source,
+      gd::String exportDir,
+      const gd::InsertionOrderedSet<gd::String> &includesFiles,
+      unsigned int nonRuntimeScriptsCacheBurst,
+      gd::String additionalSpec = "");
 
   /**
    * \brief Replace the annotations in a index.html file by the specified
@@ -277,7 +404,7 @@ class ExporterHelper {
    * \param exportDir The directory where the project must be generated.
    * \param includesFiles "<!--GDJS_CODE_FILES -->" will be
    * replaced by HTML tags to include the filenames
-   * contained inside the vector.
+   * contained inside the set.
    * \param nonRuntimeScriptsCacheBurst If non zero, add an additional cache
    * bursting parameter to scripts, that are not part of the runtime/extensions,
    * to force the browser to reload them.
@@ -285,11 +412,12 @@ class ExporterHelper {
    * surrounded by comments marks will be replaced by the
    * content of this string.
    */
-  bool CompleteIndexFile(gd::String &indexFileContent,
-                         gd::String exportDir,
-                         const std::vector<gd::String> &includesFiles,
-                         unsigned int nonRuntimeScriptsCacheBurst,
-                         gd::String additionalSpec);
+  bool CompleteIndexFile(
+      gd::String &indexFileContent,
+      gd::String exportDir,
+      const gd::InsertionOrderedSet<gd::String> &includesFiles,
+      unsigned int nonRuntimeScriptsCacheBurst,
+      gd::String additionalSpec);
 
   /**
    * \brief Generate the Cordova configuration file and save it to the export
@@ -348,6 +476,36 @@ class ExporterHelper {
     codeOutputDir = codeOutputDir_;
   }
 
+  /**
+   * \brief Write the file, unless the export is incremental and the file was
+   * already written with the same content.
+   *
+   * The hash of the content is stored in the export manifest.
+   */
+  bool WriteFileIfChanged(const gd::String &filename,
+                          const gd::String &content);
+
+  /**
+   * \brief Copy the file, unless the export is incremental and the
+   * destination is known to be up to date: either because it is a copy of a
+   * file written with the same content, or because the file system says so
+   * (see gd::AbstractFileSystem::IsFileCopyUpToDate).
+   */
+  bool CopyFileIfChanged(const gd::String &file,
+                         const gd::String &destination);
+
+  /**
+   * \brief Read the export manifest (the hashes of the exported files) stored
+   * in the export directory by a previous export.
+   */
+  void LoadExportManifest(const gd::String &exportDir);
+
+  /**
+   * \brief Store the export manifest in the export directory, to be used by
+   * the next incremental export.
+   */
+  bool SaveExportManifest(const gd::String &exportDir);
+
   static void AddDeprecatedFontFilesToFontResources(
       gd::AbstractFileSystem &fs,
       gd::ResourcesManager &resourcesManager,
@@ -361,6 +519,13 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  bool incrementalExport;    ///< If true, files already exported with the same
+                             ///< content are not written again.
+  std::map<gd::String, gd::String>
+      exportedFilesHashes;  ///< The hashes of the content of the exported
+                            ///< files, by filename (the export manifest).
+  std::vector<std::pair<gd::String, double>>
+      phasesDurations;  ///< The durations of the phases of the exports.
 };
 
 }  // namespace gdjs
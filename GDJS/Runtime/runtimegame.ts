@@ -30,6 +30,13 @@ namespace gdjs {
     websocketDebuggerServerAddress?: string;
     /** The port of the debugger server, to reach out using WebSocket. */
     websocketDebuggerServerPort?: string;
+    /**
+     * The files storing the events code of layouts, by layout name, when it's
+     * exported apart from the other scripts. They are all fetched while the
+     * game is loading, and each one is only evaluated when its layout is first
+     * used (see `gdjs.RuntimeGame.loadCodeChunk`).
+     */
+    codeChunks?: Record<string, string>;
   };
 
   /**
@@ -74,6 +81,18 @@ namespace gdjs {
      * Optional client to connect to a debugger server.
      */
     _debuggerClient: gdjs.AbstractDebuggerClient | null;
+
+    /**
+     * The content of the files storing the data of layouts and external layouts
+     * exported apart from the project data, not yet parsed.
+     */
+    _dataChunks: Record<string, string> = {};
+
+    /**
+     * The content of the files storing the events code of layouts exported
+     * apart from the other scripts, not yet evaluated.
+     */
+    _codeChunks: Record<string, string> = {};
     _sessionMetricsInitialized: boolean = false;
     _disableMetrics: boolean = false;
     _isPreview: boolean;
@@ -235,7 +254,7 @@ namespace gdjs {
       for (let i = 0, len = this._data.layouts.length; i < len; ++i) {
         const sceneData = this._data.layouts[i];
         if (sceneName === undefined || sceneData.name === sceneName) {
-          scene = sceneData;
+          scene = this._loadDataChunk(sceneData);
           break;
         }
       }
@@ -274,13 +293,128 @@ namespace gdjs {
       for (let i = 0, len = this._data.externalLayouts.length; i < len; ++i) {
         const layoutData = this._data.externalLayouts[i];
         if (layoutData.name === name) {
-          externalLayout = layoutData;
+          externalLayout = this._loadDataChunk(layoutData);
           break;
         }
       }
       return externalLayout;
     }
 
+    /**
+     * Fetch the files storing the data of layouts and external layouts
+     * exported apart from the project data (see `LayoutData.dataChunk`).
+     *
+     * Files are only parsed when the layout is first used. The promise is
+     * rejected if a file can't be fetched.
+     */
+    _fetchDataChunks(): Promise<void[]> {
+      const dataChunkFiles: string[] = [];
+      for (const layoutData of this._data.layouts) {
+        if (layoutData.dataChunk) dataChunkFiles.push(layoutData.dataChunk);
+      }
+      for (const layoutData of this._data.externalLayouts) {
+        if (layoutData.dataChunk) dataChunkFiles.push(layoutData.dataChunk);
+      }
+
+      return Promise.all(
+        dataChunkFiles.map((dataChunkFile) => {
+          return fetch(dataChunkFile)
+            .then((response) => {
+              if (!response.ok) {
+                throw new Error('HTTP status ' + response.status);
+              }
+              return response.text();
+            })
+            .then(
+              (dataChunk) => {
+                this._dataChunks[dataChunkFile] = dataChunk;
+              },
+              (error) => {
+                throw new Error(
+                  "Can't fetch the data file " +
+                    dataChunkFile +
+                    ', error: ' +
+                    error
+                );
+              }
+            );
+        })
+      );
+    }
+
+    /**
+     * Fetch the files storing the events code of layouts exported apart
+     * from the other scripts (see `RuntimeGameOptions.codeChunks`).
+     *
+     * Files are only evaluated when the layout is first used. The promise is
+     * rejected if a file can't be fetched.
+     */
+    _fetchCodeChunks(): Promise<void[]> {
+      const codeChunks = this._options.codeChunks || {};
+      return Promise.all(
+        Object.keys(codeChunks).map((layoutName) => {
+          const codeChunkFile = codeChunks[layoutName];
+          return fetch(codeChunkFile)
+            .then((response) => {
+              if (!response.ok) {
+                throw new Error('HTTP status ' + response.status);
+              }
+              return response.text();
+            })
+            .then(
+              (codeChunk) => {
+                this._codeChunks[layoutName] = codeChunk;
+              },
+              (error) => {
+                throw new Error(
+                  "Can't fetch the code file " +
+                    codeChunkFile +
+                    ', error: ' +
+                    error
+                );
+              }
+            );
+        })
+      );
+    }
+
+    /**
+     * Evaluate the events code of a layout, if it was exported apart from the
+     * other scripts and not evaluated yet.
+     * @param layoutName The name of the layout.
+     */
+    loadCodeChunk(layoutName: string): void {
+      const codeChunk = this._codeChunks[layoutName];
+      if (codeChunk === undefined) return;
+
+      delete this._codeChunks[layoutName];
+      const codeChunkFile = (this._options.codeChunks || {})[layoutName];
+      // Evaluated in the global scope, like a script.
+      new Function(codeChunk + '\n//# sourceURL=' + codeChunkFile)();
+    }
+
+    /**
+     * Complete the data of a layout or external layout with the content
+     * of the file storing it, if any.
+     */
+    _loadDataChunk<T extends LayoutData | ExternalLayoutData>(data: T): T {
+      const dataChunkFile = data.dataChunk;
+      if (!dataChunkFile) return data;
+
+      const dataChunk = this._dataChunks[dataChunkFile];
+      if (dataChunk === undefined) {
+        logger.error(
+          'The data of "' + data.name + '" was not loaded from ' + dataChunkFile
+        );
+        return data;
+      }
+
+      Object.assign(data, JSON.parse(dataChunk));
+      delete data.dataChunk;
+      delete this._dataChunks[dataChunkFile];
+      return data;
+    }
+
     /**
      * Get the data representing all the global objects of the game.
      * @return The data associated to the global objects.
@@ -525,10 +659,21 @@ namespace gdjs {
                           loadingScreen.setPercent(percent);
                           if (progressCallback) progressCallback(percent);
                         })
+                        .then(() => that._fetchDataChunks())
+                        .then(() => that._fetchCodeChunks())
                         .then(() => loadingScreen.unload())
-                        .then(() => {
-                          callback();
-                        });
+                        .then(
+                          () => {
+                            callback();
+                          },
+                          (error) => {
+                            // The game can't be run without its scenes data
+                            // or code: stop the loading there.
+                            logger.error(
+                              'Unable to load the game: ' + error.message
+                            );
+                          }
+                        );
                     }
                   );
                 }
@@ -434,6 +434,7 @@ namespace gdjs {
      * @param sceneData The scene data, used to find where the code was generated.
      */
     setEventsGeneratedCodeFunction(sceneData: LayoutData): void {
+      if (this._runtimeGame) this._runtimeGame.loadCodeChunk(sceneData.name);
       const module = gdjs[sceneData.mangledName + 'Code'];
       if (module && module.func) {
         this._eventsFunction = module.func;
@@ -70,6 +70,11 @@ declare interface GdVersionData {
 }
 
 declare interface LayoutData {
+  /**
+   * If set, the rest of the data of the layout is stored in this file,
+   * to be loaded by the game (see `gdjs.RuntimeGame.getSceneData`).
+   */
+  dataChunk?: string;
   r: number;
   v: number;
   b: number;
@@ -90,6 +95,11 @@ declare interface BehaviorSharedData {
 }
 
 declare interface ExternalLayoutData {
+  /**
+   * If set, the rest of the data of the external layout is stored in this file,
+   * to be loaded by the game (see `gdjs.RuntimeGame.getExternalLayoutData`).
+   */
+  dataChunk?: string;
   name: string;
   instances: InstanceData[];
 }
@@ -0,0 +1,352 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Command line exporter of GDevelop JS Platform, exporting projects
+ * without the IDE (for example, on continuous integration servers).
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/UsedExtensionsFinder.h"
+#include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/NativeFileSystem.h"
+#include "GDCore/IDE/PlatformManager.h"
+#include "GDCore/IDE/ProjectFileReader.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/ParallelFor.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/Exporter.h"
+#include "GDJS/IDE/ExporterHelper.h"
+
+namespace {
+/**
+ * \brief An export to be done: a whole game, or the preview of a layout.
+ */
+struct ExportJob {
+  gd::String projectFile;
+  gd::String exportDir;
+  gd::String layoutName;  ///< Empty to export the whole game.
+};
+
+struct ExportJobsOptions {
+  ExportJobsOptions() : gdjsRoot("./JsPlatform"), incremental(false){};
+
+  gd::String gdjsRoot;
+  std::map<gd::String, bool> exportOptions;
+  bool incremental;
+};
+
+void PrintUsage() {
+  std::cout
+      << "Usage: GDJSExporter [options] <project file> <export directory> "
+         "[<project file> <export directory>...]\n"
+         "\n"
+         "Export GDevelop projects (JSON files, or binary files saved by "
+         "gd::Project::SerializeToBinary) to HTML5 games.\n"
+         "Projects using events functions extensions can't be exported, as "
+         "their code is generated\n"
+         "by the IDE.\n"
+         "\n"
+         "Options:\n"
+         "  --gdjs-root <directory>      The directory containing the GDJS "
+         "Runtime (default: ./JsPlatform).\n"
+         "  --extensions-dir <directory> Load the native extensions of this "
+         "directory.\n"
+         "  --layout <name>              Export a preview of this layout "
+         "instead of the whole game, in a\n"
+         "                               subdirectory of the export "
+         "directory. Can be repeated.\n"
+         "  --incremental                Only write the files of layouts "
+         "previews that changed since the\n"
+         "                               previous export.\n"
+         "  --split-project-data         Store the data of each layout in its "
+         "own file.\n"
+         "  --only-used-events-tools     Only include the events tools of the "
+         "runtime used by the events.\n"
+         "  --bundle                     Concatenate the scripts of the game "
+         "in a single file.\n"
+         "  --lazy-layouts-code          Evaluate the events code of each "
+         "layout when it's first used\n"
+         "                               (the code is still fetched while the "
+         "game is loading).\n"
+         "  --compact-events-code        Generate smaller events code.\n"
+         "  --events-profiling           Measure the time spent in events, and "
+         "write the profiled events\n"
+         "                               in events-profiling.json.\n"
+         "  --cordova, --electron, --facebook-instant-games\n"
+         "                               The target of the export of whole "
+         "games.\n"
+         "  --jobs <count>               The number of exports done "
+         "concurrently (default: 1, 0 to use\n"
+         "                               the number of hardware threads).\n";
+}
+
+bool LoadProject(gd::AbstractFileSystem& fs,
+                 const gd::String& projectFile,
+                 gd::Project& project) {
+  project.AddPlatform(gdjs::JsPlatform::Get());
+
+  gd::String absoluteProjectFile = projectFile;
+  fs.MakeAbsolute(absoluteProjectFile, "");
+  if (!fs.FileExists(absoluteProjectFile)) return false;
+
+  const gd::String jsonExtension = ".json";
+  if (absoluteProjectFile.size() >= jsonExtension.size() &&
+      absoluteProjectFile.substr(absoluteProjectFile.size() -
+                                 jsonExtension.size()) == jsonExtension) {
+    gd::SerializerElement element = gd::ProjectFileReader::ReadJSON(
+        fs, absoluteProjectFile, /*inSitu=*/true);
+    if (element.GetAllChildren().empty()) return false;
+
+    project.UnserializeFrom(element);
+  } else if (!gd::ProjectFileReader::ReadBinaryProject(
+                 fs, absoluteProjectFile, project)) {
+    return false;
+  }
+
+  // Resources are found relatively to the project file.
+  project.SetProjectFile(absoluteProjectFile);
+  return true;
+}
+
+/**
+ * \brief Check that the platform has all the extensions used by the project.
+ * \return false and the reason in \a error otherwise.
+ */
+bool CheckUsedExtensions(gd::Project& project, gd::String& error) {
+  // The code of events functions extensions is generated by the IDE, so
+  // their instructions and behaviors are unknown here.
+  if (project.GetEventsFunctionsExtensionsCount() > 0) {
+    error = "events functions extensions are not supported";
+    return false;
+  }
+
+  // Objects, behaviors and instructions of unknown types are reported as used
+  // from an extension without name.
+  gd::String missingExtensions;
+  bool hasUnknownTypes = false;
+  for (const gd::String& extensionName :
+       gd::UsedExtensionsFinder::ScanProject(project)) {
+    if (extensionName.empty())
+      hasUnknownTypes = true;
+    else if (!project.GetCurrentPlatform().IsExtensionLoaded(extensionName))
+      missingExtensions +=
+          (missingExtensions.empty() ? "" : ", ") + extensionName;
+  }
+
+  if (!missingExtensions.empty()) {
+    error = "these extensions are not loaded: " + missingExtensions;
+    return false;
+  }
+  if (hasUnknownTypes) {
+    error = "objects, behaviors or instructions of unknown extensions are used";
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Do the export and return the report to be printed.
+ */
+bool RunExportJob(const ExportJob& job,
+                  const ExportJobsOptions& options,
+                  const gd::String& codeOutputDir,
+                  gd::String& report) {
+  double startTime = gdjs::ExporterHelper::GetTimeNow();
+  gd::NativeFileSystem fs;
+  gd::String jobName =
+      "\"" + job.projectFile + "\"" +
+      (job.layoutName.empty() ? "" : " (layout \"" + job.layoutName + "\")");
+
+  gd::Project project;
+  if (!LoadProject(fs, job.projectFile, project)) {
+    report = "Unable to load " + jobName + ".\n";
+    return false;
+  }
+
+  gd::String extensionsError;
+  if (!CheckUsedExtensions(project, extensionsError)) {
+    report = "Unable to export " + jobName + ": " + extensionsError + ".\n";
+    return false;
+  }
+
+  gdjs::Exporter exporter(fs, options.gdjsRoot);
+  exporter.SetCodeOutputDirectory(codeOutputDir);
+  fs.ClearDir(codeOutputDir);
+
+  bool exported = false;
+  if (job.layoutName.empty()) {
+    std::map<gd::String, bool> exportOptions = options.exportOptions;
+    exported =
+        exporter.ExportWholePixiProject(project, job.exportDir, exportOptions);
+  } else if (!project.HasLayoutNamed(job.layoutName)) {
+    report = "Unable to export " + jobName + ": the layout does not exist.\n";
+    return false;
+  } else {
+    gdjs::PreviewExportOptions previewOptions(project, job.exportDir);
+    previewOptions.SetLayoutName(job.layoutName)
+        .SetIncrementalExport(options.incremental)
+        .SetFullLoadingScreen(true);
+    exported = exporter.ExportProjectForPixiPreview(previewOptions);
+  }
+
+  if (!exported) {
+    report = "Unable to export " + jobName + " to " + job.exportDir +
+             (exporter.GetLastError().empty()
+                  ? gd::String(".")
+                  : ": " + exporter.GetLastError()) +
+             "\n";
+    return false;
+  }
+
+  report = "Exported " + jobName + " to " + job.exportDir + " in " +
+           gd::String::From(gdjs::ExporterHelper::GetTimeNow() - startTime) +
+           "ms:\n";
+  for (const auto& phaseDuration : exporter.GetLastPhasesDurations())
+    report += "  " + phaseDuration.first + ": " +
+              gd::String::From(phaseDuration.second) + "ms\n";
+
+  return true;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  ExportJobsOptions options;
+  std::vector<gd::String> extensionsDirs;
+  std::vector<gd::String> layoutNames;
+  std::vector<gd::String> projectsAndExportDirs;
+  std::size_t jobsCount = 1;
+
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = gd::String::FromUTF8(argv[i]);
+    bool hasValue = i + 1 < argc;
+    if (argument == "--help" || argument == "-h") {
+      PrintUsage();
+      return 0;
+    } else if (argument == "--gdjs-root" && hasValue) {
+      options.gdjsRoot = gd::String::FromUTF8(argv[++i]);
+    } else if (argument == "--extensions-dir" && hasValue) {
+      extensionsDirs.push_back(gd::String::FromUTF8(argv[++i]));
+    } else if (argument == "--layout" && hasValue) {
+      layoutNames.push_back(gd::String::FromUTF8(argv[++i]));
+    } else if (argument == "--incremental") {
+      options.incremental = true;
+    } else if (argument == "--split-project-data") {
+      options.exportOptions["splitProjectData"] = true;
+    } else if (argument == "--only-used-events-tools") {
+      options.exportOptions["onlyUsedEventsTools"] = true;
+    } else if (argument == "--bundle") {
+      options.exportOptions["bundleIncludes"] = true;
+    } else if (argument == "--lazy-layouts-code") {
+      options.exportOptions["lazilyLoadedLayoutsCode"] = true;
+    } else if (argument == "--compact-events-code") {
+      options.exportOptions["compactEventsCode"] = true;
+    } else if (argument == "--events-profiling") {
+      options.exportOptions["eventsProfiling"] = true;
+    } else if (argument == "--cordova") {
+      options.exportOptions["exportForCordova"] = true;
+    } else if (argument == "--electron") {
+      options.exportOptions["exportForElectron"] = true;
+    } else if (argument == "--facebook-instant-games") {
+      options.exportOptions["exportForFacebookInstantGames"] = true;
+    } else if (argument == "--jobs" && hasValue) {
+      jobsCount = gd::String::FromUTF8(argv[++i]).To<std::size_t>();
+      if (jobsCount == 0) jobsCount = std::thread::hardware_concurrency();
+    } else if (argument.find("--") == 0) {
+      std::cerr << "Unknown option: " << argument << std::endl;
+      PrintUsage();
+      return 1;
+    } else {
+      projectsAndExportDirs.push_back(argument);
+    }
+  }
+
+  if (projectsAndExportDirs.empty() || projectsAndExportDirs.size() % 2 != 0) {
+    PrintUsage();
+    return 1;
+  }
+
+  std::vector<ExportJob> jobs;
+  for (std::size_t i = 0; i < projectsAndExportDirs.size(); i += 2) {
+    ExportJob job;
+    job.projectFile = projectsAndExportDirs[i];
+    job.exportDir = projectsAndExportDirs[i + 1];
+    if (layoutNames.empty()) {
+      jobs.push_back(job);
+    } else {
+      for (const gd::String& layoutName : layoutNames) {
+        job.layoutName = layoutName;
+        job.exportDir = projectsAndExportDirs[i + 1] + "/" + layoutName;
+        jobs.push_back(job);
+      }
+    }
+  }
+
+  // Declare all the extensions before starting threads, as the platform is
+  // shared by all the exports. It's registered so that projects can find it
+  // by its name.
+  gdjs::JsPlatform& platform = gdjs::JsPlatform::Get();
+  gd::PlatformManager::Get()->AddPlatform(
+      std::shared_ptr<gd::Platform>(&platform, [](gd::Platform*) {}));
+  for (const gd::String& extensionsDir : extensionsDirs) {
+    gd::ExtensionsLoader::LoadAllExtensions(extensionsDir, platform, true);
+    gd::ExtensionsLoader::ExtensionsLoadingDone(extensionsDir);
+  }
+
+  // Each export uses its own directory for the generated code.
+  gd::NativeFileSystem fs;
+  gd::String codeOutputRootDir =
+      fs.GetTempDir() + "/GDTemporaries/GDJSExporter-" +
+      gd::String::From(std::chrono::steady_clock::now()
+                           .time_since_epoch()
+                           .count());
+
+  // Exports running concurrently share the hardware threads for their own
+  // parallel tasks.
+  std::size_t concurrentJobsCount = std::min(jobsCount, jobs.size());
+  if (concurrentJobsCount > 1) {
+    gd::ParallelFor::SetMaxThreadsCount(std::max<std::size_t>(
+        1, gd::ParallelFor::GetMaxThreadsCount() / concurrentJobsCount));
+  }
+
+  std::atomic<std::size_t> nextJobIndex(0);
+  std::atomic<bool> succeeded(true);
+  std::mutex outputMutex;
+  auto runJobs = [&]() {
+    for (std::size_t i = nextJobIndex++; i < jobs.size(); i = nextJobIndex++) {
+      gd::String report;
+      bool exported = RunExportJob(jobs[i],
+                                   options,
+                                   codeOutputRootDir + "/" + gd::String::From(i),
+                                   report);
+      if (!exported) succeeded = false;
+
+      std::lock_guard<std::mutex> lock(outputMutex);
+      (exported ? std::cout : std::cerr) << report << std::flush;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < concurrentJobsCount; ++i)
+    threads.emplace_back(runJobs);
+  runJobs();  // The main thread is doing its share of the exports too.
+  for (auto& thread : threads) thread.join();
+
+  fs.RemoveDir(codeOutputRootDir);
+  return succeeded ? 0 : 1;
+}
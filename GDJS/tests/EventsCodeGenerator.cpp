@@ -0,0 +1,234 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Fill the scene with objects and with events like the ones of a
+ * usual game: creating objects at the beginning of the scene, moving them
+ * according to conditions, with sub-events and "Or" conditions.
+ */
+void FillLayout(gd::Project& project,
+                gd::Layout& layout,
+                std::size_t objectsCount) {
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    gd::String objectName = "MyObject" + gd::String::From(i);
+    layout.InsertNewObject(project, "Sprite", objectName, i);
+
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    event.GetConditions().Insert(gd::Instruction("DepartScene", {""}));
+    event.GetActions().Insert(gd::Instruction(
+        "Create", {"", objectName, "0", "0", "\"\""}));
+    layout.GetEvents().InsertEvent(event);
+
+    gd::StandardEvent movingEvent;
+    movingEvent.SetType("BuiltinCommonInstructions::Standard");
+    movingEvent.GetConditions().Insert(
+        gd::Instruction("PosX", {objectName, "<", "100"}));
+    movingEvent.GetConditions().Insert(
+        gd::Instruction("Timer", {"", "1", "\"MyTimer\""}));
+    movingEvent.GetActions().Insert(
+        gd::Instruction("MettreX", {objectName, "+", "1"}));
+
+    gd::StandardEvent subEvent;
+    subEvent.SetType("BuiltinCommonInstructions::Standard");
+    gd::Instruction orCondition("BuiltinCommonInstructions::Or");
+    orCondition.GetSubInstructions().Insert(
+        gd::Instruction("PosX", {objectName, ">", "50"}));
+    orCondition.GetSubInstructions().Insert(
+        gd::Instruction("Timer", {"", "2", "\"MyTimer\""}));
+    subEvent.GetConditions().Insert(orCondition);
+    subEvent.GetActions().Insert(gd::Instruction("Delete", {objectName, ""}));
+    movingEvent.GetSubEvents().InsertEvent(subEvent);
+    layout.GetEvents().InsertEvent(movingEvent);
+  }
+}
+}  // namespace
+
+TEST_CASE("EventsCodeGenerator", "[common]") {
+  gdjs::JsPlatform platform(true);
+  gd::Project project;
+  project.AddPlatform(platform);
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  FillLayout(project, layout, 10);
+  layout.InsertNewObject(project, "Sprite", "MyUnusedObject", 10);
+  gdjs::LayoutCodeGenerator generator(project);
+
+  SECTION("Compact code") {
+    std::set<gd::String> includeFiles;
+    gd::String code = generator.GenerateLayoutCompleteCode(
+        layout, includeFiles, true, /*compactCode=*/false);
+    std::set<gd::String> compactIncludeFiles;
+    gd::String compactCode = generator.GenerateLayoutCompleteCode(
+        layout, compactIncludeFiles, true, /*compactCode=*/true);
+
+    REQUIRE(compactIncludeFiles == includeFiles);
+    REQUIRE(compactCode.size() < code.size());
+
+    // The namespace of the scene code is only written once, as the parameter
+    // of a function wrapping the code.
+    gd::String codeNamespace = "gdjs.SceneCode";
+    REQUIRE(code.find(codeNamespace + ".GDMyObject0Objects1") !=
+            gd::String::npos);
+    REQUIRE(compactCode.find(codeNamespace + " = {};\n(function($ns) {\n") ==
+            0);
+    REQUIRE(compactCode.find(codeNamespace + ".GDMyObject0Objects1") ==
+            gd::String::npos);
+    REQUIRE(compactCode.find("$ns.GDMyObject0Objects1") != gd::String::npos);
+    REQUIRE(compactCode.find("})(" + codeNamespace + ");\n") !=
+            gd::String::npos);
+
+    // Objects lists not used by the events are not declared.
+    REQUIRE(code.find("GDMyUnusedObjectObjects1") != gd::String::npos);
+    REQUIRE(compactCode.find("GDMyUnusedObjectObjects1") == gd::String::npos);
+
+    // Booleans of conditions setting them whatever their result are not reset
+    // before the conditions, except the last one which is read after them.
+    gd::Layout& conditionsLayout =
+        project.InsertNewLayout("ConditionsScene", 1);
+    gd::StandardEvent conditionsEvent;
+    conditionsEvent.SetType("BuiltinCommonInstructions::Standard");
+    for (std::size_t i = 0; i < 3; ++i) {
+      conditionsEvent.GetConditions().Insert(gd::Instruction(
+          "Timer", {"", gd::String::From(i), "\"MyTimer\""}));
+    }
+    conditionsLayout.GetEvents().InsertEvent(conditionsEvent);
+
+    gd::String conditionsCode = generator.GenerateLayoutCompleteCode(
+        conditionsLayout, includeFiles, true, /*compactCode=*/false);
+    gd::String compactConditionsCode = generator.GenerateLayoutCompleteCode(
+        conditionsLayout, includeFiles, true, /*compactCode=*/true);
+    for (std::size_t i = 0; i < 3; ++i) {
+      gd::String reset = "condition" + gd::String::From(i) +
+                         "IsTrue_0.val = false;";
+      REQUIRE(conditionsCode.find(reset) != gd::String::npos);
+      REQUIRE((compactConditionsCode.find(reset) != gd::String::npos) ==
+              (i == 2));
+    }
+
+    // Booleans of the conditions inside "And", "Not" and "Or" are always
+    // reset, as they are read by these conditions.
+    gd::Layout& subConditionsLayout =
+        project.InsertNewLayout("SubConditionsScene", 2);
+    gd::StandardEvent subConditionsEvent;
+    subConditionsEvent.SetType("BuiltinCommonInstructions::Standard");
+    for (const gd::String& type :
+         std::vector<gd::String>{"BuiltinCommonInstructions::And",
+                                 "BuiltinCommonInstructions::Not",
+                                 "BuiltinCommonInstructions::Or"}) {
+      gd::Instruction condition(type);
+      for (std::size_t i = 0; i < 3; ++i) {
+        condition.GetSubInstructions().Insert(gd::Instruction(
+            "Timer", {"", gd::String::From(i), "\"MyTimer\""}));
+      }
+      subConditionsEvent.GetConditions().Insert(condition);
+    }
+    subConditionsLayout.GetEvents().InsertEvent(subConditionsEvent);
+
+    gd::String compactSubConditionsCode =
+        generator.GenerateLayoutCompleteCode(
+            subConditionsLayout, includeFiles, true, /*compactCode=*/true);
+    for (std::size_t i = 0; i < 3; ++i) {
+      gd::String reset = "$ns.condition" + gd::String::From(i) +
+                         "IsTrue_1.val = false;";
+      std::size_t resetsCount = 0;
+      for (std::size_t position = compactSubConditionsCode.find(reset);
+           position != gd::String::npos;
+           position = compactSubConditionsCode.find(reset, position + 1))
+        resetsCount++;
+      REQUIRE(resetsCount == 3);
+    }
+  }
+
+  SECTION("Events profiling") {
+    std::set<gd::String> includeFiles;
+    gd::String code =
+        generator.GenerateLayoutCompleteCode(layout, includeFiles, true);
+    REQUIRE(code.find("getProfiler") == gd::String::npos);
+
+    gd::SerializerElement eventsProfilingTable;
+    gd::String profiledCode = generator.GenerateLayoutCompleteCode(
+        layout, includeFiles, true, false, &eventsProfilingTable);
+
+    // Events are identified in the order of the events sheet, sub events
+    // included.
+    REQUIRE(eventsProfilingTable.GetChildrenCount() == 30);
+    const gd::SerializerElement& subEventElement =
+        eventsProfilingTable.GetChild(5);
+    REQUIRE(subEventElement.GetIntAttribute("id") == 5);
+    REQUIRE(subEventElement.GetStringAttribute("type") ==
+            "BuiltinCommonInstructions::Standard");
+    const gd::SerializerElement& pathElement =
+        subEventElement.GetChild("path");
+    REQUIRE(pathElement.GetChildrenCount() == 2);
+    REQUIRE(pathElement.GetChild(0).GetIntValue() == 3);
+    REQUIRE(pathElement.GetChild(1).GetIntValue() == 0);
+
+    // Top level events and sub events lists are measured.
+    REQUIRE(profiledCode.find("getProfiler().begin(\"event:3\")") !=
+            gd::String::npos);
+    REQUIRE(profiledCode.find("getProfiler().end(\"event:3\")") !=
+            gd::String::npos);
+    REQUIRE(profiledCode.find("getProfiler().begin(\"subEvents:4\")") !=
+            gd::String::npos);
+    REQUIRE(profiledCode.find("getProfiler().end(\"subEvents:4\")") !=
+            gd::String::npos);
+    REQUIRE(profiledCode.find("\"event:5\"") == gd::String::npos);
+    REQUIRE(profiledCode.find("\"subEvents:3\"") == gd::String::npos);
+  }
+}
+
+TEST_CASE("EventsCodeGenerator - Benchmarks", "[common]") {
+  gdjs::JsPlatform platform(true);
+  gd::Project project;
+  project.AddPlatform(platform);
+  for (std::size_t i = 0; i < 20; ++i) {
+    gd::Layout& layout =
+        project.InsertNewLayout("Scene " + gd::String::From(i), i);
+    FillLayout(project, layout, 30);
+  }
+
+  gdjs::LayoutCodeGenerator generator(project);
+  for (bool compactCode : {false, true}) {
+    std::size_t generatedBytes = 0;
+    DoBenchmark(compactCode ? "Generate the compact code of 20 scenes"
+                            : "Generate the code of 20 scenes",
+                3,
+                [&]() {
+                  generatedBytes = 0;
+                  for (std::size_t i = 0; i < project.GetLayoutsCount();
+                       ++i) {
+                    std::set<gd::String> includeFiles;
+                    generatedBytes +=
+                        generator
+                            .GenerateLayoutCompleteCode(project.GetLayout(i),
+                                                        includeFiles,
+                                                        true,
+                                                        compactCode)
+                            .size();
+                  }
+                });
+    std::cout << (compactCode ? "Compact code" : "Code")
+              << " generated per scene: "
+              << generatedBytes / project.GetLayoutsCount() << " bytes"
+              << std::endl;
+  }
+}
@@ -0,0 +1,575 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/IDE/ExporterHelper.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDJS/Events/Builtin/JsCodeEvent.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/Exporter.h"
+#include "catch.hpp"
+#undef CopyFile  // Disable an annoying macro
+
+namespace {
+/**
+ * \brief A file system storing files in memory, and recording the files
+ * written or copied.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  InMemoryFileSystem(const gd::String& runtimeDir_)
+      : runtimeDir(runtimeDir_){};
+  virtual ~InMemoryFileSystem(){};
+
+  void MkDir(const gd::String& path) override{};
+  bool DirExists(const gd::String& path) override { return true; };
+  bool FileExists(const gd::String& file) override {
+    // Runtime files are all considered to exist (and to be empty).
+    return files.find(file) != files.end() || file.find(runtimeDir) == 0;
+  };
+  gd::String FileNameFrom(const gd::String& file) override {
+    return file.substr(file.find_last_of("/") + 1);
+  };
+  gd::String DirNameFrom(const gd::String& file) override {
+    return file.substr(0, file.find_last_of("/"));
+  };
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    if (IsAbsolute(filename)) return true;
+    filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override {
+    if (filename.find(baseDirectory) != 0) return false;
+    filename = filename.substr(baseDirectory.size());
+    return true;
+  };
+  bool IsAbsolute(const gd::String& filename) override {
+    return filename.find("/") == 0;
+  }
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override {
+    files[destination] = ReadFile(file);
+    copiedFiles.push_back(destination);
+    return true;
+  }
+  bool ClearDir(const gd::String& directory) override {
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first.find(directory + "/") == 0)
+        it = files.erase(it);
+      else
+        ++it;
+    }
+    return true;
+  }
+  bool WriteToFile(const gd::String& file,
+                   const gd::String& content) override {
+    files[file] = content;
+    writtenFiles.push_back(file);
+    return true;
+  }
+  gd::String ReadFile(const gd::String& file) override {
+    auto it = files.find(file);
+    return it != files.end() ? it->second : "";
+  }
+  bool IsFileCopyUpToDate(const gd::String& file,
+                          const gd::String& destination) override {
+    return FileExists(destination) && ReadFile(file) == ReadFile(destination);
+  }
+  gd::String GetTempDir() override { return "/tmp"; }
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override {
+    return std::vector<gd::String>();
+  }
+
+  void ClearRecordedFiles() {
+    writtenFiles.clear();
+    copiedFiles.clear();
+  }
+
+  gd::String runtimeDir;
+  std::map<gd::String, gd::String> files;
+  std::vector<gd::String> writtenFiles;
+  std::vector<gd::String> copiedFiles;
+};
+
+/**
+ * \brief An event counting how many times events of its kind are cloned.
+ */
+class CloneCountingEvent : public gd::StandardEvent {
+ public:
+  virtual CloneCountingEvent* Clone() const override {
+    clonesCount++;
+    return new CloneCountingEvent(*this);
+  }
+
+  static std::size_t clonesCount;
+};
+
+std::size_t CloneCountingEvent::clonesCount = 0;
+}  // namespace
+
+TEST_CASE("ExporterHelper", "[common]") {
+  SECTION("Incremental preview export") {
+    gdjs::JsPlatform platform(true);
+    gd::Project project;
+    project.AddPlatform(platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    gd::InitialInstance& instance =
+        layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MyObject");
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    fs.files["/gdjs/Runtime/index.html"] = "<!-- GDJS_CODE_FILES -->";
+    fs.files["/gdjs/Runtime/gd.js"] = "var gdjs = {};";
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    gdjs::PreviewExportOptions options(project, "/preview");
+    options.SetLayoutName("Scene").SetIncrementalExport(true);
+
+    auto hasWrittenFile = [&fs](const gd::String& file) {
+      return std::find(fs.writtenFiles.begin(), fs.writtenFiles.end(), file) !=
+             fs.writtenFiles.end();
+    };
+    auto hasCopiedFile = [&fs](const gd::String& file) {
+      return std::find(fs.copiedFiles.begin(), fs.copiedFiles.end(), file) !=
+             fs.copiedFiles.end();
+    };
+
+    // Without a manifest, everything is exported.
+    REQUIRE(helper.ExportProjectForPixiPreview(options));
+    REQUIRE(hasWrittenFile("/code/code0.js"));
+    REQUIRE(hasWrittenFile("/code/data.js"));
+    REQUIRE(hasWrittenFile("/preview/index.html"));
+    REQUIRE(hasCopiedFile("/preview/code0.js"));
+    REQUIRE(hasCopiedFile("/preview/data.js"));
+    REQUIRE(hasCopiedFile("/preview/gd.js"));
+    REQUIRE(fs.files["/preview/gd.js"] == "var gdjs = {};");
+    gd::String exportedData = fs.files["/preview/data.js"];
+
+    // Nothing changed: only the manifest is written (and emptied before).
+    fs.ClearRecordedFiles();
+    gdjs::ExporterHelper otherHelper(fs, "/gdjs", "/code");
+    REQUIRE(otherHelper.ExportProjectForPixiPreview(options));
+    REQUIRE(fs.writtenFiles.size() == 2);
+    REQUIRE(hasWrittenFile("/preview/gdjs-export-manifest.json"));
+    REQUIRE(fs.copiedFiles.empty());
+    REQUIRE(fs.files["/preview/data.js"] == exportedData);
+
+    // Only the project data changed.
+    fs.ClearRecordedFiles();
+    instance.SetX(42);
+    REQUIRE(otherHelper.ExportProjectForPixiPreview(options));
+    REQUIRE(hasWrittenFile("/code/data.js"));
+    REQUIRE(hasCopiedFile("/preview/data.js"));
+    REQUIRE(!hasWrittenFile("/code/code0.js"));
+    REQUIRE(!hasCopiedFile("/preview/code0.js"));
+    REQUIRE(!hasCopiedFile("/preview/gd.js"));
+    REQUIRE(fs.files["/preview/data.js"] != exportedData);
+
+    // Files removed from the export directory are exported again.
+    fs.ClearRecordedFiles();
+    fs.files.erase("/preview/code0.js");
+    REQUIRE(otherHelper.ExportProjectForPixiPreview(options));
+    REQUIRE(hasCopiedFile("/preview/code0.js"));
+    REQUIRE(!hasCopiedFile("/preview/data.js"));
+
+    // A non incremental export clears the export directory.
+    fs.ClearRecordedFiles();
+    options.SetIncrementalExport(false);
+    REQUIRE(otherHelper.ExportProjectForPixiPreview(options));
+    REQUIRE(hasWrittenFile("/code/code0.js"));
+    REQUIRE(hasCopiedFile("/preview/code0.js"));
+    REQUIRE(hasCopiedFile("/preview/gd.js"));
+  }
+
+  SECTION("Preview export doesn't copy the events of the project") {
+    gdjs::JsPlatform platform(true);
+    gd::Project project;
+    project.AddPlatform(platform);
+    CloneCountingEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    gd::Instruction action;
+    action.SetType("PlaySound");
+    action.SetParametersCount(5);
+    action.SetParameter(1, gd::Expression("\"sound.wav\""));
+    event.GetActions().Insert(action);
+    event.GetSubEvents().InsertEvent(event);
+    project.InsertNewLayout("Scene", 0).GetEvents().InsertEvent(event);
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    gdjs::PreviewExportOptions options(project, "/preview");
+    options.SetLayoutName("Scene").SetProjectDataOnlyExport(true);
+
+    CloneCountingEvent::clonesCount = 0;
+    REQUIRE(helper.ExportProjectForPixiPreview(options));
+    REQUIRE(CloneCountingEvent::clonesCount == 0);
+  }
+
+  SECTION("Split project data") {
+    gd::Project project;
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MyObject");
+    project.InsertNewLayout("Other scene", 1);
+    project.InsertNewExternalLayout("External layout", 0)
+        .GetInitialInstances()
+        .InsertNewInitialInstance();
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    gd::SerializerElement runtimeGameOptions;
+    REQUIRE(gdjs::ExporterHelper::ExportSplitProjectData(
+                fs, project, "/code/data.js", "/export", runtimeGameOptions) ==
+            "");
+
+    gd::SerializerElement layoutElement;
+    layout.SerializeTo(layoutElement);
+    REQUIRE(fs.files["/export/data/layout0.json"] ==
+            gd::Serializer::ToJSON(layoutElement));
+    REQUIRE(fs.files.count("/export/data/layout1.json") == 1);
+    REQUIRE(fs.files.count("/export/data/external-layout0.json") == 1);
+
+    // Only the names of the layouts are kept in the project data.
+    const gd::String& projectData = fs.files["/code/data.js"];
+    REQUIRE(projectData.find(
+                "{\"dataChunk\":\"data/layout0.json\",\"name\":\"Scene\"}") !=
+            gd::String::npos);
+    REQUIRE(projectData.find("{\"dataChunk\":\"data/external-layout0.json\","
+                             "\"name\":\"External layout\"}") !=
+            gd::String::npos);
+    REQUIRE(projectData.find("MyObject") == gd::String::npos);
+  }
+
+  SECTION("Bundle of includes") {
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    fs.files["/gdjs/Runtime/gd.js"] =
+        "var gdjs = {};\n//# sourceMappingURL=gd.js.map\n";
+    fs.files["/gdjs/Runtime/gd.js.map"] =
+        "{\"version\":3,\"file\":\"gd.js\",\"sourceRoot\":\"\",\"sources\":"
+        "[\"../src/gd.ts\"],\"names\":[],\"mappings\":\"AAAA\"}";
+    fs.files["/gdjs/Runtime/libs/lib.js"] = "var lib = 1;";
+    fs.files["/gdjs/Runtime/pixi-renderers/renderer.js"] =
+        "gdjs.Renderer = {};\n\ngdjs.Renderer.render = function() {};\n"
+        "//# sourceMappingURL=renderer.js.map";
+    fs.files["/gdjs/Runtime/pixi-renderers/renderer.js.map"] =
+        "{\"version\":3,\"file\":\"renderer.js\",\"sources\":"
+        "[\"../../src/renderer.ts\"],\"names\":[],\"mappings\":\";;AAAA\"}";
+    fs.files["/code/code0.js"] = "gdjs.SceneCode = {};\n";
+
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    REQUIRE(helper.ExportIncludesBundle({"gd.js",
+                                         "libs/lib.js",
+                                         "pixi-renderers/renderer.js",
+                                         "/code/code0.js"},
+                                        "/export",
+                                        "bundle.js"));
+    REQUIRE(fs.files["/export/bundle.js"] ==
+            "var gdjs = {};\n\nvar lib = 1;\ngdjs.Renderer = {};\n\n"
+            "gdjs.Renderer.render = function() {};\n"
+            "gdjs.SceneCode = {};\n"
+            "//# sourceMappingURL=bundle.js.map\n");
+
+    // Sources of files in subdirectories are relative to these directories.
+    gd::SerializerElement sourceMap =
+        gd::Serializer::FromJSON(fs.files["/export/bundle.js.map"]);
+    REQUIRE(sourceMap.GetIntAttribute("version") == 3);
+    REQUIRE(sourceMap.GetStringAttribute("file") == "bundle.js");
+    gd::SerializerElement& sections = sourceMap.GetChild("sections");
+    sections.ConsiderAsArray();
+    REQUIRE(sections.GetChildrenCount() == 2);
+    REQUIRE(sections.GetChild(0).GetChild("offset").GetIntAttribute("line") ==
+            0);
+    REQUIRE(sections.GetChild(0).GetChild("map").GetStringAttribute(
+                "sourceRoot") == "");
+    REQUIRE(sections.GetChild(1).GetChild("offset").GetIntAttribute("line") ==
+            3);
+    REQUIRE(sections.GetChild(1).GetChild("map").GetStringAttribute(
+                "sourceRoot") == "pixi-renderers/");
+    REQUIRE(sections.GetChild(1).GetChild("map").GetStringAttribute(
+                "mappings") == ";;AAAA");
+  }
+
+  SECTION("Layouts code chunks") {
+    gd::Project project;
+    project.InsertNewLayout("Scene", 0);
+    project.InsertNewLayout("Other scene", 1);
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    gd::InsertionOrderedSet<gd::String> includesFiles = {
+        "gd.js", "/code/code0.js", "/code/code1.js", "/code/data.js"};
+    gd::SerializerElement runtimeGameOptions;
+    gd::InsertionOrderedSet<gd::String> codeChunksFiles =
+        helper.ExtractLayoutsCodeChunks(
+            project, includesFiles, runtimeGameOptions);
+
+    REQUIRE(codeChunksFiles.size() == 2);
+    REQUIRE(codeChunksFiles[0] == "/code/code0.js");
+    REQUIRE(codeChunksFiles[1] == "/code/code1.js");
+    REQUIRE(includesFiles.size() == 2);
+    REQUIRE(includesFiles[0] == "gd.js");
+    REQUIRE(includesFiles[1] == "/code/data.js");
+    REQUIRE(gd::Serializer::ToJSON(runtimeGameOptions) ==
+            "{\"codeChunks\":{\"Scene\":\"code0.js\",\"Other "
+            "scene\":\"code1.js\"}}");
+  }
+
+  SECTION("Only used events tools") {
+    gdjs::JsPlatform platform(true);
+    gd::Project project;
+    project.AddPlatform(platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    gd::Instruction action;
+    action.SetType("PlaySound");
+    action.SetParametersCount(5);
+    action.SetParameter(1, gd::Expression("\"sound.wav\""));
+    action.SetParameter(2, gd::Expression("no"));
+    action.SetParameter(3, gd::Expression("100"));
+    action.SetParameter(4, gd::Expression("1"));
+    event.GetActions().Insert(action);
+    layout.GetEvents().InsertEvent(event);
+    gdjs::JsCodeEvent jsCodeEvent;
+    jsCodeEvent.SetType("BuiltinCommonInstructions::JsCode");
+    jsCodeEvent.SetInlineCode(
+        "gdjs.evtTools.window.setFullScreen(runtimeScene, true, true);");
+    layout.GetEvents().InsertEvent(jsCodeEvent);
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    auto exportIncludes = [&](bool onlyUsedEventsTools) {
+      gd::InsertionOrderedSet<gd::String> includesFiles;
+      helper.AddLibsInclude(/*pixiRenderers=*/true,
+                            /*includeWebsocketDebuggerClient=*/false,
+                            /*includeWindowMessageDebuggerClient=*/false,
+                            onlyUsedEventsTools,
+                            "light",
+                            includesFiles);
+      REQUIRE(helper.ExportEventsCode(project, "/code", includesFiles, false));
+      return std::set<gd::String>(includesFiles.begin(), includesFiles.end());
+    };
+
+    std::set<gd::String> includesFiles = exportIncludes(true);
+    REQUIRE(includesFiles.count("events-tools/commontools.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/objecttools.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/soundtools.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/windowtools.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/networktools.js") == 0);
+    REQUIRE(includesFiles.count("events-tools/storagetools.js") == 0);
+    REQUIRE(includesFiles.count("runtimegame.js") == 1);
+    REQUIRE(includesFiles.count("/code/code0.js") == 1);
+
+    std::set<gd::String> allIncludesFiles = exportIncludes(false);
+    for (const gd::String& includeFile :
+         gdjs::JsPlatform::GetEventsToolsIncludeFiles())
+      REQUIRE(allIncludesFiles.count(includeFile) == 1);
+    REQUIRE(allIncludesFiles.size() == includesFiles.size() + 7);
+  }
+
+  SECTION("Only used events tools with events functions extensions") {
+    // Like the extensions generated by the IDE, the code of the functions is
+    // in files outside of the runtime. The extension is declared in the
+    // platform used by the code generation.
+    gdjs::JsPlatform& platform = gdjs::JsPlatform::Get();
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation("MyEventsExtension", "", "", "", "");
+    extension->AddAction("CallNetwork", "", "", "", "", "", "")
+        .SetFunctionName("gdjs.evtsExt__MyEventsExtension__CallNetwork.func")
+        .SetIncludeFile("/extensions/CallNetwork.js");
+    extension->AddAction("CallUnknown", "", "", "", "", "", "")
+        .SetFunctionName("gdjs.evtsExt__MyEventsExtension__CallUnknown.func")
+        .SetIncludeFile("/extensions/CallUnknown.js");
+    platform.AddExtension(extension);
+
+    gd::Project project;
+    project.AddPlatform(platform);
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    gd::Instruction action;
+    action.SetType("MyEventsExtension::CallNetwork");
+    event.GetActions().Insert(action);
+    project.InsertNewLayout("Scene", 0).GetEvents().InsertEvent(event);
+    project.InsertNewLayout("Other scene", 1).GetEvents().InsertEvent(event);
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    fs.files["/extensions/CallNetwork.js"] =
+        "gdjs.evtTools.network.sendAsyncRequest(url, body, method);";
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    auto exportIncludes = [&]() {
+      gd::InsertionOrderedSet<gd::String> includesFiles;
+      helper.AddLibsInclude(/*pixiRenderers=*/true,
+                            /*includeWebsocketDebuggerClient=*/false,
+                            /*includeWindowMessageDebuggerClient=*/false,
+                            /*onlyUsedEventsTools=*/true,
+                            "light",
+                            includesFiles);
+      REQUIRE(helper.ExportEventsCode(project, "/code", includesFiles, false));
+      return std::set<gd::String>(includesFiles.begin(), includesFiles.end());
+    };
+
+    std::set<gd::String> includesFiles = exportIncludes();
+    REQUIRE(includesFiles.count("/extensions/CallNetwork.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/networktools.js") == 1);
+    REQUIRE(includesFiles.count("events-tools/soundtools.js") == 0);
+
+    // Events tools called by code that can't be read are all included.
+    gd::Instruction otherAction;
+    otherAction.SetType("MyEventsExtension::CallUnknown");
+    event.GetActions().Insert(otherAction);
+    project.GetLayout("Other scene").GetEvents().InsertEvent(event);
+    includesFiles = exportIncludes();
+    for (const gd::String& includeFile :
+         gdjs::JsPlatform::GetEventsToolsIncludeFiles())
+      REQUIRE(includesFiles.count(includeFile) == 1);
+
+    platform.RemoveExtension("MyEventsExtension");
+  }
+
+  SECTION("Events profiling table") {
+    gdjs::JsPlatform platform(true);
+    gd::Project project;
+    project.AddPlatform(platform);
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    event.GetSubEvents().InsertEvent(event);
+    project.InsertNewLayout("Scene", 0).GetEvents().InsertEvent(event);
+    project.InsertNewLayout("Other scene", 1);
+
+    InMemoryFileSystem fs("/gdjs/Runtime");
+    gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+    gd::InsertionOrderedSet<gd::String> includesFiles;
+    REQUIRE(helper.ExportEventsCode(
+        project, "/code", includesFiles, false, false, "/export/events.json"));
+    REQUIRE(includesFiles.count("/export/events.json") == 0);
+    REQUIRE(fs.files["/export/events.json"] ==
+            "{\"layouts\":["
+            "{\"codeFile\":\"code0.js\",\"name\":\"Scene\",\"events\":["
+            "{\"id\":0,\"type\":\"BuiltinCommonInstructions::Standard\","
+            "\"path\":[0]},"
+            "{\"id\":1,\"type\":\"BuiltinCommonInstructions::Standard\","
+            "\"path\":[0,0]}]},"
+            "{\"codeFile\":\"code1.js\",\"name\":\"Other scene\","
+            "\"events\":[]}]}");
+    REQUIRE(fs.files["/code/code0.js"].find("\"event:0\"") !=
+            gd::String::npos);
+  }
+}
+
+TEST_CASE("Exporter", "[common]") {
+  gdjs::JsPlatform platform(true);
+  gd::Project project;
+  project.AddPlatform(platform);
+  project.InsertNewLayout("Scene", 0);
+  project.InsertNewLayout("Other scene", 1);
+
+  InMemoryFileSystem fs("/gdjs/Runtime");
+  fs.files["/gdjs/Runtime/index.html"] =
+      "<!-- GDJS_CODE_FILES -->"
+      "new gdjs.RuntimeGame(gdjs.projectData, {}/*GDJS_ADDITIONAL_SPEC*/);";
+  gdjs::Exporter exporter(fs, "/gdjs");
+  exporter.SetCodeOutputDirectory("/code");
+
+  SECTION("Whole game") {
+    std::map<gd::String, bool> exportOptions;
+    REQUIRE(exporter.ExportWholePixiProject(project, "/export", exportOptions));
+
+    const gd::String& indexFile = fs.files["/export/index.html"];
+    REQUIRE(indexFile.find("new gdjs.RuntimeGame(gdjs.projectData, {});") !=
+            gd::String::npos);
+    REQUIRE(indexFile.find("<script src=\"code0.js\"") != gd::String::npos);
+    REQUIRE(indexFile.find("<script src=\"code1.js\"") != gd::String::npos);
+  }
+
+  SECTION("Whole game with lazily loaded layouts code") {
+    std::map<gd::String, bool> exportOptions;
+    exportOptions["lazilyLoadedLayoutsCode"] = true;
+    REQUIRE(exporter.ExportWholePixiProject(project, "/export", exportOptions));
+
+    // The game is given the options declaring the code chunks, which are
+    // exported but not included as scripts.
+    const gd::String& indexFile = fs.files["/export/index.html"];
+    REQUIRE(indexFile.find("new gdjs.RuntimeGame(gdjs.projectData, "
+                           "gdjs.runtimeGameOptions);") != gd::String::npos);
+    REQUIRE(indexFile.find("<script src=\"data.js\"") != gd::String::npos);
+    REQUIRE(indexFile.find("code0.js") == gd::String::npos);
+    REQUIRE(indexFile.find("code1.js") == gd::String::npos);
+    REQUIRE(fs.files["/export/data.js"].find(
+                "gdjs.runtimeGameOptions = "
+                "{\"codeChunks\":{\"Scene\":\"code0.js\",\"Other "
+                "scene\":\"code1.js\"}};") != gd::String::npos);
+    REQUIRE(fs.files["/export/code0.js"].find("gdjs.SceneCode") !=
+            gd::String::npos);
+    REQUIRE(fs.files["/export/code1.js"].find("gdjs.Other_32sceneCode") !=
+            gd::String::npos);
+  }
+}
+
+TEST_CASE("ExporterHelper - Benchmarks", "[common]") {
+  gd::Project project;
+  for (std::size_t i = 0; i < 500; ++i)
+    project.InsertNewLayout("Scene " + gd::String::From(i), i);
+
+  std::vector<gd::String> extensionsIncludeFiles;
+  for (std::size_t i = 0; i < 100; ++i) {
+    gd::String extensionName = "Extension" + gd::String::From(i);
+    extensionsIncludeFiles.push_back("Extensions/" + extensionName +
+                                     "/runtimeobject.js");
+    extensionsIncludeFiles.push_back("Extensions/" + extensionName +
+                                     "/tools.js");
+  }
+
+  InMemoryFileSystem fs("/gdjs/Runtime");
+  gdjs::ExporterHelper helper(fs, "/gdjs", "/code");
+  DoBenchmark("Collect includes of 500 scenes and 100 extensions", 3, [&]() {
+    gd::InsertionOrderedSet<gd::String> includesFiles;
+    helper.AddLibsInclude(/*pixiRenderers=*/true,
+                          /*includeWebsocketDebuggerClient=*/false,
+                          /*includeWindowMessageDebuggerClient=*/false,
+                          /*onlyUsedEventsTools=*/false,
+                          "light",
+                          includesFiles);
+    std::size_t libsIncludesCount = includesFiles.size();
+
+    // Like ExportEventsCode, add the includes used by each scene, then its
+    // code file.
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+      includesFiles.insert(extensionsIncludeFiles.begin(),
+                           extensionsIncludeFiles.end());
+      includesFiles.insert("/code/code" + gd::String::From(i) + ".js");
+    }
+    REQUIRE(includesFiles.size() == libsIncludesCount + 200 + 500);
+
+    gd::SerializerElement runtimeGameOptions;
+    REQUIRE(helper
+                .ExtractLayoutsCodeChunks(
+                    project, includesFiles, runtimeGameOptions)
+                .size() == 500);
+    REQUIRE(includesFiles.size() == libsIncludesCount + 200);
+
+    gd::String indexFile = "<!-- GDJS_CODE_FILES -->";
+    helper.CompleteIndexFile(indexFile, "/export", includesFiles, 0, "");
+  });
+}
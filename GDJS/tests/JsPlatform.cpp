@@ -0,0 +1,229 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDJS/Extensions/JsPlatform.h"
+
+#include <algorithm>
+#include <map>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include <vector>
+
+#include "BenchmarkTools.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Tools/ParallelFor.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Return the size of the instructions metadata (and of their
+ * parameters) stored in the maps of the extensions, which is what code
+ * generation goes through.
+ */
+std::size_t GetInstructionsMetadataSize(
+    const std::map<gd::String, gd::InstructionMetadata>& instructions,
+    std::size_t& instructionsCount) {
+  std::size_t size = 0;
+  for (const auto& it : instructions) {
+    size += sizeof(it);
+    size +=
+        it.second.GetParameters().capacity() * sizeof(gd::ParameterMetadata);
+  }
+  instructionsCount += instructions.size();
+
+  return size;
+}
+
+std::size_t GetInstructionsMetadataSize(const gd::Platform& platform,
+                                        std::size_t& instructionsCount) {
+  std::size_t size = 0;
+  for (const auto& extension : platform.GetAllPlatformExtensions()) {
+    size += GetInstructionsMetadataSize(extension->GetAllActions(),
+                                        instructionsCount);
+    size += GetInstructionsMetadataSize(extension->GetAllConditions(),
+                                        instructionsCount);
+    for (const auto& objectType : extension->GetExtensionObjectsTypes()) {
+      size += GetInstructionsMetadataSize(
+          extension->GetAllActionsForObject(objectType), instructionsCount);
+      size += GetInstructionsMetadataSize(
+          extension->GetAllConditionsForObject(objectType), instructionsCount);
+    }
+    for (const auto& behaviorType : extension->GetBehaviorsTypes()) {
+      size += GetInstructionsMetadataSize(
+          extension->GetAllActionsForBehavior(behaviorType), instructionsCount);
+      size += GetInstructionsMetadataSize(
+          extension->GetAllConditionsForBehavior(behaviorType),
+          instructionsCount);
+    }
+  }
+
+  return size;
+}
+}  // namespace
+
+TEST_CASE("JsPlatform", "[common]") {
+  SECTION("Lazy declaration of extensions") {
+    gdjs::JsPlatform platform;
+    gdjs::JsPlatform lazyPlatform(true);
+    REQUIRE(platform.GetLazyExtensionsCount() == 0);
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 18);
+    REQUIRE(lazyPlatform.IsExtensionLoaded("BuiltinMouse"));
+    REQUIRE(lazyPlatform.IsExtensionLoaded("BuiltinExternalLayouts"));
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 18);
+
+    // Only the extension with the namespace of the type is declared.
+    const auto& onceMetadata = gd::MetadataProvider::GetConditionMetadata(
+        lazyPlatform, "BuiltinCommonInstructions::Once");
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(onceMetadata));
+    REQUIRE(onceMetadata.GetFullName() ==
+            gd::MetadataProvider::GetConditionMetadata(
+                platform, "BuiltinCommonInstructions::Once")
+                .GetFullName());
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 17);
+
+    // Types without namespace declare the extensions without namespace until
+    // one provides the type.
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetExpressionMetadata(lazyPlatform, "MouseX")));
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 12);
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetExpressionMetadata(lazyPlatform, "SourisX")));
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 12);
+
+    // Unknown types declare all the extensions without namespace.
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetExpressionMetadata(lazyPlatform,
+                                                    "UnknownExpression")));
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 1);
+
+    REQUIRE(lazyPlatform.GetExtension("BuiltinExternalLayouts") != nullptr);
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 0);
+    REQUIRE(lazyPlatform.GetAllPlatformExtensions().size() ==
+            platform.GetAllPlatformExtensions().size());
+  }
+
+  SECTION("Objects creation and extensions removal") {
+    gdjs::JsPlatform lazyPlatform(true);
+    auto object = lazyPlatform.CreateObject("Sprite", "MyObject");
+    REQUIRE(object != nullptr);
+    REQUIRE(object->GetType() == "Sprite");
+    REQUIRE(gd::MetadataProvider::GetObjectMetadata(lazyPlatform, "Sprite")
+                .GetName() == "Sprite");
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 16);
+
+    lazyPlatform.RemoveExtension("BuiltinExternalLayouts");
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 15);
+    REQUIRE(!lazyPlatform.IsExtensionLoaded("BuiltinExternalLayouts"));
+  }
+
+  SECTION("Same metadata as when extensions are declared at once") {
+    gdjs::JsPlatform platform;
+    gdjs::JsPlatform lazyPlatform(true);
+    std::size_t checkedCount = 0;
+    for (const auto& extension : platform.GetAllPlatformExtensions()) {
+      for (const auto& it : extension->GetAllActions()) {
+        REQUIRE(gd::MetadataProvider::GetActionMetadata(lazyPlatform, it.first)
+                    .GetFullName() == it.second.GetFullName());
+        checkedCount++;
+      }
+      for (const auto& it : extension->GetAllConditions()) {
+        REQUIRE(
+            gd::MetadataProvider::GetConditionMetadata(lazyPlatform, it.first)
+                .GetFullName() == it.second.GetFullName());
+        checkedCount++;
+      }
+      for (const auto& it : extension->GetAllExpressions()) {
+        REQUIRE(
+            gd::MetadataProvider::GetExpressionMetadata(lazyPlatform, it.first)
+                .GetFullName() == it.second.GetFullName());
+        checkedCount++;
+      }
+    }
+    REQUIRE(checkedCount > 100);
+  }
+
+  SECTION("Concurrent declaration of extensions") {
+    gdjs::JsPlatform platform;
+    gdjs::JsPlatform lazyPlatform(true);
+    const auto& extensions = platform.GetAllPlatformExtensions();
+    std::vector<int> found(extensions.size(), 0);
+    gd::ParallelFor::Run(extensions.size(), [&](std::size_t i) {
+      found[i] = lazyPlatform.GetExtension(extensions[i]->GetName()) != nullptr;
+    });
+
+    REQUIRE(std::count(found.begin(), found.end(), 1) == extensions.size());
+    REQUIRE(lazyPlatform.GetLazyExtensionsCount() == 0);
+    REQUIRE(lazyPlatform.GetAllPlatformExtensions().size() ==
+            extensions.size());
+  }
+}
+
+TEST_CASE("JsPlatform - Memory footprint", "[common]") {
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  std::size_t allocatedBytesBefore = mallinfo2().uordblks;
+#endif
+  gdjs::JsPlatform platform;
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  std::cout << "Memory allocated by JsPlatform: "
+            << mallinfo2().uordblks - allocatedBytesBefore << " bytes."
+            << std::endl;
+#endif
+
+  std::size_t instructionsCount = 0;
+  std::size_t instructionsSize =
+      GetInstructionsMetadataSize(platform, instructionsCount);
+  REQUIRE(instructionsCount > 0);
+  std::cout << "Instructions metadata of JsPlatform: " << instructionsCount
+            << " instructions stored in " << instructionsSize << " bytes ("
+            << sizeof(gd::InstructionMetadata) << " bytes per instruction, "
+            << sizeof(gd::ParameterMetadata) << " bytes per parameter)."
+            << std::endl;
+}
+
+TEST_CASE("JsPlatform - Benchmarks", "[common]") {
+  DoBenchmark("Create JsPlatform", 5, [&]() {
+    gdjs::JsPlatform platform;
+    REQUIRE(platform.GetAllPlatformExtensions().size() == 18);
+  });
+  DoBenchmark("Create JsPlatform with lazily declared extensions", 5, [&]() {
+    gdjs::JsPlatform platform(true);
+    REQUIRE(platform.GetLazyExtensionsCount() == 18);
+  });
+  DoBenchmark(
+      "Create JsPlatform with lazily declared extensions and get an action",
+      5,
+      [&]() {
+        gdjs::JsPlatform platform(true);
+        REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+            gd::MetadataProvider::GetActionMetadata(
+                platform,
+                "BuiltinExternalLayouts::CreateObjectsFromExternalLayout")));
+        REQUIRE(platform.GetLazyExtensionsCount() == 17);
+      });
+
+  gdjs::JsPlatform platform;
+  DoBenchmark("Get 10k instructions and expressions metadata", 5, [&]() {
+    std::size_t foundCount = 0;
+    for (std::size_t i = 0; i < 2000; ++i) {
+      foundCount += !gd::MetadataProvider::IsBadInstructionMetadata(
+          gd::MetadataProvider::GetActionMetadata(platform, "Opacity"));
+      foundCount += !gd::MetadataProvider::IsBadInstructionMetadata(
+          gd::MetadataProvider::GetConditionMetadata(platform, "PosX"));
+      foundCount += !gd::MetadataProvider::IsBadExpressionMetadata(
+          gd::MetadataProvider::GetObjectExpressionMetadata(
+              platform, "Sprite", "X"));
+      foundCount += !gd::MetadataProvider::IsBadExpressionMetadata(
+          gd::MetadataProvider::GetExpressionMetadata(platform, "MouseX"));
+      foundCount +=
+          gd::MetadataProvider::GetObjectMetadata(platform, "Sprite")
+              .GetName() == "Sprite";
+    }
+    REQUIRE(foundCount == 10000);
+  });
+}
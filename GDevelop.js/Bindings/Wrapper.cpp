@@ -27,6 +27,7 @@
 #include <GDCore/IDE/Events/EventsParametersLister.h>
 #include <GDCore/IDE/Events/EventsRefactorer.h>
 #include <GDCore/IDE/Events/EventsRemover.h>
+#include <GDCore/IDE/Events/EventsSearchIndex.h>
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
 #include <GDCore/IDE/Events/ExpressionValidator.h>
@@ -61,7 +62,9 @@
 #include <GDCore/Project/Variable.h>
 #include <GDCore/Project/VariablesContainer.h>
 #include <GDCore/Serialization/Serializer.h>
+#include <GDCore/Serialization/SerializerBinaryBuffer.h>
 #include <GDCore/Serialization/SerializerElement.h>
+#include <GDCore/Tools/FlatArrays.h>
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h>
@@ -255,6 +258,33 @@ class AbstractFileSystemJS : public AbstractFileSystem {
         destination.c_str());
   }
 
+  // Optional: files are always copied if not implemented.
+  virtual bool IsFileCopyUpToDate(const gd::String &file,
+                                  const gd::String &destination) {
+    return (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('isFileCopyUpToDate')) return false;
+          return self.isFileCopyUpToDate(UTF8ToString($1), UTF8ToString($2));
+        },
+        (int)this,
+        file.c_str(),
+        destination.c_str());
+  }
+
+  // Optional: files are copied if not implemented.
+  virtual bool LinkFile(const gd::String &file, const gd::String &destination) {
+    return (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('linkFile')) return false;
+          return self.linkFile(UTF8ToString($1), UTF8ToString($2));
+        },
+        (int)this,
+        file.c_str(),
+        destination.c_str());
+  }
+
   virtual bool ClearDir(const gd::String &directory) {
     return (bool)EM_ASM_INT(
         {
@@ -408,6 +438,18 @@ typedef std::vector<gd::ExpressionCompletionDescription>
 typedef std::map<gd::String, std::map<gd::String, gd::PropertyDescriptor>>
     MapExtensionProperties;
 typedef gd::Variable::Type Variable_Type;
+typedef gd::SerializerValue::Type SerializerValue_Type;
+typedef gd::Serializer::BinaryFormat Serializer_BinaryFormat;
+typedef gd::InitialInstancesContainer::InstanceDouble
+    InitialInstancesContainer_InstanceDouble;
+typedef gd::InitialInstancesContainer::InstanceInteger
+    InitialInstancesContainer_InstanceInteger;
+typedef gd::InitialInstancesContainer::InstanceFlag
+    InitialInstancesContainer_InstanceFlag;
+typedef gd::VariablesContainer::VariableDouble
+    VariablesContainer_VariableDouble;
+typedef gd::VariablesContainer::VariableInteger
+    VariablesContainer_VariableInteger;
 typedef std::map<gd::String, gd::SerializerValue> MapStringSerializerValue;
 typedef std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement>>>
     VectorPairStringSharedPtrSerializerElement;
@@ -434,7 +476,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define WRAPPED_set(a, b) at(a) = b
 #define WRAPPED_GetString(i) at(i).first
 #define WRAPPED_GetComment() com1
-#define WRAPPED_SetComment(str) com1 = str
+#define WRAPPED_SetComment(str) SetComment(str)
 #define WRAPPED_GetTextFormatting(i) at(i).second
 #define WRAPPED_GetSharedPtrSerializerElement(i) at(i).second
 #define WRAPPED_GetName() first
@@ -159,8 +159,28 @@ var adaptNamingConventions = function (gd) {
     return arr;
   };
 
-  // Add gd.Serializer.fromJSObject which is much faster than manually parsing
-  // JSON with gd.Serializer.fromJSON.
+  // Typed arrays viewing the memory of gd.FlatArrays, to read or write all the
+  // values without crossing the boundary for each of them. Views must not be
+  // kept: they are invalidated when the arrays are resized or when the memory
+  // grows. The data is returned as a VoidPtr, its address is read with
+  // gd.getPointer.
+  gd.FlatArrays.prototype.getDoublesArray = function () {
+    return new Float64Array(
+      HEAPF64.buffer,
+      gd.getPointer(this.getDoublesData()),
+      this.getDoublesCount()
+    );
+  };
+  gd.FlatArrays.prototype.getIntegersArray = function () {
+    return new Int32Array(
+      HEAP32.buffer,
+      gd.getPointer(this.getIntegersData()),
+      this.getIntegersCount()
+    );
+  };
+
+  // Add gd.Serializer.fromJSObject and gd.Serializer.toJSObject, which make a
+  // call to libGD.js for each value.
   const elementFromJSObject = function (object, element) {
     if (typeof object === 'number') {
       element.setDoubleValue(object);
@@ -192,12 +212,15 @@ var adaptNamingConventions = function (gd) {
   };
 
   const valueToJSObject = function (serializerValue) {
-    // TODO: use getRaw to avoid conversions
-    if (serializerValue.isBoolean()) return serializerValue.getBool();
-    else if (serializerValue.isDouble()) return serializerValue.getDouble();
-    else if (serializerValue.isInt()) return serializerValue.getInt();
-    else if (serializerValue.isString()) {
-      return serializerValue.getRawString();
+    switch (serializerValue.getType()) {
+      case gd.SerializerValue.Boolean:
+        return serializerValue.getRawBool();
+      case gd.SerializerValue.Double:
+        return serializerValue.getRawDouble();
+      case gd.SerializerValue.Int:
+        return serializerValue.getRawInt();
+      case gd.SerializerValue.String:
+        return serializerValue.getRawString();
     }
 
     return null;
@@ -231,7 +254,7 @@ var adaptNamingConventions = function (gd) {
       for (let i = 0; i < attributeNames.size(); ++i) {
         const name = attributeNames.at(i);
         const serializerValue = attributes.get(name);
-        object[name] = valueToJSObject(element.getValue());
+        object[name] = valueToJSObject(serializerValue);
       }
 
       const children = element.getAllChildren();
@@ -251,6 +274,314 @@ var adaptNamingConventions = function (gd) {
     return null;
   };
 
+  // Add gd.Serializer.fromJSObjectBinary and gd.Serializer.toJSObjectBinary,
+  // which move the whole tree of elements in a single call, using the binary
+  // format of gd::Serializer::ToBinary (see Serializer.cpp) stored in a
+  // gd.SerializerBinaryBuffer. They give the same results as
+  // gd.Serializer.fromJSObject/toJSObject, which stay the default until they
+  // are validated in the editor.
+  let binaryUndefinedValueType;
+  let binaryIntegralDoubleValueType;
+  let binaryValueTypeMask;
+  let binaryIsArrayFlag;
+  let binaryHasAttributesFlag;
+  let binaryHasChildrenFlag;
+  let binaryMaxSharedStringSize;
+
+  // The constants of the format come from gd::Serializer::BinaryFormat, which
+  // can only be read once the runtime is initialized.
+  const readBinaryFormat = function () {
+    if (binaryUndefinedValueType !== undefined) return;
+
+    binaryUndefinedValueType = gd.Serializer.BinaryUndefinedValueType;
+    binaryIntegralDoubleValueType = gd.Serializer.BinaryIntegralDoubleValueType;
+    binaryValueTypeMask = gd.Serializer.BinaryValueTypeMask;
+    binaryIsArrayFlag = gd.Serializer.BinaryIsArrayFlag;
+    binaryHasAttributesFlag = gd.Serializer.BinaryHasAttributesFlag;
+    binaryHasChildrenFlag = gd.Serializer.BinaryHasChildrenFlag;
+    binaryMaxSharedStringSize = gd.Serializer.BinaryMaxSharedStringSize;
+  };
+  const textEncoder = new TextEncoder();
+  const textDecoder = new TextDecoder();
+
+  const BinaryEncoder = function () {
+    this.bytes = new Uint8Array(4096);
+    this.dataView = new DataView(this.bytes.buffer);
+    this.size = 0;
+    this.sharedStrings = new Map();
+  };
+
+  BinaryEncoder.prototype.reserve = function (bytesCount) {
+    if (this.size + bytesCount <= this.bytes.length) return;
+
+    let capacity = this.bytes.length * 2;
+    while (capacity < this.size + bytesCount) capacity *= 2;
+    const bytes = new Uint8Array(capacity);
+    bytes.set(this.bytes.subarray(0, this.size));
+    this.bytes = bytes;
+    this.dataView = new DataView(bytes.buffer);
+  };
+
+  BinaryEncoder.prototype.writeByte = function (byte) {
+    this.reserve(1);
+    this.bytes[this.size++] = byte;
+  };
+
+  BinaryEncoder.prototype.writeSize = function (size) {
+    // Sizes can be larger than 32 bits: avoid bitwise operators.
+    this.reserve(10);
+    while (size >= 0x80) {
+      this.bytes[this.size++] = (size % 0x80) | 0x80;
+      size = Math.floor(size / 0x80);
+    }
+    this.bytes[this.size++] = size;
+  };
+
+  BinaryEncoder.prototype.writeString = function (str) {
+    const sharedStringIndex = this.sharedStrings.get(str);
+    if (sharedStringIndex !== undefined) {
+      this.writeSize(sharedStringIndex * 2 + 1);
+      return;
+    }
+
+    let isAscii = true;
+    for (let i = 0; i < str.length && isAscii; ++i)
+      isAscii = str.charCodeAt(i) < 0x80;
+
+    let bytesCount = str.length;
+    if (isAscii) {
+      this.writeSize(bytesCount * 2);
+      this.reserve(bytesCount);
+      for (let i = 0; i < bytesCount; ++i)
+        this.bytes[this.size++] = str.charCodeAt(i);
+    } else {
+      const utf8Bytes = textEncoder.encode(str);
+      bytesCount = utf8Bytes.length;
+      this.writeSize(bytesCount * 2);
+      this.reserve(bytesCount);
+      this.bytes.set(utf8Bytes, this.size);
+      this.size += bytesCount;
+    }
+
+    if (bytesCount <= binaryMaxSharedStringSize)
+      this.sharedStrings.set(str, this.sharedStrings.size);
+  };
+
+  BinaryEncoder.prototype.writeValue = function (value) {
+    if (typeof value === 'number') {
+      if (
+        Number.isInteger(value) &&
+        value >= -0x80000000 &&
+        value <= 0x7fffffff &&
+        !Object.is(value, -0)
+      ) {
+        this.writeByte(binaryIntegralDoubleValueType);
+        this.writeSize(value >= 0 ? value * 2 : -value * 2 - 1);
+      } else {
+        this.writeByte(gd.SerializerValue.Double);
+        this.reserve(8);
+        this.dataView.setFloat64(this.size, value, true);
+        this.size += 8;
+      }
+    } else if (typeof value === 'string') {
+      this.writeByte(gd.SerializerValue.String);
+      this.writeString(value);
+    } else {
+      this.writeByte(gd.SerializerValue.Boolean);
+      this.writeByte(value ? 1 : 0);
+    }
+  };
+
+  // Write an element like elementFromJSObject would create it.
+  BinaryEncoder.prototype.writeElement = function (object) {
+    const type = typeof object;
+    if (type === 'number' || type === 'string' || type === 'boolean') {
+      this.writeValue(object);
+    } else if (Array.isArray(object)) {
+      this.writeByte(
+        binaryUndefinedValueType |
+          binaryIsArrayFlag |
+          (object.length ? binaryHasChildrenFlag : 0)
+      );
+      this.writeString('');
+      if (object.length) {
+        this.writeSize(object.length);
+        for (let i = 0; i < object.length; ++i) this.writeElement(object[i]);
+      }
+    } else if (object && type === 'object') {
+      const childNames = Object.keys(object);
+      this.writeByte(
+        binaryUndefinedValueType |
+          (childNames.length ? binaryHasChildrenFlag : 0)
+      );
+      if (childNames.length) {
+        this.writeSize(childNames.length);
+        for (let i = 0; i < childNames.length; ++i) {
+          this.writeString(childNames[i]);
+          this.writeElement(object[childNames[i]]);
+        }
+      }
+    } else {
+      this.writeByte(binaryUndefinedValueType);
+    }
+  };
+
+  const BinaryDecoder = function (bytes) {
+    this.bytes = bytes;
+    this.dataView = new DataView(
+      bytes.buffer,
+      bytes.byteOffset,
+      bytes.byteLength
+    );
+    this.position = 0;
+    this.sharedStrings = [];
+  };
+
+  BinaryDecoder.prototype.readByte = function () {
+    if (this.position >= this.bytes.length)
+      throw new Error('Invalid binary serialized element.');
+
+    return this.bytes[this.position++];
+  };
+
+  BinaryDecoder.prototype.readSize = function () {
+    let size = 0;
+    let multiplier = 1;
+    for (;;) {
+      const byte = this.readByte();
+      size += (byte & 0x7f) * multiplier;
+      if (!(byte & 0x80)) return size;
+      multiplier *= 0x80;
+    }
+  };
+
+  BinaryDecoder.prototype.readString = function () {
+    const header = this.readSize();
+    if (header % 2) return this.sharedStrings[(header - 1) / 2];
+
+    const bytesCount = header / 2;
+    const start = this.position;
+    const end = start + bytesCount;
+    if (end > this.bytes.length)
+      throw new Error('Invalid binary serialized element.');
+
+    let str = '';
+    let isAscii = true;
+    for (let i = start; i < end && isAscii; ++i) isAscii = this.bytes[i] < 0x80;
+    if (isAscii && bytesCount <= binaryMaxSharedStringSize) {
+      for (let i = start; i < end; ++i)
+        str += String.fromCharCode(this.bytes[i]);
+    } else {
+      str = textDecoder.decode(this.bytes.subarray(start, end));
+    }
+    this.position = end;
+
+    if (bytesCount <= binaryMaxSharedStringSize) this.sharedStrings.push(str);
+    return str;
+  };
+
+  BinaryDecoder.prototype.readValue = function (type) {
+    switch (type) {
+      case gd.SerializerValue.Boolean:
+        return this.readByte() !== 0;
+      case gd.SerializerValue.Int:
+      case binaryIntegralDoubleValueType: {
+        const zigZag = this.readSize();
+        return zigZag % 2 ? -(zigZag + 1) / 2 : zigZag / 2;
+      }
+      case gd.SerializerValue.Double: {
+        if (this.position + 8 > this.bytes.length)
+          throw new Error('Invalid binary serialized element.');
+
+        const value = this.dataView.getFloat64(this.position, true);
+        this.position += 8;
+        return value;
+      }
+      case gd.SerializerValue.String:
+        return this.readString();
+      case gd.SerializerValue.Unknown:
+        // Like valueToJSObject, values of unknown type are not converted.
+        this.readString();
+        return null;
+    }
+
+    throw new Error('Invalid binary serialized element.');
+  };
+
+  // Read an element like gd.Serializer.toJSObject would convert it.
+  BinaryDecoder.prototype.readElement = function () {
+    const header = this.readByte();
+    const valueType = header & binaryValueTypeMask;
+    const value =
+      valueType !== binaryUndefinedValueType
+        ? this.readValue(valueType)
+        : undefined;
+
+    const isArray = !!(header & binaryIsArrayFlag);
+    if (isArray) this.readString();
+    const result = isArray ? [] : {};
+
+    if (header & binaryHasAttributesFlag) {
+      const attributesCount = this.readSize();
+      for (let i = 0; i < attributesCount; ++i) {
+        const name = this.readString();
+        const attributeValue = this.readValue(this.readByte());
+        if (!isArray) result[name] = attributeValue;
+      }
+    }
+
+    if (header & binaryHasChildrenFlag) {
+      const childrenCount = this.readSize();
+      for (let i = 0; i < childrenCount; ++i) {
+        if (isArray) {
+          result.push(this.readElement());
+        } else {
+          const name = this.readString();
+          result[name] = this.readElement();
+        }
+      }
+    }
+
+    // Children must be read even if the element has a value.
+    return value !== undefined ? value : result;
+  };
+
+  gd.Serializer.fromJSObjectBinary = function (object) {
+    readBinaryFormat();
+    const encoder = new BinaryEncoder();
+    encoder.writeElement(object);
+
+    const buffer = new gd.SerializerBinaryBuffer();
+    buffer.resize(encoder.size);
+    HEAPU8.set(
+      encoder.bytes.subarray(0, encoder.size),
+      gd.getPointer(buffer.getData())
+    );
+
+    const element = new gd.SerializerElement();
+    buffer.readElement(element);
+    buffer.delete();
+
+    return element;
+  };
+
+  gd.Serializer.toJSObjectBinary = function (element) {
+    readBinaryFormat();
+    const buffer = new gd.SerializerBinaryBuffer();
+    buffer.writeElement(element);
+
+    // The memory is only viewed, after the element was written as the heap
+    // may have grown.
+    const data = gd.getPointer(buffer.getData());
+    const decoder = new BinaryDecoder(
+      HEAPU8.subarray(data, data + buffer.getSize())
+    );
+    const object = decoder.readElement();
+    buffer.delete();
+
+    return object;
+  };
+
   //Preserve backward compatibility with some alias for methods:
   gd.VectorString.prototype.get = gd.VectorString.prototype.at;
   gd.VectorPlatformExtension.prototype.get =
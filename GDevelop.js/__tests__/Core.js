@@ -520,6 +520,122 @@ describe('libGD.js', function () {
       };
       container.iterateOverInstancesWithZOrdering(functor, 'YetAnotherLayer');
     });
+    it('can export and import instances with flat arrays', function () {
+      const arrays = new gd.FlatArrays();
+      container.exportToFlatArrays(arrays);
+      expect(arrays.getElementsCount()).toBe(3);
+
+      const doubles = arrays.getDoublesArray();
+      const integers = arrays.getIntegersArray();
+      const doublesStride = gd.InitialInstancesContainer.InstanceDoublesCount;
+      const integersStride = gd.InitialInstancesContainer.InstanceIntegersCount;
+      expect(doubles.length).toBe(3 * doublesStride);
+      expect(
+        arrays.getString(
+          integers[
+            2 * integersStride + gd.InitialInstancesContainer.InstanceLayer
+          ]
+        )
+      ).toBe('YetAnotherLayer');
+      expect(
+        integers[2 * integersStride + gd.InitialInstancesContainer.InstanceZOrder]
+      ).toBe(-1);
+
+      doubles[doublesStride + gd.InitialInstancesContainer.InstanceX] = 42;
+      container.importFromFlatArrays(arrays);
+      expect(container.getInstancesCount()).toBe(3);
+
+      let i = 0;
+      const functor = new gd.InitialInstanceJSFunctor();
+      functor.invoke = function (instance) {
+        instance = gd.wrapPointer(instance, gd.InitialInstance);
+        expect(instance.getX()).toBe(i === 1 ? 42 : 0);
+        i++;
+      };
+      container.iterateOverInstances(functor);
+      arrays.delete();
+    });
+    it('can round-trip instances through flat arrays', function () {
+      const sourceContainer = new gd.InitialInstancesContainer();
+      const instance1 = sourceContainer.insertNewInitialInstance();
+      instance1.setObjectName('MyObject');
+      instance1.setX(10.5);
+      instance1.setY(-20);
+      instance1.setAngle(45);
+      instance1.setZOrder(3);
+      instance1.setLayer('MyLayer');
+      instance1.setLocked(true);
+      const instance2 = sourceContainer.insertNewInitialInstance();
+      instance2.setObjectName('MyOtherObject');
+      instance2.setHasCustomSize(true);
+      instance2.setCustomWidth(34);
+      instance2.setCustomHeight(30);
+
+      const arrays = new gd.FlatArrays();
+      sourceContainer.exportToFlatArrays(arrays);
+
+      // Add an instance by writing the arrays directly. Views are only taken
+      // after the allocations, as the heap may grow.
+      arrays.resize(3);
+      const objectNameIndex = arrays.addString('MyThirdObject');
+      const layerIndex = arrays.addString('MyLayer');
+      const doublesStride = arrays.getDoublesStride();
+      const integersStride = arrays.getIntegersStride();
+      const doubles = arrays.getDoublesArray();
+      const integers = arrays.getIntegersArray();
+      doubles[2 * doublesStride + gd.InitialInstancesContainer.InstanceX] = 7;
+      doubles[2 * doublesStride + gd.InitialInstancesContainer.InstanceY] = 8;
+      integers[
+        2 * integersStride + gd.InitialInstancesContainer.InstanceObjectName
+      ] = objectNameIndex;
+      integers[2 * integersStride + gd.InitialInstancesContainer.InstanceLayer] =
+        layerIndex;
+      integers[2 * integersStride + gd.InitialInstancesContainer.InstanceFlags] =
+        gd.InitialInstancesContainer.InstanceLocked;
+
+      const targetContainer = new gd.InitialInstancesContainer();
+      targetContainer.importFromFlatArrays(arrays);
+      expect(targetContainer.getInstancesCount()).toBe(3);
+
+      const instances = [];
+      const functor = new gd.InitialInstanceJSFunctor();
+      functor.invoke = function (instance) {
+        instances.push(gd.wrapPointer(instance, gd.InitialInstance));
+      };
+      targetContainer.iterateOverInstances(functor);
+
+      expect(instances[0].getObjectName()).toBe('MyObject');
+      expect(instances[0].getX()).toBe(10.5);
+      expect(instances[0].getY()).toBe(-20);
+      expect(instances[0].getAngle()).toBe(45);
+      expect(instances[0].getZOrder()).toBe(3);
+      expect(instances[0].getLayer()).toBe('MyLayer');
+      expect(instances[0].isLocked()).toBe(true);
+      expect(instances[0].hasCustomSize()).toBe(false);
+      expect(instances[1].getObjectName()).toBe('MyOtherObject');
+      expect(instances[1].getLayer()).toBe('');
+      expect(instances[1].isLocked()).toBe(false);
+      expect(instances[1].hasCustomSize()).toBe(true);
+      expect(instances[1].getCustomWidth()).toBe(34);
+      expect(instances[1].getCustomHeight()).toBe(30);
+      expect(instances[2].getObjectName()).toBe('MyThirdObject');
+      expect(instances[2].getX()).toBe(7);
+      expect(instances[2].getY()).toBe(8);
+      expect(instances[2].getLayer()).toBe('MyLayer');
+      expect(instances[2].isLocked()).toBe(true);
+
+      // Exporting again gives the same arrays.
+      const otherArrays = new gd.FlatArrays();
+      targetContainer.exportToFlatArrays(otherArrays);
+      expect(Array.from(otherArrays.getDoublesArray())).toEqual(
+        Array.from(arrays.getDoublesArray())
+      );
+
+      otherArrays.delete();
+      arrays.delete();
+      sourceContainer.delete();
+      targetContainer.delete();
+    });
     it('can be cloned', function () {
       containerCopy = container.clone();
       expect(containerCopy.getInstancesCount()).toBe(3);
@@ -739,6 +855,60 @@ describe('libGD.js', function () {
 
       container.delete();
     });
+    it('can round-trip variables through flat arrays', function () {
+      const container = new gd.VariablesContainer();
+      container.insertNew('Number', 0).setValue(4.5);
+      container.insertNew('String', 1).setString('String with 官话 characters');
+      container.insertNew('Boolean', 2).setBool(true);
+      container.insertNew('Structure', 3).getChild('Child1').setValue(7);
+
+      const arrays = new gd.FlatArrays();
+      container.exportToFlatArrays(arrays);
+      expect(arrays.getElementsCount()).toBe(4);
+
+      const doubles = arrays.getDoublesArray();
+      const integers = arrays.getIntegersArray();
+      const doublesStride = gd.VariablesContainer.VariableDoublesCount;
+      const integersStride = gd.VariablesContainer.VariableIntegersCount;
+      expect(doubles[gd.VariablesContainer.VariableValue]).toBe(4.5);
+      expect(
+        integers[integersStride + gd.VariablesContainer.VariableType]
+      ).toBe(gd.Variable.String);
+      expect(
+        arrays.getString(
+          integers[integersStride + gd.VariablesContainer.VariableString]
+        )
+      ).toBe('String with 官话 characters');
+
+      const otherContainer = new gd.VariablesContainer();
+      otherContainer.importFromFlatArrays(arrays);
+      expect(otherContainer.count()).toBe(4);
+      expect(otherContainer.getNameAt(0)).toBe('Number');
+      expect(otherContainer.get('Number').getValue()).toBe(4.5);
+      expect(otherContainer.get('String').getString()).toBe(
+        'String with 官话 characters'
+      );
+      expect(otherContainer.get('Boolean').getType()).toBe(gd.Variable.Boolean);
+      expect(otherContainer.get('Boolean').getBool()).toBe(true);
+      expect(otherContainer.get('Structure').getType()).toBe(
+        gd.Variable.Structure
+      );
+
+      // Existing variables are updated and keep their children.
+      const structure = container.get('Structure');
+      const updatedDoubles = arrays.getDoublesArray();
+      updatedDoubles[gd.VariablesContainer.VariableValue] = 5;
+      updatedDoubles[2 * doublesStride + gd.VariablesContainer.VariableValue] =
+        0;
+      container.importFromFlatArrays(arrays);
+      expect(container.get('Number').getValue()).toBe(5);
+      expect(container.get('Boolean').getBool()).toBe(false);
+      expect(structure.getChild('Child1').getValue()).toBe(7);
+
+      arrays.delete();
+      container.delete();
+      otherContainer.delete();
+    });
   });
 
   describe('gd.Variable', function () {
@@ -145,4 +145,53 @@ describe('libGD.js object serialization', function() {
       checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
     });
   });
+
+  describe('gd.Serializer.fromJSObjectBinary and gd.Serializer.toJSObjectBinary', function() {
+    const checkJsonParseAndStringify = (json) => {
+      const object = JSON.parse(json);
+      const element = gd.Serializer.fromJSObjectBinary(object);
+      const outputObject = gd.Serializer.toJSObjectBinary(element);
+
+      expect(JSON.stringify(outputObject)).toBe(json);
+      element.delete();
+    }
+
+    it('should unserialize and reserialize JSON', function() {
+      checkJsonParseAndStringify('"a"');
+      checkJsonParseAndStringify('"String with 官话 characters"');
+      checkJsonParseAndStringify('""');
+      checkJsonParseAndStringify('{"a":{"a1":{"name":"","referenceTo":"/a/a1"}},"b":{"b1":"world"},"c":{"c1":3}}');
+      checkJsonParseAndStringify('[]');
+      checkJsonParseAndStringify('[{"a":1},2]');
+      checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
+    });
+    it('should give the same results as gd.Serializer.fromJSObject and gd.Serializer.toJSObject', function() {
+      const object = {
+        int: -42,
+        double: 1.5,
+        big: 12345678901,
+        bool: false,
+        strings: ['', 'a', 'String with 官话 characters', 'a'.repeat(100)],
+        empty: {},
+        nothing: null,
+      };
+      const element = gd.Serializer.fromJSObjectBinary(object);
+      const otherElement = gd.Serializer.fromJSObject(object);
+      expect(gd.Serializer.toJSON(element)).toBe(
+        gd.Serializer.toJSON(otherElement)
+      );
+      expect(gd.Serializer.toJSObjectBinary(element)).toEqual(
+        gd.Serializer.toJSObject(otherElement)
+      );
+
+      // Attributes and integers are converted too.
+      element.setStringAttribute('attribute', 'value');
+      element.addChild('integer').setIntValue(3);
+      expect(gd.Serializer.toJSObjectBinary(element)).toEqual(
+        gd.Serializer.toJSObject(element)
+      );
+      element.delete();
+      otherElement.delete();
+    });
+  });
 });
@@ -34,6 +34,9 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('JSON.parse + fromJSObject', () => {
         gd.Serializer.fromJSObject(JSON.parse(json));
+      })
+      .add('JSON.parse + fromJSObjectBinary', () => {
+        gd.Serializer.fromJSObjectBinary(JSON.parse(json));
       });
 
     console.log(benchmarkSuite.run());
@@ -50,6 +53,9 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('fromJSObject', () => {
         gd.Serializer.fromJSObject(jsObject);
+      })
+      .add('fromJSObjectBinary', () => {
+        gd.Serializer.fromJSObjectBinary(jsObject);
       });
 
     console.log(benchmarkSuite.run());
@@ -67,6 +73,11 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('toJSObject + JSON.stringify', () => {
         var outputJson = JSON.stringify(gd.Serializer.toJSObject(element));
+      })
+      .add('toJSObjectBinary + JSON.stringify', () => {
+        var outputJson = JSON.stringify(
+          gd.Serializer.toJSObjectBinary(element)
+        );
       });
 
     console.log(benchmarkSuite.run());
@@ -84,6 +95,9 @@ describe.skip('gd.Serializer benchmarks', function () {
       })
       .add('toJSObject', () => {
         gd.Serializer.toJSObject(element);
+      })
+      .add('toJSObjectBinary', () => {
+        gd.Serializer.toJSObjectBinary(element);
       });
 
     console.log(benchmarkSuite.run());
@@ -115,6 +115,29 @@ type Variable_Type = 0 | 1 | 2 | 3 | 4`
       ].join('\n'),
       'types/gdvariable.js'
     );
+    fs.writeFileSync(
+      'types/serializervalue_type.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type SerializerValue_Type = 0 | 1 | 2 | 3 | 4`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdSerializerValue {',
+      [
+        'declare class gdSerializerValue {',
+        '  static Unknown: 0;',
+        '  static Boolean: 1;',
+        '  static String: 2;',
+        '  static Int: 3;',
+        '  static Double: 4;',
+      ].join('\n'),
+      'types/gdserializervalue.js'
+    );
+    fs.writeFileSync(
+      'types/serializer_binaryformat.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type Serializer_BinaryFormat = 5 | 7 | 8 | 16 | 32`
+    );
     fs.writeFileSync(
       'types/expressioncompletiondescription_completionkind.js',
       `// Automatically generated by GDevelop.js/scripts/generate-types.js
@@ -133,6 +156,66 @@ type ExpressionCompletionDescription_CompletionKind = 0 | 1 | 2 | 3 | 4`
       ].join('\n'),
       'types/gdexpressioncompletiondescription.js'
     );
+    fs.writeFileSync(
+      'types/initialinstancescontainer_instancedouble.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceDouble = 0 | 1 | 2 | 3 | 4 | 5`
+    );
+    fs.writeFileSync(
+      'types/initialinstancescontainer_instanceinteger.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceInteger = 0 | 1 | 2 | 3 | 4`
+    );
+    fs.writeFileSync(
+      'types/initialinstancescontainer_instanceflag.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceFlag = 1 | 2`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdInitialInstancesContainer {',
+      [
+        'declare class gdInitialInstancesContainer {',
+        '  static InstanceX: 0;',
+        '  static InstanceY: 1;',
+        '  static InstanceAngle: 2;',
+        '  static InstanceCustomWidth: 3;',
+        '  static InstanceCustomHeight: 4;',
+        '  static InstanceDoublesCount: 5;',
+        '  static InstanceZOrder: 0;',
+        '  static InstanceLayer: 1;',
+        '  static InstanceObjectName: 2;',
+        '  static InstanceFlags: 3;',
+        '  static InstanceIntegersCount: 4;',
+        '  static InstanceLocked: 1;',
+        '  static InstanceHasCustomSize: 2;',
+      ].join('\n'),
+      'types/gdinitialinstancescontainer.js'
+    );
+    fs.writeFileSync(
+      'types/variablescontainer_variabledouble.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type VariablesContainer_VariableDouble = 0 | 1`
+    );
+    fs.writeFileSync(
+      'types/variablescontainer_variableinteger.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type VariablesContainer_VariableInteger = 0 | 1 | 2 | 3`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdVariablesContainer {',
+      [
+        'declare class gdVariablesContainer {',
+        '  static VariableValue: 0;',
+        '  static VariableDoublesCount: 1;',
+        '  static VariableName: 0;',
+        '  static VariableType: 1;',
+        '  static VariableString: 2;',
+        '  static VariableIntegersCount: 3;',
+      ].join('\n'),
+      'types/gdvariablescontainer.js'
+    );
     fs.writeFileSync(
       'types/particleemitterobject_renderertype.js',
       `// Automatically generated by GDevelop.js/scripts/generate-types.js
@@ -199,12 +282,31 @@ type ParticleEmitterObject_RendererType = 0 | 1 | 2`
       'declare class gdVectorString {\n  toJSArray(): Array<string>;',
       'types/gdvectorstring.js'
     );
+    shell.sed(
+      '-i',
+      'declare class gdFlatArrays {',
+      [
+        'declare class gdFlatArrays {',
+        '  getDoublesArray(): Float64Array;',
+        '  getIntegersArray(): Int32Array;',
+      ].join('\n'),
+      'types/gdflatarrays.js'
+    );
     shell.sed(
       '-i',
       'declare class gdSerializer {',
       `declare class gdSerializer {
+  static BinaryUndefinedValueType: 7;
+  static BinaryIntegralDoubleValueType: 5;
+  static BinaryValueTypeMask: 7;
+  static BinaryIsArrayFlag: 8;
+  static BinaryHasAttributesFlag: 16;
+  static BinaryHasChildrenFlag: 32;
+  static BinaryMaxSharedStringSize: 32;
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static fromJSObjectBinary(object: Object): gdSerializerElement;
+  static toJSObjectBinary(element: gdSerializerElement): any;
 `,
       'types/gdserializer.js'
     );
@@ -9,6 +9,8 @@ declare class gdAbstractFileSystemJS {
   dirNameFrom(dir: string): string;
   isAbsolute(fn: string): boolean;
   copyFile(src: string, dest: string): void;
+  isFileCopyUpToDate(src: string, dest: string): boolean;
+  linkFile(src: string, dest: string): boolean;
   writeToFile(fn: string, content: string): void;
   readFile(fn: string): string;
   readDir(dir: string): gdVectorString;
@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsSearchIndex {
+  constructor(platform: gdPlatform): void;
+  search(events: gdEventsList, search: string, matchCase: boolean, inConditions: boolean, inActions: boolean, inEventStrings: boolean, inEventSentences: boolean): gdVectorEventsSearchResult;
+  updateEvent(event: gdBaseEvent): void;
+  clear(): void;
+  getIndexedEventsCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdFlatArrays {
+  getDoublesArray(): Float64Array;
+  getIntegersArray(): Int32Array;
+  constructor(): void;
+  reset(doublesStride: number, integersStride: number): void;
+  resize(elementsCount: number): void;
+  getElementsCount(): number;
+  getDoublesStride(): number;
+  getIntegersStride(): number;
+  addString(str: string): number;
+  getString(index: number): string;
+  getStrings(): gdVectorString;
+  getDoublesData(): gdEmscriptenObject;
+  getDoublesCount(): number;
+  getIntegersData(): gdEmscriptenObject;
+  getIntegersCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
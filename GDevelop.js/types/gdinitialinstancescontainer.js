@@ -1,5 +1,18 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdInitialInstancesContainer {
+  static InstanceX: 0;
+  static InstanceY: 1;
+  static InstanceAngle: 2;
+  static InstanceCustomWidth: 3;
+  static InstanceCustomHeight: 4;
+  static InstanceDoublesCount: 5;
+  static InstanceZOrder: 0;
+  static InstanceLayer: 1;
+  static InstanceObjectName: 2;
+  static InstanceFlags: 3;
+  static InstanceIntegersCount: 4;
+  static InstanceLocked: 1;
+  static InstanceHasCustomSize: 2;
   constructor(): void;
   clone(): gdInitialInstancesContainer;
   getInstancesCount(): number;
@@ -14,6 +27,8 @@ declare class gdInitialInstancesContainer {
   removeInstance(inst: gdInitialInstance): void;
   insertNewInitialInstance(): gdInitialInstance;
   insertInitialInstance(inst: gdInitialInstance): gdInitialInstance;
+  exportToFlatArrays(arrays: gdFlatArrays): void;
+  importFromFlatArrays(arrays: gdFlatArrays): void;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(element: gdSerializerElement): void;
   delete(): void;
@@ -9,6 +9,7 @@ declare class gdPreviewExportOptions {
   setProjectDataOnlyExport(enable: boolean): gdPreviewExportOptions;
   setFullLoadingScreen(enable: boolean): gdPreviewExportOptions;
   setNonRuntimeScriptsCacheBurst(value: number): gdPreviewExportOptions;
+  setIncrementalExport(enable: boolean): gdPreviewExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
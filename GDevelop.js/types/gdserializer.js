@@ -1,7 +1,16 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdSerializer {
+  static BinaryUndefinedValueType: 7;
+  static BinaryIntegralDoubleValueType: 5;
+  static BinaryValueTypeMask: 7;
+  static BinaryIsArrayFlag: 8;
+  static BinaryHasAttributesFlag: 16;
+  static BinaryHasChildrenFlag: 32;
+  static BinaryMaxSharedStringSize: 32;
   static fromJSObject(object: Object): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
+  static fromJSObjectBinary(object: Object): gdSerializerElement;
+  static toJSObjectBinary(element: gdSerializerElement): any;
 
   static toJSON(element: gdSerializerElement): string;
   static fromJSON(json: string): gdSerializerElement;
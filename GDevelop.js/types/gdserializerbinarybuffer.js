@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdSerializerBinaryBuffer {
+  constructor(): void;
+  writeElement(element: gdSerializerElement): void;
+  readElement(element: gdSerializerElement): boolean;
+  resize(size: number): void;
+  getData(): gdEmscriptenObject;
+  getSize(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -1,10 +1,19 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdSerializerValue {
+  static Unknown: 0;
+  static Boolean: 1;
+  static String: 2;
+  static Int: 3;
+  static Double: 4;
   getBool(): boolean;
   getString(): string;
   getInt(): number;
   getDouble(): number;
   getRawString(): string;
+  getRawBool(): boolean;
+  getRawInt(): number;
+  getRawDouble(): number;
+  getType(): SerializerValue_Type;
   isBoolean(): boolean;
   isString(): boolean;
   isInt(): boolean;
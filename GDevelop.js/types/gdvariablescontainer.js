@@ -1,5 +1,11 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdVariablesContainer {
+  static VariableValue: 0;
+  static VariableDoublesCount: 1;
+  static VariableName: 0;
+  static VariableType: 1;
+  static VariableString: 2;
+  static VariableIntegersCount: 3;
   constructor(): void;
   has(name: string): boolean;
   get(name: string): gdVariable;
@@ -15,6 +21,8 @@ declare class gdVariablesContainer {
   count(): number;
   clear(): void;
   removeRecursively(variableToRemove: gdVariable): void;
+  exportToFlatArrays(arrays: gdFlatArrays): void;
+  importFromFlatArrays(arrays: gdFlatArrays): void;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(element: gdSerializerElement): void;
   delete(): void;
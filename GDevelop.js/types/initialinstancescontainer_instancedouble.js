@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceDouble = 0 | 1 | 2 | 3 | 4 | 5
\ No newline at end of file
@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceFlag = 1 | 2
\ No newline at end of file
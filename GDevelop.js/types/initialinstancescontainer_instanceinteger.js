@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InitialInstancesContainer_InstanceInteger = 0 | 1 | 2 | 3 | 4
\ No newline at end of file
@@ -56,6 +56,9 @@ declare class libGDevelop {
   Variable_Type: Class<Variable_Type>;
   Variable: Class<gdVariable>;
   VariablesContainer: Class<gdVariablesContainer>;
+  VariablesContainer_VariableDouble: Class<VariablesContainer_VariableDouble>;
+  VariablesContainer_VariableInteger: Class<VariablesContainer_VariableInteger>;
+  FlatArrays: Class<gdFlatArrays>;
   ObjectGroup: Class<gdObjectGroup>;
   ObjectGroupsContainer: Class<gdObjectGroupsContainer>;
   PlatformSpecificAssets: Class<gdPlatformSpecificAssets>;
@@ -92,14 +95,19 @@ declare class libGDevelop {
   JsonResource: Class<gdJsonResource>;
   InitialInstance: Class<gdInitialInstance>;
   InitialInstancesContainer: Class<gdInitialInstancesContainer>;
+  InitialInstancesContainer_InstanceDouble: Class<InitialInstancesContainer_InstanceDouble>;
+  InitialInstancesContainer_InstanceInteger: Class<InitialInstancesContainer_InstanceInteger>;
+  InitialInstancesContainer_InstanceFlag: Class<InitialInstancesContainer_InstanceFlag>;
   HighestZOrderFinder: Class<gdHighestZOrderFinder>;
   InitialInstanceFunctor: Class<gdInitialInstanceFunctor>;
   InitialInstanceJSFunctorWrapper: Class<gdInitialInstanceJSFunctorWrapper>;
   InitialInstanceJSFunctor: Class<gdInitialInstanceJSFunctor>;
+  SerializerValue_Type: Class<SerializerValue_Type>;
   SerializerValue: Class<gdSerializerValue>;
   SerializerElement: Class<gdSerializerElement>;
   SharedPtrSerializerElement: Class<gdSharedPtrSerializerElement>;
   Serializer: Class<gdSerializer>;
+  SerializerBinaryBuffer: Class<gdSerializerBinaryBuffer>;
   InstructionsList: Class<gdInstructionsList>;
   Instruction: Class<gdInstruction>;
   VectorPairStringTextFormatting: Class<gdVectorPairStringTextFormatting>;
@@ -135,6 +143,7 @@ declare class libGDevelop {
   EventsSearchResult: Class<gdEventsSearchResult>;
   VectorEventsSearchResult: Class<gdVectorEventsSearchResult>;
   EventsRefactorer: Class<gdEventsRefactorer>;
+  EventsSearchIndex: Class<gdEventsSearchIndex>;
   UnfilledRequiredBehaviorPropertyProblem: Class<gdUnfilledRequiredBehaviorPropertyProblem>;
   VectorUnfilledRequiredBehaviorPropertyProblem: Class<gdVectorUnfilledRequiredBehaviorPropertyProblem>;
   WholeProjectRefactorer: Class<gdWholeProjectRefactorer>;
@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type Serializer_BinaryFormat = 5 | 7 | 8 | 16 | 32
\ No newline at end of file
@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type VariablesContainer_VariableDouble = 0 | 1
\ No newline at end of file
@@ -61,10 +61,36 @@ export default class EventsSearcher extends React.Component<Props, State> {
   // this._updateListOfResultEvents before being used.
   _resultEvents: ?Array<gdBaseEvent> = null;
 
+  // The index of the events, kept between searches so that only the events
+  // modified since the last search are indexed again.
+  _searchIndex: ?gdEventsSearchIndex = null;
+
+  componentDidUpdate(prevProps: Props) {
+    // An index is only used for a single list of events.
+    if (prevProps.events !== this.props.events && this._searchIndex) {
+      this._searchIndex.delete();
+      this._searchIndex = null;
+    }
+  }
+
   componentWillUnmount() {
     this.reset();
+    if (this._searchIndex) {
+      this._searchIndex.delete();
+      this._searchIndex = null;
+    }
   }
 
+  _getSearchIndex = (): gdEventsSearchIndex => {
+    if (!this._searchIndex) {
+      this._searchIndex = new gd.EventsSearchIndex(
+        this.props.project.getCurrentPlatform()
+      );
+    }
+
+    return this._searchIndex;
+  };
+
   reset = () => {
     if (this.state.eventsSearchResults) this.state.eventsSearchResults.delete();
 
@@ -129,8 +155,7 @@ export default class EventsSearcher extends React.Component<Props, State> {
       console.error('Search in selection is not implemented yet');
     }
 
-    const newEventsSearchResults = gd.EventsRefactorer.searchInEvents(
-      this.props.project.getCurrentPlatform(),
+    const newEventsSearchResults = this._getSearchIndex().search(
       events,
       searchText,
       matchCase,
@@ -81,13 +81,48 @@ export default {
 
     source = this._translateUrl(source);
     try {
-      if (source !== dest) fs.copySync(source, dest);
+      // The modification time is preserved, so that isFileCopyUpToDate can
+      // check that the copy was not changed since.
+      if (source !== dest)
+        fs.copySync(source, dest, { preserveTimestamps: true });
     } catch (e) {
       console.error('copyFile(' + source + ', ' + dest + ') failed: ' + e);
       return false;
     }
     return true;
   },
+  isFileCopyUpToDate: function(source, dest) {
+    if (this._isExternalUrl(source)) return false;
+
+    source = this._translateUrl(source);
+    try {
+      const sourceStat = fs.statSync(source);
+      const destStat = fs.statSync(dest);
+      // Copies have the modification time of the file: a different one
+      // means that the file or the copy was changed (even if the copy is
+      // newer).
+      return (
+        destStat.isFile() &&
+        sourceStat.size === destStat.size &&
+        Math.floor(sourceStat.mtimeMs) === Math.floor(destStat.mtimeMs)
+      );
+    } catch (e) {
+      return false;
+    }
+  },
+  linkFile: function(source, dest) {
+    if (this._isExternalUrl(source)) return false;
+
+    source = this._translateUrl(source);
+    try {
+      if (source === dest) return true;
+      fs.removeSync(dest);
+      fs.linkSync(source, dest);
+    } catch (e) {
+      return false;
+    }
+    return true;
+  },
   writeToFile: function(file, contents) {
     try {
       fs.outputFileSync(file, contents);
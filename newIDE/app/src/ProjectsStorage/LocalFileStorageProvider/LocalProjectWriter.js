@@ -167,7 +167,8 @@ export const onSaveProjectAs = (
     projectPath,
     true, // Update the project with the new resource paths
     false, // Don't move absolute files
-    true // Keep relative files folders structure.
+    true, // Keep relative files folders structure.
+    false // Copy files (the new project must not share files with the old one).
   );
 
   // Update the project with the new file path (resources have already been updated)